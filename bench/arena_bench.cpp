@@ -0,0 +1,89 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   arena_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 12:20 PM
+ */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <string>
+
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+const std::string split_input = "Host:Accept:Accept-Encoding:Accept-Language:Cache-Control:"
+        "Connection:Content-Length:Content-Type:Cookie:User-Agent:X-Forwarded-For:X-Request-Id";
+
+const std::string trim_input = "   application/x-www-form-urlencoded; charset=utf-8   ";
+
+const bench::registrar split_heap{"arena/split_heap", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto vec = sl::utils::split(split_input, ':');
+        bench::do_not_optimize(vec);
+    }
+}};
+
+const bench::registrar split_arena{"arena/split_arena", [](size_t n) {
+    sl::utils::arena ar{};
+    for (size_t i = 0; i < n; i++) {
+        auto vec = sl::utils::split(split_input, ':', ar);
+        bench::do_not_optimize(vec);
+        ar.reset();
+    }
+}};
+
+const bench::registrar trim_heap{"arena/trim_heap", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto st = sl::utils::trim(trim_input);
+        bench::do_not_optimize(st);
+    }
+}};
+
+const bench::registrar trim_arena{"arena/trim_arena", [](size_t n) {
+    sl::utils::arena ar{};
+    for (size_t i = 0; i < n; i++) {
+        auto st = sl::utils::trim(trim_input, ar);
+        bench::do_not_optimize(st);
+        ar.reset();
+    }
+}};
+
+// heap variant does one malloc per call, it is not counted in allocs/op
+const bench::registrar alloc_copy_heap{"arena/alloc_copy_heap", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        char* buf = sl::utils::alloc_copy(trim_input);
+        bench::do_not_optimize(buf);
+        std::free(buf);
+    }
+}};
+
+const bench::registrar alloc_copy_arena{"arena/alloc_copy_arena", [](size_t n) {
+    sl::utils::arena ar{};
+    for (size_t i = 0; i < n; i++) {
+        char* buf = sl::utils::alloc_copy(trim_input, ar);
+        bench::do_not_optimize(buf);
+        ar.reset();
+    }
+}};
+
+} // namespace
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   bench.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:40 AM
+ */
+
+#ifndef STATICLIB_UTILS_BENCH_HPP
+#define STATICLIB_UTILS_BENCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "staticlib/support.hpp"
+
+namespace bench {
+
+/**
+ * Benchmark body, must run the measured operation the specified
+ * number of times
+ */
+typedef std::function<void(size_t)> bench_fun;
+
+/**
+ * Registered benchmark
+ */
+struct bench_case {
+    std::string name;
+    bench_fun fun;
+    size_t bytes_per_op;
+};
+
+/**
+ * Global list of registered benchmarks
+ * 
+ * @return list of benchmarks
+ */
+std::vector<bench_case>& registry();
+
+/**
+ * Registers benchmark on construction, intended to be used
+ * for static instances
+ */
+struct registrar {
+    registrar(const std::string& name, bench_fun fun, size_t bytes_per_op = 0) {
+        registry().push_back(bench_case{name, std::move(fun), bytes_per_op});
+    }
+};
+
+/**
+ * Setup for the benchmark parameterized by the input size, must prepare
+ * the input of the specified size and return the benchmark body,
+ * it is called once before the first run
+ */
+typedef std::function<bench_fun(size_t)> sized_bench_setup;
+
+/**
+ * Registers one benchmark for each of the specified input sizes,
+ * named as `name/size`
+ */
+struct sized_registrar {
+    /**
+     * Constructor, uses default input sizes: 16, 256, 4096 and 65536
+     * 
+     * @param name base name
+     * @param setup benchmark setup
+     * @param count_bytes whether input size should be reported as bytes processed per op
+     */
+    sized_registrar(const std::string& name, sized_bench_setup setup, bool count_bytes = true) :
+    sized_registrar(name, {16, 256, 4096, 65536}, std::move(setup), count_bytes) { }
+
+    /**
+     * Constructor
+     * 
+     * @param name base name
+     * @param sizes input sizes
+     * @param setup benchmark setup
+     * @param count_bytes whether input size should be reported as bytes processed per op
+     */
+    sized_registrar(const std::string& name, std::initializer_list<size_t> sizes, sized_bench_setup setup,
+            bool count_bytes = true) {
+        for (size_t size : sizes) {
+            auto body = std::make_shared<bench_fun>();
+            registry().push_back(bench_case{name + "/" + sl::support::to_string(size), [setup, size, body](size_t n) {
+                if (!*body) {
+                    *body = setup(size);
+                }
+                (*body)(n);
+            }, count_bytes ? size : 0});
+        }
+    }
+};
+
+/**
+ * Number of calls to global `operator new` made by this process so far
+ * 
+ * @return allocations count
+ */
+size_t allocations_count();
+
+/**
+ * Prevents compiler from optimizing away the computation of specified value
+ * 
+ * @param val value to keep
+ */
+template<typename T>
+inline void do_not_optimize(const T& val) {
+#ifdef _MSC_VER
+    static volatile const void* sink;
+    sink = &val;
+#else
+    asm volatile("" : : "r,m"(val) : "memory");
+#endif // _MSC_VER
+}
+
+} // namespace
+
+#endif /* STATICLIB_UTILS_BENCH_HPP */
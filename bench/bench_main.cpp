@@ -0,0 +1,255 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   bench_main.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:52 AM
+ */
+
+#include "bench.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace { // anonymous
+
+std::atomic<size_t>& static_allocations() {
+    static std::atomic<size_t> count{0};
+    return count;
+}
+
+struct options {
+    std::string filter;
+    std::string json_path;
+    std::chrono::milliseconds min_time{100};
+    size_t repetitions = 1;
+};
+
+struct measurement {
+    std::string name;
+    size_t iterations;
+    double ns_per_op;
+    // process CPU time of all threads, includes background workers of the benchmark
+    double cpu_ns_per_op;
+    double allocs_per_op;
+    size_t bytes_per_op;
+};
+
+const std::string usage = "usage: staticlib_utils_bench [--json=<path>] [--repetitions=<n>] "
+        "[--min_time_ms=<n>] [filter]";
+
+bool parse_option(const std::string& arg, const std::string& prefix, std::string& value) {
+    if (0 != arg.compare(0, prefix.length(), prefix)) {
+        return false;
+    }
+    value = arg.substr(prefix.length());
+    return true;
+}
+
+options parse_options(int argc, char** argv) {
+    options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (parse_option(arg, "--json=", value)) {
+            opts.json_path = value;
+        } else if (parse_option(arg, "--repetitions=", value)) {
+            opts.repetitions = std::strtoul(value.c_str(), nullptr, 10);
+            if (0 == opts.repetitions) {
+                throw std::invalid_argument(usage);
+            }
+        } else if (parse_option(arg, "--min_time_ms=", value)) {
+            opts.min_time = std::chrono::milliseconds(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (0 == arg.compare(0, 2, "--")) {
+            throw std::invalid_argument(usage);
+        } else {
+            opts.filter = arg;
+        }
+    }
+    return opts;
+}
+
+// best of the specified number of repetitions
+measurement run(const bench::bench_case& bc, const options& opts) {
+    // warm up and calibrate iterations count
+    size_t iterations = 1;
+    for (;;) {
+        auto start = std::chrono::steady_clock::now();
+        bc.fun(iterations);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed >= opts.min_time || iterations >= (1u << 30)) {
+            break;
+        }
+        iterations *= 2;
+    }
+    measurement res{bc.name, iterations, 0, 0, 0, bc.bytes_per_op};
+    for (size_t i = 0; i < opts.repetitions; i++) {
+        size_t allocs_before = bench::allocations_count();
+        std::clock_t cpu_start = std::clock();
+        auto start = std::chrono::steady_clock::now();
+        bc.fun(iterations);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        std::clock_t cpu_elapsed = std::clock() - cpu_start;
+        size_t allocs = bench::allocations_count() - allocs_before;
+        double ns = static_cast<double> (std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        double ns_per_op = ns / static_cast<double> (iterations);
+        if (0 == i || ns_per_op < res.ns_per_op) {
+            res.ns_per_op = ns_per_op;
+            res.cpu_ns_per_op = static_cast<double> (cpu_elapsed) * 1e9 / CLOCKS_PER_SEC /
+                    static_cast<double> (iterations);
+            res.allocs_per_op = static_cast<double> (allocs) / static_cast<double> (iterations);
+        }
+    }
+    return res;
+}
+
+std::string json_escape(const std::string& str) {
+    std::string res;
+    for (char ch : str) {
+        if ('"' == ch || '\\' == ch) {
+            res.push_back('\\');
+            res.push_back(ch);
+        } else if (static_cast<unsigned char> (ch) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned> (ch));
+            res.append(buf);
+        } else {
+            res.push_back(ch);
+        }
+    }
+    return res;
+}
+
+// layout follows Google Benchmark JSON output, so its tools can read it too
+void write_json(const std::string& path, const std::string& executable, const options& opts,
+        const std::vector<measurement>& results) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (nullptr == file) {
+        throw std::runtime_error("Cannot open JSON output file: [" + path + "]");
+    }
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(std::addressof(now)));
+    std::fprintf(file, "{\n  \"context\": {\n");
+    std::fprintf(file, "    \"date\": \"%s\",\n", date);
+    std::fprintf(file, "    \"executable\": \"%s\",\n", json_escape(executable).c_str());
+    std::fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(file, "    \"repetitions\": %zu,\n", opts.repetitions);
+#ifdef NDEBUG
+    std::fprintf(file, "    \"library_build_type\": \"release\"\n");
+#else
+    std::fprintf(file, "    \"library_build_type\": \"debug\"\n");
+#endif // NDEBUG
+    std::fprintf(file, "  },\n  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++) {
+        const measurement& me = results[i];
+        std::fprintf(file, "%s\n    {\n", i > 0 ? "," : "");
+        std::fprintf(file, "      \"name\": \"%s\",\n", json_escape(me.name).c_str());
+        std::fprintf(file, "      \"iterations\": %zu,\n", me.iterations);
+        std::fprintf(file, "      \"real_time\": %.3f,\n", me.ns_per_op);
+        std::fprintf(file, "      \"cpu_time\": %.3f,\n", me.cpu_ns_per_op);
+        std::fprintf(file, "      \"time_unit\": \"ns\",\n");
+        std::fprintf(file, "      \"allocs_per_iteration\": %.3f", me.allocs_per_op);
+        if (me.bytes_per_op > 0) {
+            std::fprintf(file, ",\n      \"bytes_per_second\": %.0f",
+                    static_cast<double> (me.bytes_per_op) * 1e9 / me.ns_per_op);
+        }
+        std::fprintf(file, "\n    }");
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+    if (0 != std::fclose(file)) {
+        throw std::runtime_error("Cannot write JSON output file: [" + path + "]");
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    static_allocations().fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace bench {
+
+std::vector<bench_case>& registry() {
+    static std::vector<bench_case> vec{};
+    return vec;
+}
+
+size_t allocations_count() {
+    return static_allocations().load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        options opts = parse_options(argc, argv);
+        std::vector<measurement> results;
+        std::printf("%-48s %12s %12s %12s %12s %10s\n", "benchmark", "iterations", "ns/op", "cpu ns/op",
+                "allocs/op", "GB/s");
+        for (bench::bench_case& bc : bench::registry()) {
+            if (!opts.filter.empty() && std::string::npos == bc.name.find(opts.filter)) {
+                continue;
+            }
+            try {
+                measurement me = run(bc, opts);
+                std::printf("%-48s %12zu %12.2f %12.2f %12.2f", me.name.c_str(), me.iterations, me.ns_per_op,
+                        me.cpu_ns_per_op, me.allocs_per_op);
+                if (me.bytes_per_op > 0) {
+                    std::printf(" %10.2f", static_cast<double> (me.bytes_per_op) / me.ns_per_op);
+                }
+                std::printf("\n");
+                std::fflush(stdout);
+                results.push_back(std::move(me));
+            } catch (const std::exception& e) {
+                std::cout << bc.name << ": " << e.what() << std::endl;
+                return 1;
+            }
+        }
+        if (!opts.json_path.empty()) {
+            write_json(opts.json_path, argv[0], opts, results);
+        }
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
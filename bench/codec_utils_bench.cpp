@@ -0,0 +1,95 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   codec_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 12:05 PM
+ */
+
+#include "bench.hpp"
+
+#include <random>
+#include <string>
+
+#include "staticlib/utils/codec_utils.hpp"
+
+namespace { // anonymous
+
+const size_t payload_size = 64 * 1024;
+
+const std::string& payload() {
+    static std::string data = [] {
+        std::mt19937 engine{42};
+        std::string res;
+        for (size_t i = 0; i < payload_size; i++) {
+            res.push_back(static_cast<char> (engine()));
+        }
+        return res;
+    }();
+    return data;
+}
+
+const bench::registrar hex_encode{"codec_utils/hex_encode/65536", [](size_t n) {
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::hex_encode(payload().data(), payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar hex_decode{"codec_utils/hex_decode/65536", [](size_t n) {
+    std::string enc = sl::utils::hex_encode(payload());
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::hex_decode(enc.data(), enc.length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar b64_encode{"codec_utils/base64_encode/65536", [](size_t n) {
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::base64_encode(payload().data(), payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar b64_decode{"codec_utils/base64_decode/65536", [](size_t n) {
+    std::string enc = sl::utils::base64_encode(payload());
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::base64_decode(enc.data(), enc.length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar b64url_decode{"codec_utils/base64url_decode/65536", [](size_t n) {
+    std::string enc = sl::utils::base64_encode(payload(), sl::utils::base64_variant::url_unpadded);
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::base64_decode(enc.data(), enc.length(), out, sl::utils::base64_variant::url_unpadded);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+} // namespace
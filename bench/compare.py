@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+# Copyright 2015, alex at staticlibs.net
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Compares two JSON outputs of staticlib_utils_bench (--json=<path>),
+exits with code 1 if any benchmark regressed by more than the threshold.
+
+usage: compare.py [--threshold=<percent>] baseline.json contender.json
+"""
+
+import json
+import sys
+
+
+def load(path):
+    with open(path) as fd:
+        doc = json.load(fd)
+    return [(bm["name"], bm) for bm in doc["benchmarks"]]
+
+
+def main(argv):
+    threshold = 5.0
+    paths = []
+    for arg in argv[1:]:
+        if arg.startswith("--threshold="):
+            threshold = float(arg[len("--threshold="):])
+        else:
+            paths.append(arg)
+    if 2 != len(paths):
+        sys.stderr.write(__doc__.lstrip())
+        return 2
+    baseline_list = load(paths[0])
+    contender_list = load(paths[1])
+    baseline = dict(baseline_list)
+    contender = dict(contender_list)
+    # registration order keeps the sizes of one benchmark together
+    names = [name for name, _ in baseline_list]
+    names.extend(name for name, _ in contender_list if name not in baseline)
+
+    regressions = 0
+    print("%-48s %12s %12s %9s %11s" % ("benchmark", "base ns/op", "new ns/op", "delta", "allocs/op"))
+    for name in names:
+        if name not in contender:
+            print("%-48s %12.2f %12s" % (name, baseline[name]["real_time"], "removed"))
+            continue
+        if name not in baseline:
+            print("%-48s %12s %12.2f" % (name, "added", contender[name]["real_time"]))
+            continue
+        base = baseline[name]
+        new = contender[name]
+        delta = (new["real_time"] - base["real_time"]) * 100.0 / base["real_time"]
+        base_allocs = base.get("allocs_per_iteration", 0.0)
+        new_allocs = new.get("allocs_per_iteration", 0.0)
+        flags = []
+        if delta > threshold:
+            flags.append("SLOWER")
+        # allocation counts are deterministic, any growth is reported
+        if new_allocs > base_allocs + 0.01:
+            flags.append("MORE ALLOCS")
+        if flags:
+            regressions += 1
+        line = "%-48s %12.2f %12.2f %+8.1f%% %5.1f->%-5.1f %s" % (name, base["real_time"], new["real_time"],
+                delta, base_allocs, new_allocs, " ".join(flags))
+        print(line.rstrip())
+
+    if regressions > 0:
+        print("\n%d regression(s) above %.1f%% threshold" % (regressions, threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   format_bench.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 11:45 AM
+ */
+
+#include "bench.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include "staticlib/support.hpp"
+
+#include "staticlib/utils/format.hpp"
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace { // anonymous
+
+const std::string path = "/var/lib/app/data/config.json";
+
+const int signum = 15;
+
+// message construction as it was done before the formatter, kept for comparison
+const bench::registrar concat{"format/message_concat", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        std::string msg = "Error opening file: [" + path + "], signal: [" + sl::support::to_string(signum) + "]," +
+                " error: [" + ::strerror(ENOENT) + "]";
+        bench::do_not_optimize(msg);
+    }
+}};
+
+const bench::registrar format{"format/message_format", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto buf = STATICLIB_UTILS_FORMAT("Error opening file: [{}], signal: [{}], error: [{}]",
+                path, signum, sl::utils::errno_text(ENOENT));
+        bench::do_not_optimize(buf);
+    }
+}};
+
+const bench::registrar exception_concat{"format/exception_concat", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        sl::utils::utils_exception e(TRACEMSG("Error opening file: [" + path + "]," +
+                " signal: [" + sl::support::to_string(signum) + "], error: [" + ::strerror(ENOENT) + "]"));
+        bench::do_not_optimize(e);
+    }
+}};
+
+const bench::registrar exception_format{"format/exception_format", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error opening file: [{}], signal: [{}], error: [{}]", path, signum, sl::utils::errno_text(ENOENT)));
+        bench::do_not_optimize(e);
+    }
+}};
+
+} // namespace
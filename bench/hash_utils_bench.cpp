@@ -0,0 +1,70 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   hash_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:30 PM
+ */
+
+#include "bench.hpp"
+
+#include <functional>
+#include <string>
+
+#include "staticlib/utils/hash_utils.hpp"
+
+namespace { // anonymous
+
+const std::string key_16(16, 'k');
+const std::string key_64(64, 'k');
+const std::string key_1k(1024, 'k');
+const std::string key_64k(64 * 1024, 'k');
+
+template<typename Func>
+bench::bench_fun hash_loop(const std::string& key, Func fun) {
+    return [&key, fun](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto h = fun(key);
+            bench::do_not_optimize(h);
+        }
+    };
+}
+
+uint64_t sl_hash(const std::string& st) {
+    return sl::utils::hash64(st);
+}
+
+size_t std_hash(const std::string& st) {
+    return std::hash<std::string>()(st);
+}
+
+uint64_t sl_stream(const std::string& st) {
+    return sl::utils::hash64_stream().update(st).digest();
+}
+
+const bench::registrar hash64_16{"hash_utils/hash64/16", hash_loop(key_16, sl_hash)};
+const bench::registrar hash64_64{"hash_utils/hash64/64", hash_loop(key_64, sl_hash)};
+const bench::registrar hash64_1k{"hash_utils/hash64/1024", hash_loop(key_1k, sl_hash)};
+const bench::registrar hash64_64k{"hash_utils/hash64/65536", hash_loop(key_64k, sl_hash)};
+const bench::registrar stream_64k{"hash_utils/hash64_stream/65536", hash_loop(key_64k, sl_stream)};
+const bench::registrar std_16{"hash_utils/std_hash/16", hash_loop(key_16, std_hash)};
+const bench::registrar std_64{"hash_utils/std_hash/64", hash_loop(key_64, std_hash)};
+const bench::registrar std_1k{"hash_utils/std_hash/1024", hash_loop(key_1k, std_hash)};
+const bench::registrar std_64k{"hash_utils/std_hash/65536", hash_loop(key_64k, std_hash)};
+
+} // namespace
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   id_generator_bench.cpp
+ * Author: alex
+ *
+ * Created on October 27, 2026, 4:05 PM
+ */
+
+#include "bench.hpp"
+
+#include <string>
+
+#include "staticlib/utils/id_generator.hpp"
+#include "staticlib/utils/random_string_generator.hpp"
+
+namespace { // anonymous
+
+// previous way to mint request IDs, for comparison
+const bench::registrar random_string{"id_generator/random_string_32", [](size_t n) {
+    sl::utils::random_string_generator gen{};
+    std::string id(32, '#');
+    for (size_t i = 0; i < n; i++) {
+        gen.generate(id);
+        bench::do_not_optimize(id);
+    }
+}};
+
+const bench::registrar v4{"id_generator/v4", [](size_t n) {
+    sl::utils::id_generator gen{};
+    for (size_t i = 0; i < n; i++) {
+        auto id = gen.generate_v4();
+        bench::do_not_optimize(id);
+    }
+}};
+
+const bench::registrar v4_format{"id_generator/v4_format", [](size_t n) {
+    sl::utils::id_generator gen{};
+    char buf[sl::utils::uuid::string_length];
+    for (size_t i = 0; i < n; i++) {
+        gen.generate_v4().format(buf);
+        bench::do_not_optimize(buf);
+    }
+}};
+
+const bench::registrar v4_to_string{"id_generator/v4_to_string", [](size_t n) {
+    sl::utils::id_generator gen{};
+    for (size_t i = 0; i < n; i++) {
+        auto st = gen.generate_v4().to_string();
+        bench::do_not_optimize(st);
+    }
+}};
+
+const bench::registrar v7{"id_generator/v7", [](size_t n) {
+    sl::utils::id_generator gen{};
+    for (size_t i = 0; i < n; i++) {
+        auto id = gen.generate_v7();
+        bench::do_not_optimize(id);
+    }
+}};
+
+const bench::registrar v7_format{"id_generator/v7_format", [](size_t n) {
+    sl::utils::id_generator gen{};
+    char buf[sl::utils::uuid::string_length];
+    for (size_t i = 0; i < n; i++) {
+        gen.generate_v7().format(buf);
+        bench::do_not_optimize(buf);
+    }
+}};
+
+const bench::registrar sequential{"id_generator/sequential", [](size_t n) {
+    sl::utils::id_generator gen{};
+    for (size_t i = 0; i < n; i++) {
+        auto id = gen.generate_sequential();
+        bench::do_not_optimize(id);
+    }
+}};
+
+const bench::registrar thread_local_v4{"id_generator/thread_local_v4", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto id = sl::utils::generate_uuid_v4();
+        bench::do_not_optimize(id);
+    }
+}};
+
+const bench::registrar thread_local_v7{"id_generator/thread_local_v7", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto id = sl::utils::generate_uuid_v7();
+        bench::do_not_optimize(id);
+    }
+}};
+
+} // namespace
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   kv_scanner_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:58 PM
+ */
+
+#include "bench.hpp"
+
+#include <string>
+
+#include "staticlib/utils/kv_scanner.hpp"
+#include "staticlib/utils/string_utils.hpp"
+#include "staticlib/utils/url_utils.hpp"
+
+namespace { // anonymous
+
+const std::string query = "client_id=web-frontend&redirect_uri=https%3A%2F%2Fexample.com%2Fcallback"
+        "&response_type=code&scope=openid+profile+email&state=af0ifjsldkj&nonce=n-0S6_WzA2Mj";
+
+// baseline: split twice and decode every piece
+const bench::registrar split_decode{"kv_scanner/split_decode", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        size_t total = 0;
+        for (const std::string& pair : sl::utils::split(query, '&')) {
+            auto kv = sl::utils::split(pair, '=');
+            for (const std::string& part : kv) {
+                total += sl::utils::url_decode(part).length();
+            }
+        }
+        bench::do_not_optimize(total);
+    }
+}};
+
+const bench::registrar scan_raw{"kv_scanner/scan_raw", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        size_t total = 0;
+        sl::utils::kv_scanner sc{query};
+        sl::utils::kv_pair kv;
+        while (sc.next(kv)) {
+            total += kv.key_length + kv.value_length;
+        }
+        bench::do_not_optimize(total);
+    }
+}};
+
+const bench::registrar scan_decode{"kv_scanner/scan_decode", [](size_t n) {
+    std::string buf;
+    for (size_t i = 0; i < n; i++) {
+        size_t total = 0;
+        sl::utils::kv_scanner sc{query};
+        sl::utils::kv_pair kv;
+        while (sc.next(kv)) {
+            buf.clear();
+            kv.decode_value(buf);
+            total += kv.key_length + buf.length();
+        }
+        bench::do_not_optimize(total);
+    }
+}};
+
+} // namespace
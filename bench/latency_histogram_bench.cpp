@@ -0,0 +1,100 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   latency_histogram_bench.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 4:50 PM
+ */
+
+#include "bench.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "staticlib/utils/latency_histogram.hpp"
+
+namespace { // anonymous
+
+const size_t threads_count = 4;
+
+template<typename Fun>
+void run_threads(size_t n, Fun fun) {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threads_count; i++) {
+        threads.emplace_back([n, &fun] {
+            for (size_t j = 0; j < n / threads_count; j++) {
+                fun(j);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+const bench::registrar record{"latency_histogram/record", [](size_t n) {
+    sl::utils::latency_histogram hist{};
+    for (size_t i = 0; i < n; i++) {
+        hist.record(1000 + (i & 0xffff));
+    }
+    bench::do_not_optimize(hist.count());
+}};
+
+const bench::registrar record_threads{"latency_histogram/record_4_threads", [](size_t n) {
+    sl::utils::latency_histogram hist{};
+    run_threads(n, [&hist](size_t j) {
+        hist.record(1000 + (j & 0xffff));
+    });
+    bench::do_not_optimize(hist.count());
+}};
+
+// baseline: vector of samples protected with mutex, sorted on query
+const bench::registrar mutex_vector_threads{"latency_histogram/mutex_vector_4_threads", [](size_t n) {
+    std::mutex mtx;
+    std::vector<uint64_t> samples;
+    run_threads(n, [&mtx, &samples](size_t j) {
+        std::lock_guard<std::mutex> guard{mtx};
+        samples.push_back(1000 + (j & 0xffff));
+    });
+    bench::do_not_optimize(samples);
+}};
+
+const bench::registrar percentile{"latency_histogram/value_at_percentile", [](size_t n) {
+    sl::utils::latency_histogram hist{};
+    for (size_t i = 0; i < 100000; i++) {
+        hist.record(1000 + i * 10);
+    }
+    for (size_t i = 0; i < n; i++) {
+        auto val = hist.value_at_percentile(99.0);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar serialize{"latency_histogram/serialize", [](size_t n) {
+    sl::utils::latency_histogram hist{};
+    for (size_t i = 0; i < 100000; i++) {
+        hist.record(1000 + i * 10);
+    }
+    for (size_t i = 0; i < n; i++) {
+        auto ser = hist.serialize();
+        bench::do_not_optimize(ser);
+    }
+}};
+
+} // namespace
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   named_mutex_bench.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 12:20 PM
+ */
+
+#include "bench.hpp"
+
+#include "staticlib/config.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <cstdlib>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "staticlib/utils/named_mutex.hpp"
+
+namespace { // anonymous
+
+const std::string mutex_name = "staticlib_utils_bench_" + sl::support::to_string(::getpid());
+
+const bench::registrar lock_unlock{"named_mutex/lock_unlock", [](size_t n) {
+    sl::utils::named_mutex mx{mutex_name};
+    for (size_t i = 0; i < n; i++) {
+        mx.lock();
+        mx.unlock();
+    }
+    ::shm_unlink(("/staticlib_named_mutex_" + mutex_name).c_str());
+}};
+
+const bench::registrar try_lock_unlock{"named_mutex/try_lock_unlock", [](size_t n) {
+    sl::utils::named_mutex mx{mutex_name};
+    for (size_t i = 0; i < n; i++) {
+        bool locked = mx.try_lock();
+        bench::do_not_optimize(locked);
+        mx.unlock();
+    }
+    ::shm_unlink(("/staticlib_named_mutex_" + mutex_name).c_str());
+}};
+
+// baseline: lock file that was used for single-instance checks on Linux
+const bench::registrar flock_unlock{"named_mutex/flock_baseline", [](size_t n) {
+    std::string path = "/tmp/" + mutex_name + ".lock";
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (-1 == fd) std::abort();
+    for (size_t i = 0; i < n; i++) {
+        ::flock(fd, LOCK_EX);
+        ::flock(fd, LOCK_UN);
+    }
+    ::close(fd);
+    ::unlink(path.c_str());
+}};
+
+} // namespace
+
+#endif // STATICLIB_LINUX
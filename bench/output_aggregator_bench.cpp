@@ -0,0 +1,140 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   output_aggregator_bench.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 3:30 PM
+ */
+
+#include "bench.hpp"
+
+#include "staticlib/config.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/utils/output_aggregator.hpp"
+
+namespace { // anonymous
+
+const size_t block_size = 64 * 1024;
+
+const size_t sources_count = 4;
+
+void write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        auto written = ::write(fd, data, len);
+        if (written <= 0) std::abort();
+        data += written;
+        len -= static_cast<size_t> (written);
+    }
+}
+
+// target is a temporary file, so the measured work includes the page cache writes
+struct temp_file {
+    FILE* file;
+
+    temp_file() :
+    file(std::tmpfile()) {
+        if (nullptr == file) std::abort();
+    }
+
+    ~temp_file() {
+        std::fclose(file);
+    }
+
+    int fd() {
+        return ::fileno(file);
+    }
+};
+
+// children write into pipes, single thread splices pipes into the target
+const bench::registrar splice_sources{"output_aggregator/splice_4_sources", [](size_t n) {
+    static const std::string block(block_size, 'a');
+    temp_file target;
+    sl::utils::output_aggregator agg{target.fd()};
+    std::vector<int> fds;
+    for (size_t i = 0; i < sources_count; i++) {
+        fds.push_back(agg.add_source("[child " + std::to_string(i) + "] "));
+    }
+    for (size_t i = 0; i < n; i++) {
+        write_all(fds[i % sources_count], block.data(), block.length());
+    }
+    for (int fd : fds) {
+        ::close(fd);
+    }
+    agg.wait_drained();
+    bench::do_not_optimize(agg.stats().bytes);
+}, block_size};
+
+// previous approach: children write into files, tailer copies new data through the user space buffer
+const bench::registrar tail_files{"output_aggregator/tail_4_files", [](size_t n) {
+    static const std::string block(block_size, 'a');
+    temp_file target;
+    std::vector<std::unique_ptr<temp_file>> files;
+    for (size_t i = 0; i < sources_count; i++) {
+        files.emplace_back(new temp_file());
+    }
+    std::atomic<bool> done{false};
+    std::thread tailer([&files, &target, &done] {
+        std::vector<char> buf(block_size);
+        std::vector<off_t> offsets(sources_count, 0);
+        for (;;) {
+            // flag is read before the pass, so the last pass sees all the data
+            bool finished = done.load(std::memory_order_acquire);
+            size_t moved = 0;
+            for (size_t i = 0; i < sources_count; i++) {
+                auto count = ::pread(files[i]->fd(), buf.data(), buf.size(), offsets[i]);
+                if (count < 0) std::abort();
+                if (count > 0) {
+                    std::string prefix = "[child " + std::to_string(i) + "] ";
+                    write_all(target.fd(), prefix.data(), prefix.length());
+                    write_all(target.fd(), buf.data(), static_cast<size_t> (count));
+                    offsets[i] += count;
+                    moved += static_cast<size_t> (count);
+                }
+            }
+            if (0 == moved) {
+                if (finished) {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    });
+    for (size_t i = 0; i < n; i++) {
+        write_all(files[i % sources_count]->fd(), block.data(), block.length());
+    }
+    done.store(true, std::memory_order_release);
+    tailer.join();
+}, block_size};
+
+} // namespace
+
+#endif // STATICLIB_LINUX
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_float_bench.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 5:40 PM
+ */
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "staticlib/utils/parse_float.hpp"
+
+namespace { // anonymous
+
+const size_t dataset_size = 4096;
+
+std::vector<std::string> gen_dataset(const char* format, double min, double max, bool random_bits) {
+    std::mt19937_64 engine{42};
+    std::uniform_real_distribution<double> dist{min, max};
+    std::vector<std::string> res;
+    char buf[64];
+    while (res.size() < dataset_size) {
+        double val = dist(engine);
+        if (random_bits) {
+            uint64_t bits = engine();
+            std::memcpy(&val, &bits, sizeof(val));
+            if (val != val || val - val != 0) {
+                continue;
+            }
+        }
+        std::snprintf(buf, sizeof(buf), format, val);
+        res.emplace_back(buf);
+    }
+    return res;
+}
+
+size_t average_length(const std::vector<std::string>& data) {
+    size_t total = 0;
+    for (const std::string& st : data) {
+        total += st.length();
+    }
+    return total / data.size();
+}
+
+// geographic coordinates as in GeoJSON files
+const std::vector<std::string> coordinates = gen_dataset("%.15g", -180.0, 180.0, false);
+
+// money amounts and other short decimals
+const std::vector<std::string> prices = gen_dataset("%.2f", 0.0, 100000.0, false);
+
+// shortest round-trip representation is not available in C++11, full precision is used
+const std::vector<std::string> random_bits = gen_dataset("%.17g", 0.0, 0.0, true);
+
+template<typename Parse>
+bench::bench_fun parse_all(const std::vector<std::string>& data, Parse parse) {
+    return [&data, parse](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            const std::string& st = data[i % dataset_size];
+            bench::do_not_optimize(st);
+            auto val = parse(st);
+            bench::do_not_optimize(val);
+        }
+    };
+}
+
+double parse_double(const std::string& st) {
+    return sl::utils::parse_double(st.data(), st.data() + st.length()).value_or(0);
+}
+
+double parse_strtod(const std::string& st) {
+    return std::strtod(st.c_str(), nullptr);
+}
+
+double parse_stod(const std::string& st) {
+    return std::stod(st);
+}
+
+float parse_float(const std::string& st) {
+    return sl::utils::parse_float(st.data(), st.data() + st.length()).value_or(0);
+}
+
+float parse_strtof(const std::string& st) {
+    return std::strtof(st.c_str(), nullptr);
+}
+
+const bench::registrar coordinates_parse_double{"parse_float/coordinates/parse_double",
+        parse_all(coordinates, parse_double), average_length(coordinates)};
+
+const bench::registrar coordinates_strtod{"parse_float/coordinates/strtod",
+        parse_all(coordinates, parse_strtod), average_length(coordinates)};
+
+const bench::registrar coordinates_stod{"parse_float/coordinates/stod",
+        parse_all(coordinates, parse_stod), average_length(coordinates)};
+
+const bench::registrar coordinates_parse_float{"parse_float/coordinates/parse_float",
+        parse_all(coordinates, parse_float), average_length(coordinates)};
+
+const bench::registrar coordinates_strtof{"parse_float/coordinates/strtof",
+        parse_all(coordinates, parse_strtof), average_length(coordinates)};
+
+const bench::registrar prices_parse_double{"parse_float/prices/parse_double",
+        parse_all(prices, parse_double), average_length(prices)};
+
+const bench::registrar prices_strtod{"parse_float/prices/strtod",
+        parse_all(prices, parse_strtod), average_length(prices)};
+
+const bench::registrar random_parse_double{"parse_float/random_bits/parse_double",
+        parse_all(random_bits, parse_double), average_length(random_bits)};
+
+const bench::registrar random_strtod{"parse_float/random_bits/strtod",
+        parse_all(random_bits, parse_strtod), average_length(random_bits)};
+
+} // namespace
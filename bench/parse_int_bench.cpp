@@ -0,0 +1,164 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_int_bench.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 12:40 PM
+ */
+
+#include "bench.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <string>
+
+#include "staticlib/support.hpp"
+
+#include "staticlib/utils/parse_int.hpp"
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace { // anonymous
+
+const std::string valid_input = "1234567";
+
+const std::string invalid_input = "1234567 is not a number";
+
+const std::string int16_input = "-12345";
+const std::string uint16_input = "65535";
+const std::string uint32_input = "4294967295";
+const std::string int64_input = "-9223372036854775807";
+const std::string uint64_input = "18446744073709551615";
+
+// error path as it was before lazy formatting, kept for comparison
+int32_t parse_int32_eager(const std::string& str) {
+    auto cstr = str.c_str();
+    char* endptr;
+    errno = 0;
+    auto l = strtol(cstr, &endptr, 0);
+    if (errno == ERANGE || cstr + str.length() != endptr) {
+        throw sl::utils::utils_exception(TRACEMSG("Cannot parse int32_t from string:[" + str + "]"));
+    }
+    if (l < INT_MIN || l > INT_MAX) {
+        throw sl::utils::utils_exception(TRACEMSG("Value overflow for int32_t from string:[" + str + "]"));
+    }
+    return static_cast<int32_t> (l);
+}
+
+const bench::registrar parse_valid{"parse_int/parse_int32_valid", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_int32(valid_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar try_parse_valid{"parse_int/try_parse_int32_valid", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto res = sl::utils::try_parse_int32(valid_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar parse_int16{"parse_int/parse_int16", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_int16(int16_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar parse_uint16{"parse_int/parse_uint16", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_uint16(uint16_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar parse_uint32{"parse_int/parse_uint32", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_uint32(uint32_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar parse_int64{"parse_int/parse_int64", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_int64(int64_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar parse_uint64{"parse_int/parse_uint64", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::parse_uint64(uint64_input);
+        bench::do_not_optimize(val);
+    }
+}};
+
+// decimal range parser, used for /proc fields
+const bench::registrar try_parse_uint64_decimal{"parse_int/try_parse_uint64_decimal", [](size_t n) {
+    const char* begin = uint64_input.data();
+    const char* end = begin + uint64_input.length();
+    for (size_t i = 0; i < n; i++) {
+        auto val = sl::utils::try_parse_uint64_decimal(begin, end);
+        bench::do_not_optimize(val);
+    }
+}};
+
+const bench::registrar throw_eager{"parse_int/error_throw_eager", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        try {
+            auto val = parse_int32_eager(invalid_input);
+            bench::do_not_optimize(val);
+        } catch (const sl::utils::utils_exception& e) {
+            bench::do_not_optimize(e);
+        }
+    }
+}};
+
+const bench::registrar throw_lazy{"parse_int/error_throw_lazy", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        try {
+            auto val = sl::utils::parse_int32(invalid_input);
+            bench::do_not_optimize(val);
+        } catch (const sl::utils::utils_exception& e) {
+            bench::do_not_optimize(e);
+        }
+    }
+}};
+
+// lazy exception with the message requested, as when it is logged
+const bench::registrar throw_lazy_what{"parse_int/error_throw_lazy_what", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        try {
+            auto val = sl::utils::parse_int32(invalid_input);
+            bench::do_not_optimize(val);
+        } catch (const sl::utils::utils_exception& e) {
+            const char* msg = e.what();
+            bench::do_not_optimize(msg);
+        }
+    }
+}};
+
+const bench::registrar error_code{"parse_int/error_try_parse", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto res = sl::utils::try_parse_int32(invalid_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+} // namespace
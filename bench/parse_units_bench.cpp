@@ -0,0 +1,91 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_units_bench.cpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 3:30 PM
+ */
+
+#include "bench.hpp"
+
+#include <cstdint>
+#include <string>
+
+#include "staticlib/utils/parse_int.hpp"
+#include "staticlib/utils/parse_units.hpp"
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+const std::string bytes_input = "4GiB";
+
+const std::string duration_input = "500ms";
+
+const std::string compound_duration_input = "1h30m15s";
+
+// typical hand-written parsing that was used before, for comparison
+uint64_t legacy_parse_bytes(const std::string& str) {
+    std::string trimmed = sl::utils::trim(str);
+    size_t pos = trimmed.find_first_not_of("0123456789");
+    uint64_t num = sl::utils::parse_uint64(trimmed.substr(0, pos));
+    std::string unit = std::string::npos != pos ? trimmed.substr(pos) : std::string();
+    if (unit.empty() || "B" == unit) {
+        return num;
+    } else if ("KiB" == unit) {
+        return num << 10;
+    } else if ("MiB" == unit) {
+        return num << 20;
+    } else if ("GiB" == unit) {
+        return num << 30;
+    }
+    return 0;
+}
+
+const bench::registrar parse_bytes{"parse_units/parse_bytes", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(bytes_input);
+        auto res = sl::utils::parse_bytes(bytes_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar legacy_bytes{"parse_units/legacy_parse_bytes", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(bytes_input);
+        auto res = legacy_parse_bytes(bytes_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar parse_duration{"parse_units/parse_duration", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(duration_input);
+        auto res = sl::utils::parse_duration(duration_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar parse_compound_duration{"parse_units/parse_duration_compound", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(compound_duration_input);
+        auto res = sl::utils::parse_duration(compound_duration_input);
+        bench::do_not_optimize(res);
+    }
+}};
+
+} // namespace
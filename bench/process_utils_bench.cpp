@@ -0,0 +1,120 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   process_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 3:05 PM
+ */
+
+#include "bench.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/process_utils.hpp"
+
+namespace { // anonymous
+
+#ifdef STATICLIB_WINDOWS
+const std::string true_executable = "c:/windows/system32/whoami.exe";
+const std::string null_out = "NUL";
+#else
+const std::string true_executable = "/bin/true";
+const std::string null_out = "/dev/null";
+#endif // STATICLIB_WINDOWS
+
+// spawn latency, including waiting for the child exit
+const bench::registrar exec_and_wait{"process_utils/exec_and_wait", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int code = sl::utils::exec_and_wait(true_executable, {}, null_out);
+        bench::do_not_optimize(code);
+    }
+}};
+
+// child environment and working directory are prepared per spawn, parent state is not mutated
+const bench::registrar exec_and_wait_options{"process_utils/exec_and_wait_env_overlay_cwd", [](size_t n) {
+    sl::utils::spawn_options opts;
+    opts.env_mode = sl::utils::spawn_env_mode::overlay;
+    opts.env.emplace_back("STATICLIB_BENCH_VAR", "42");
+#ifdef STATICLIB_WINDOWS
+    opts.cwd = "c:/windows";
+#else
+    opts.cwd = "/";
+#endif // STATICLIB_WINDOWS
+    for (size_t i = 0; i < n; i++) {
+        int code = sl::utils::exec_and_wait(true_executable, {}, null_out, opts);
+        bench::do_not_optimize(code);
+    }
+}};
+
+// failed spawn is reported by exec_async without waiting for the child
+const bench::registrar exec_missing{"process_utils/exec_async_missing_executable", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bool failed = false;
+        try {
+            sl::utils::exec_async("/nonexistent/executable", {}, null_out);
+        } catch (const sl::utils::utils_exception&) {
+            failed = true;
+        }
+        bench::do_not_optimize(failed);
+    }
+}};
+
+const bench::registrar shell_exec_and_wait{"process_utils/shell_exec_and_wait", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int code = sl::utils::shell_exec_and_wait("exit 0");
+        bench::do_not_optimize(code);
+    }
+}};
+
+const bench::registrar current_executable_path{"process_utils/current_executable_path", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto st = sl::utils::current_executable_path();
+        bench::do_not_optimize(st);
+    }
+}};
+
+#ifdef STATICLIB_LINUX
+// sampling cost for the health endpoint, must not allocate
+const bench::registrar current_process_stats{"process_utils/current_process_stats", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto st = sl::utils::current_process_stats();
+        bench::do_not_optimize(st);
+    }
+}};
+
+// std::ifstream based reading of the same files, kept for comparison
+const bench::registrar ifstream_process_stats{"process_utils/ifstream_process_stats", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        std::ifstream stat{"/proc/self/stat"};
+        std::string stat_line;
+        std::getline(stat, stat_line);
+        std::ifstream statm{"/proc/self/statm"};
+        uint64_t size = 0;
+        uint64_t resident = 0;
+        statm >> size >> resident;
+        bench::do_not_optimize(stat_line);
+        bench::do_not_optimize(resident);
+    }
+}};
+#endif // STATICLIB_LINUX
+
+} // namespace
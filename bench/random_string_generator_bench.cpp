@@ -0,0 +1,68 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   random_string_generator_bench.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 2:50 PM
+ */
+
+#include "bench.hpp"
+
+#include <memory>
+#include <string>
+
+#include "staticlib/utils/random_string_generator.hpp"
+
+namespace { // anonymous
+
+const bench::sized_registrar generate{"random_string_generator/generate", [](size_t size) -> bench::bench_fun {
+    auto gen = std::make_shared<sl::utils::random_string_generator>();
+    return [gen, size](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = gen->generate(static_cast<uint32_t> (size));
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar generate_inplace{"random_string_generator/generate_inplace",
+        [](size_t size) -> bench::bench_fun {
+    auto gen = std::make_shared<sl::utils::random_string_generator>();
+    std::string st(size, ' ');
+    return [gen, st](size_t n) mutable {
+        for (size_t i = 0; i < n; i++) {
+            gen->generate(st);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar generate_inline{"random_string_generator/generate_inline", {16, 48, 256},
+        [](size_t size) -> bench::bench_fun {
+    auto gen = std::make_shared<sl::utils::random_string_generator>();
+    return [gen, size](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            sl::utils::inline_string st;
+            st.resize(size);
+            gen->generate(st);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+} // namespace
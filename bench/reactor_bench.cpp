@@ -0,0 +1,82 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   reactor_bench.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 4:10 PM
+ */
+
+#include "bench.hpp"
+
+#include "staticlib/config.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <chrono>
+#include <cstdlib>
+
+#include "staticlib/utils/reactor.hpp"
+
+namespace { // anonymous
+
+const size_t batch_size = 64;
+
+// eventfd write, epoll_wait and eventfd read for every task
+const bench::registrar post_run_once{"reactor/post_run_once", [](size_t n) {
+    sl::utils::reactor re;
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        re.post([&count] {
+            count += 1;
+        });
+        re.run_once(std::chrono::milliseconds(0));
+    }
+    if (n != count) std::abort();
+}};
+
+// wakeups are coalesced, tasks are dispatched in batches
+const bench::registrar post_batch{"reactor/post_batch_64", [](size_t n) {
+    sl::utils::reactor re;
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        re.post([&count] {
+            count += 1;
+        });
+        if (batch_size - 1 == i % batch_size || n - 1 == i) {
+            re.run_once(std::chrono::milliseconds(0));
+        }
+    }
+    if (n != count) std::abort();
+}};
+
+// periodic timer that is always expired, measures timerfd dispatch
+const bench::registrar timer_dispatch{"reactor/timer_dispatch", [](size_t n) {
+    sl::utils::reactor re;
+    size_t count = 0;
+    re.add_timer(std::chrono::nanoseconds(1), [&count] {
+        count += 1;
+    });
+    while (count < n) {
+        re.run_once(std::chrono::milliseconds(-1));
+    }
+}};
+
+} // namespace
+
+#endif // STATICLIB_LINUX
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   shm_ring_bench.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 4:20 PM
+ */
+
+#include "bench.hpp"
+
+#include "staticlib/config.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/utils/shm_ring.hpp"
+
+namespace { // anonymous
+
+const size_t message_size = 4096;
+
+const std::chrono::milliseconds timeout{10000};
+
+struct pipe_pair {
+    int fds[2];
+
+    pipe_pair() {
+        if (0 != ::pipe(fds)) std::abort();
+    }
+
+    ~pipe_pair() {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+};
+
+void pipe_write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        auto written = ::write(fd, data, len);
+        if (written <= 0) std::abort();
+        data += written;
+        len -= static_cast<size_t> (written);
+    }
+}
+
+void pipe_read_all(int fd, char* buf, size_t len) {
+    while (len > 0) {
+        auto count = ::read(fd, buf, len);
+        if (count <= 0) std::abort();
+        buf += count;
+        len -= static_cast<size_t> (count);
+    }
+}
+
+void ring_read_all(sl::utils::shm_ring& ring, char* buf, size_t len) {
+    while (len > 0) {
+        size_t count = ring.read(buf, len, timeout);
+        if (0 == count) std::abort();
+        buf += count;
+        len -= count;
+    }
+}
+
+// one op is a 4096 bytes message from writer thread to reader thread
+const bench::registrar ring_throughput{"shm_ring/throughput/4096", [](size_t n) {
+    sl::utils::shm_ring ring{256 * 1024};
+    sl::utils::shm_ring reader{ring.handle()};
+    std::thread th([&ring, n] {
+        std::vector<char> msg(message_size, 'x');
+        for (size_t i = 0; i < n; i++) {
+            ring.write(msg.data(), msg.size(), timeout);
+        }
+    });
+    std::vector<char> buf(message_size);
+    for (size_t i = 0; i < n; i++) {
+        ring_read_all(reader, buf.data(), buf.size());
+    }
+    th.join();
+}, message_size};
+
+const bench::registrar pipe_throughput{"shm_ring/pipe_baseline/throughput/4096", [](size_t n) {
+    pipe_pair pp;
+    std::thread th([&pp, n] {
+        std::vector<char> msg(message_size, 'x');
+        for (size_t i = 0; i < n; i++) {
+            pipe_write_all(pp.fds[1], msg.data(), msg.size());
+        }
+    });
+    std::vector<char> buf(message_size);
+    for (size_t i = 0; i < n; i++) {
+        pipe_read_all(pp.fds[0], buf.data(), buf.size());
+    }
+    th.join();
+}, message_size};
+
+// one op is a round trip of 8 bytes message
+const bench::registrar ring_latency{"shm_ring/round_trip/8", [](size_t n) {
+    sl::utils::shm_ring ping{};
+    sl::utils::shm_ring pong{};
+    sl::utils::shm_ring ping_reader{ping.handle()};
+    sl::utils::shm_ring pong_writer{pong.handle()};
+    std::thread th([&ping_reader, &pong_writer, n] {
+        char buf[8];
+        for (size_t i = 0; i < n; i++) {
+            ring_read_all(ping_reader, buf, sizeof(buf));
+            pong_writer.write(buf, sizeof(buf), timeout);
+        }
+    });
+    char buf[8] = {};
+    for (size_t i = 0; i < n; i++) {
+        ping.write(buf, sizeof(buf), timeout);
+        ring_read_all(pong, buf, sizeof(buf));
+    }
+    th.join();
+}};
+
+const bench::registrar pipe_latency{"shm_ring/pipe_baseline/round_trip/8", [](size_t n) {
+    pipe_pair ping;
+    pipe_pair pong;
+    std::thread th([&ping, &pong, n] {
+        char buf[8];
+        for (size_t i = 0; i < n; i++) {
+            pipe_read_all(ping.fds[0], buf, sizeof(buf));
+            pipe_write_all(pong.fds[1], buf, sizeof(buf));
+        }
+    });
+    char buf[8] = {};
+    for (size_t i = 0; i < n; i++) {
+        pipe_write_all(ping.fds[1], buf, sizeof(buf));
+        pipe_read_all(pong.fds[0], buf, sizeof(buf));
+    }
+    th.join();
+}};
+
+} // namespace
+
+#endif // STATICLIB_LINUX
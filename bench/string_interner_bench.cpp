@@ -0,0 +1,72 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_interner_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 2:25 PM
+ */
+
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+#include "staticlib/utils/string_interner.hpp"
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+const std::string headers = "Host:Accept:Accept-Encoding:Accept-Language:Cache-Control:"
+        "Connection:Content-Length:Content-Type:Cookie:User-Agent:X-Forwarded-For:X-Request-Id";
+
+const bench::registrar intern_existing{"string_interner/intern_existing", [](size_t n) {
+    sl::utils::string_interner si{};
+    auto keys = sl::utils::split(headers, ':');
+    for (auto& st : keys) {
+        si.intern(st);
+    }
+    for (size_t i = 0; i < n; i++) {
+        auto h = si.intern(keys[i % keys.size()]);
+        bench::do_not_optimize(h);
+    }
+}};
+
+const bench::registrar compare_ids{"string_interner/compare_ids", [](size_t n) {
+    sl::utils::string_interner si{};
+    auto keys = sl::utils::split(headers, ':');
+    std::vector<uint32_t> ids;
+    for (auto& st : keys) {
+        ids.push_back(si.intern(st).id);
+    }
+    uint32_t target = ids.back();
+    for (size_t i = 0; i < n; i++) {
+        bool eq = ids[i % ids.size()] == target;
+        bench::do_not_optimize(eq);
+    }
+}};
+
+const bench::registrar compare_iequals{"string_interner/compare_iequals", [](size_t n) {
+    auto keys = sl::utils::split(headers, ':');
+    const std::string& target = keys.back();
+    for (size_t i = 0; i < n; i++) {
+        bool eq = sl::utils::iequals(keys[i % keys.size()], target);
+        bench::do_not_optimize(eq);
+    }
+}};
+
+} // namespace
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 2:10 PM
+ */
+
+#include "bench.hpp"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+// words of 1-15 lower case letters separated with the specified delimiter
+std::string gen_text(size_t size, char delim) {
+    std::mt19937 engine{42};
+    std::string res;
+    while (res.length() < size) {
+        size_t word_len = 1 + engine() % 15;
+        for (size_t i = 0; i < word_len && res.length() < size; i++) {
+            res.push_back(static_cast<char> ('a' + engine() % 26));
+        }
+        if (res.length() < size) {
+            res.push_back(delim);
+        }
+    }
+    return res;
+}
+
+const bench::sized_registrar split{"string_utils/split", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, ':');
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto vec = sl::utils::split(input, ':');
+            bench::do_not_optimize(vec);
+        }
+    };
+}};
+
+// output vector is reused between calls, short parts are stored inline
+const bench::sized_registrar split_inline{"string_utils/split_inline", {16, 48, 256, 4096},
+        [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, ':');
+    auto vec = std::make_shared<std::vector<sl::utils::inline_string>>();
+    return [input, vec](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            sl::utils::split(input, ':', *vec);
+            bench::do_not_optimize(*vec);
+        }
+    };
+}};
+
+const bench::sized_registrar trim{"string_utils/trim", [](size_t size) -> bench::bench_fun {
+    std::string input = "   " + gen_text(size, ' ') + "   ";
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = sl::utils::trim(input);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar trim_inline{"string_utils/trim_inline", {16, 48, 256}, [](size_t size) -> bench::bench_fun {
+    std::string input = "   " + gen_text(size, ' ') + "   ";
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            sl::utils::inline_string st;
+            sl::utils::trim(input, st);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar replace_all{"string_utils/replace_all", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, ' ');
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            std::string st = input;
+            sl::utils::replace_all(st, " ", "%20");
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar iequals{"string_utils/iequals", [](size_t size) -> bench::bench_fun {
+    std::string lower = gen_text(size, '-');
+    std::string upper = lower;
+    for (char& ch : upper) {
+        if (ch >= 'a' && ch <= 'z') {
+            ch = static_cast<char> (ch - 'a' + 'A');
+        }
+    }
+    return [lower, upper](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            bool eq = sl::utils::iequals(lower, upper);
+            bench::do_not_optimize(eq);
+        }
+    };
+}};
+
+const bench::sized_registrar starts_ends_with{"string_utils/starts_ends_with", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, '/');
+    std::string start = input.substr(0, size / 2);
+    std::string ending = input.substr(size / 2);
+    return [input, start, ending](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            bool res = sl::utils::starts_with(input, start) && sl::utils::ends_with(input, ending);
+            bench::do_not_optimize(res);
+        }
+    };
+}};
+
+const bench::sized_registrar strip_filename{"string_utils/strip_filename", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, '/');
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = sl::utils::strip_filename(input);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar strip_parent_dir{"string_utils/strip_parent_dir", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, '/');
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = sl::utils::strip_parent_dir(input);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar strip_parent_dir_inline{"string_utils/strip_parent_dir_inline",
+        [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size, '/');
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            sl::utils::inline_string st;
+            sl::utils::strip_parent_dir(input, st);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+// call overhead on short inputs, compare builds with and without STATICLIB_UTILS_INLINE
+const bench::registrar starts_with_call{"string_utils/starts_with_call", [](size_t n) {
+    std::string input = "http://localhost:8080/";
+    std::string prefix = "http://";
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(input);
+        bool res = sl::utils::starts_with(input, prefix);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar ends_with_call{"string_utils/ends_with_call", [](size_t n) {
+    std::string input = "archive.tar.gz";
+    std::string ending = ".gz";
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(input);
+        bool res = sl::utils::ends_with(input, ending);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar iequals_call{"string_utils/iequals_call", [](size_t n) {
+    std::string lower = "content-type";
+    std::string upper = "Content-Type";
+    for (size_t i = 0; i < n; i++) {
+        bench::do_not_optimize(lower);
+        bool res = sl::utils::iequals(lower, upper);
+        bench::do_not_optimize(res);
+    }
+}};
+
+const bench::registrar empty_string_call{"string_utils/empty_string_call", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        const std::string& st = sl::utils::empty_string();
+        bench::do_not_optimize(st);
+    }
+}};
+
+} // namespace
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   url_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 2:35 PM
+ */
+
+#include "bench.hpp"
+
+#include <random>
+#include <string>
+
+#include "staticlib/utils/url_utils.hpp"
+
+namespace { // anonymous
+
+// printable ASCII, roughly one in four characters needs escaping
+std::string gen_text(size_t size) {
+    static const std::string charset = "abcdefghijklmnopqrstuvwxyz0123456789 &=/?%:";
+    std::mt19937 engine{42};
+    std::string res;
+    for (size_t i = 0; i < size; i++) {
+        res.push_back(charset[engine() % charset.length()]);
+    }
+    return res;
+}
+
+const bench::sized_registrar url_encode{"url_utils/url_encode", [](size_t size) -> bench::bench_fun {
+    std::string input = gen_text(size);
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = sl::utils::url_encode(input);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar url_decode{"url_utils/url_decode", [](size_t size) -> bench::bench_fun {
+    std::string input = sl::utils::url_encode(gen_text(size));
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto st = sl::utils::url_decode(input);
+            bench::do_not_optimize(st);
+        }
+    };
+}};
+
+const bench::sized_registrar url_decode_append{"url_utils/url_decode_append", [](size_t size) -> bench::bench_fun {
+    std::string input = sl::utils::url_encode(gen_text(size));
+    std::string out;
+    return [input, out](size_t n) mutable {
+        for (size_t i = 0; i < n; i++) {
+            out.clear();
+            sl::utils::url_decode(input.data(), input.length(), out);
+            bench::do_not_optimize(out);
+        }
+    };
+}};
+
+const bench::sized_registrar try_url_decode{"url_utils/try_url_decode", [](size_t size) -> bench::bench_fun {
+    std::string input = sl::utils::url_encode(gen_text(size));
+    return [input](size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            auto res = sl::utils::try_url_decode(input);
+            bench::do_not_optimize(res);
+        }
+    };
+}};
+
+} // namespace
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utf_utils_bench.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 3:55 PM
+ */
+
+#include "bench.hpp"
+
+#include <string>
+
+#include "staticlib/utils/utf_utils.hpp"
+
+namespace { // anonymous
+
+const size_t payload_size = 64 * 1024;
+
+const std::string& ascii_payload() {
+    static std::string data = [] {
+        std::string res;
+        for (size_t i = 0; i < payload_size; i++) {
+            res.push_back(static_cast<char> ('a' + i % 26));
+        }
+        return res;
+    }();
+    return data;
+}
+
+// mostly Cyrillic text with spaces
+const std::string& mixed_payload() {
+    static std::string data = [] {
+        std::string res;
+        while (res.length() < payload_size) {
+            res.append("\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 hello ");
+        }
+        return res;
+    }();
+    return data;
+}
+
+// CJK text with ASCII punctuation
+const std::string& cjk_payload() {
+    static std::string data = [] {
+        std::string res;
+        while (res.length() < payload_size) {
+            res.append("\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c, ");
+        }
+        return res;
+    }();
+    return data;
+}
+
+template<typename Payload>
+std::u16string to_utf16(Payload payload) {
+    std::u16string res;
+    sl::utils::utf8_to_utf16(payload().data(), payload().length(), res);
+    return res;
+}
+
+const bench::registrar validate_ascii{"utf_utils/utf8_validate/ascii/65536", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto res = sl::utils::utf8_validate(ascii_payload());
+        bench::do_not_optimize(res);
+    }
+}, payload_size};
+
+const bench::registrar validate_mixed{"utf_utils/utf8_validate/mixed/65536", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        auto res = sl::utils::utf8_validate(mixed_payload());
+        bench::do_not_optimize(res);
+    }
+}, payload_size};
+
+const bench::registrar validator_mixed{"utf_utils/utf8_validator/mixed/65536/4096", [](size_t n) {
+    const std::string& data = mixed_payload();
+    sl::utils::utf8_validator validator;
+    for (size_t i = 0; i < n; i++) {
+        validator.reset();
+        for (size_t pos = 0; pos < data.length(); pos += 4096) {
+            size_t chunk = data.length() - pos < 4096 ? data.length() - pos : 4096;
+            validator.update(data.data() + pos, chunk);
+        }
+        auto res = validator.finish();
+        bench::do_not_optimize(res);
+    }
+}, payload_size};
+
+const bench::registrar ascii_to_utf16{"utf_utils/utf8_to_utf16/ascii/65536", [](size_t n) {
+    std::u16string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf8_to_utf16(ascii_payload().data(), ascii_payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar mixed_to_utf16{"utf_utils/utf8_to_utf16/mixed/65536", [](size_t n) {
+    std::u16string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf8_to_utf16(mixed_payload().data(), mixed_payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar cjk_to_utf16{"utf_utils/utf8_to_utf16/cjk/65536", [](size_t n) {
+    std::u16string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf8_to_utf16(cjk_payload().data(), cjk_payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar ascii_from_utf16{"utf_utils/utf16_to_utf8/ascii/65536", [](size_t n) {
+    std::u16string src = to_utf16(ascii_payload);
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf16_to_utf8(src.data(), src.length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar mixed_from_utf16{"utf_utils/utf16_to_utf8/mixed/65536", [](size_t n) {
+    std::u16string src = to_utf16(mixed_payload);
+    std::string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf16_to_utf8(src.data(), src.length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar ascii_to_utf32{"utf_utils/utf8_to_utf32/ascii/65536", [](size_t n) {
+    std::u32string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf8_to_utf32(ascii_payload().data(), ascii_payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar mixed_to_utf32{"utf_utils/utf8_to_utf32/mixed/65536", [](size_t n) {
+    std::u32string out;
+    for (size_t i = 0; i < n; i++) {
+        out.clear();
+        sl::utils::utf8_to_utf32(mixed_payload().data(), mixed_payload().length(), out);
+        bench::do_not_optimize(out);
+    }
+}, payload_size};
+
+const bench::registrar ascii_widen{"utf_utils/widen_narrow/ascii/65536", [](size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        std::wstring wide = sl::utils::widen(ascii_payload());
+        std::string narrow = sl::utils::narrow(wide);
+        bench::do_not_optimize(narrow);
+    }
+}, payload_size};
+
+} // namespace
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   codec_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 12:45 PM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <string>
+
+#include "staticlib/utils/codec_utils.hpp"
+
+namespace { // anonymous
+
+int hex_value(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+// strict hex decoding, byte by byte
+bool reference_hex_decode(const std::string& str, std::string& out) {
+    if (0 != str.length() % 2) {
+        return false;
+    }
+    for (size_t i = 0; i < str.length(); i += 2) {
+        int high = hex_value(str[i]);
+        int low = hex_value(str[i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out.push_back(static_cast<char> ((high << 4) | low));
+    }
+    return true;
+}
+
+template<typename Fun>
+bool succeeds(Fun fun) {
+    try {
+        fun();
+        return true;
+    } catch (const sl::utils::utils_exception&) {
+        return false;
+    }
+}
+
+// decodes into the pre-filled string, output must be unchanged
+// on error and must only have the decoded bytes appended on success
+template<typename Fun>
+void check_appending_decode(Fun fun) {
+    const std::string prefix = "prefix";
+    std::string out = prefix;
+    if (succeeds([&] {
+        fun(out);
+    })) {
+        FUZZ_CHECK(out.length() >= prefix.length());
+        FUZZ_CHECK(0 == out.compare(0, prefix.length(), prefix));
+    } else {
+        FUZZ_CHECK(prefix.length() == out.length());
+        FUZZ_CHECK(prefix == out);
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    fuzz::input in{bytes, length};
+    const std::string& data = in.data;
+    auto variant = static_cast<sl::utils::base64_variant> (in.control % 3);
+
+    // encoders round trip on arbitrary bytes
+    FUZZ_CHECK(data == sl::utils::hex_decode(sl::utils::hex_encode(data, 0 != (in.control & 0x80))));
+    FUZZ_CHECK(data == sl::utils::base64_decode(sl::utils::base64_encode(data, variant), variant));
+
+    // strict hex decoder against the reference
+    std::string expected;
+    bool valid = reference_hex_decode(data, expected);
+    std::string decoded;
+    FUZZ_CHECK(valid == succeeds([&] {
+        decoded = sl::utils::hex_decode(data);
+    }));
+    if (valid) {
+        FUZZ_CHECK(expected == decoded);
+    }
+
+    // strict Base64 accepts only canonical input
+    std::string b64;
+    if (succeeds([&] {
+        b64 = sl::utils::base64_decode(data, variant);
+    })) {
+        FUZZ_CHECK(data == sl::utils::base64_encode(b64, variant));
+    }
+
+    // lenient decoders accept everything the strict ones accept
+    std::string lenient;
+    if (valid) {
+        FUZZ_CHECK(succeeds([&] {
+            lenient = sl::utils::hex_decode(data, sl::utils::decode_mode::lenient);
+        }));
+        FUZZ_CHECK(expected == lenient);
+    }
+
+    // failed decodes do not modify the output
+    const sl::utils::decode_mode modes[] = {sl::utils::decode_mode::strict, sl::utils::decode_mode::lenient};
+    for (auto mode : modes) {
+        check_appending_decode([&](std::string& out) {
+            sl::utils::hex_decode(data.data(), data.length(), out, mode);
+        });
+        check_appending_decode([&](std::string& out) {
+            sl::utils::base64_decode(data.data(), data.length(), out, variant, mode);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   fuzz_common.hpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 10:00 AM
+ */
+
+#ifndef STATICLIB_UTILS_FUZZ_COMMON_HPP
+#define STATICLIB_UTILS_FUZZ_COMMON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+/**
+ * Aborts the fuzzer run if the condition is false, divergence between
+ * the reference and the optimized implementations is reported this way
+ */
+#define FUZZ_CHECK(cond) \
+    if (!(cond)) { \
+        std::fprintf(stderr, "fuzz check failed: %s %s:%d\n", #cond, __FILE__, __LINE__); \
+        std::abort(); \
+    }
+
+namespace fuzz {
+
+/**
+ * Splits the fuzzer input into the leading control byte and the rest of the data,
+ * control byte is used to select parameters (delimiters, variants)
+ */
+struct input {
+    uint8_t control;
+    std::string data;
+
+    input(const uint8_t* bytes, size_t length) :
+    control(length > 0 ? bytes[0] : 0),
+    data(length > 0 ? reinterpret_cast<const char*> (bytes) + 1 : "", length > 0 ? length - 1 : 0) { }
+};
+
+} // namespace
+
+#endif /* STATICLIB_UTILS_FUZZ_COMMON_HPP */
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_float_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 6:15 PM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "staticlib/utils/parse_float.hpp"
+
+namespace { // anonymous
+
+// strtod also accepts leading whitespace, hex floats and "nan(chars)"
+bool strtod_only_syntax(const std::string& str) {
+    return str.empty() || std::isspace(static_cast<unsigned char> (str[0])) ||
+            std::string::npos != str.find_first_of("xX(");
+}
+
+template<typename T, typename Reference>
+void check(const std::string& str, const sl::utils::result<T>& actual, Reference reference) {
+    const char* cstr = str.c_str();
+    char* endptr = nullptr;
+    T expected = reference(cstr, &endptr);
+    bool consumed = cstr + str.length() == endptr;
+    if (actual.ok()) {
+        // glibc strtod is correctly rounded
+        FUZZ_CHECK(consumed);
+        T val = actual.value();
+        FUZZ_CHECK(std::isnan(val) == std::isnan(expected));
+        if (!std::isnan(val)) {
+            FUZZ_CHECK(0 == std::memcmp(&val, &expected, sizeof(val)));
+        }
+    } else if (sl::utils::error_code::out_of_range == actual.error()) {
+        FUZZ_CHECK(consumed);
+        FUZZ_CHECK(std::isinf(expected));
+    } else {
+        FUZZ_CHECK(!consumed || strtod_only_syntax(str));
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    std::string str{reinterpret_cast<const char*> (bytes), length};
+    check(str, sl::utils::parse_double(str), std::strtod);
+    check(str, sl::utils::parse_float(str), std::strtof);
+    return 0;
+}
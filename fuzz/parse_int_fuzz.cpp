@@ -0,0 +1,107 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_int_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 11:05 AM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include "staticlib/utils/parse_int.hpp"
+
+namespace { // anonymous
+
+// strtoll-based reference, same base detection and whitespace
+// handling as the original implementation
+template<typename T>
+sl::utils::result<T> reference_parse_signed(const std::string& str) {
+    const char* cstr = str.c_str();
+    char* endptr;
+    errno = 0;
+    long long val = std::strtoll(cstr, &endptr, 0);
+    if (ERANGE == errno || cstr + str.length() != endptr) {
+        return sl::utils::error_code::invalid_format;
+    }
+    if (val < static_cast<long long> (std::numeric_limits<T>::min()) ||
+            val > static_cast<long long> (std::numeric_limits<T>::max())) {
+        return sl::utils::error_code::out_of_range;
+    }
+    return static_cast<T> (val);
+}
+
+// unsigned 16 and 32 bit values are parsed as signed to reject negative input
+template<typename T>
+sl::utils::result<T> reference_parse_unsigned(const std::string& str) {
+    auto res = reference_parse_signed<long long>(str);
+    if (!res) {
+        return res.error();
+    }
+    if (res.value() < 0 || static_cast<unsigned long long> (res.value()) > std::numeric_limits<T>::max()) {
+        return sl::utils::error_code::out_of_range;
+    }
+    return static_cast<T> (res.value());
+}
+
+sl::utils::result<uint64_t> reference_parse_uint64(const std::string& str) {
+    const char* cstr = str.c_str();
+    char* endptr;
+    errno = 0;
+    unsigned long long val = std::strtoull(cstr, &endptr, 0);
+    if (ERANGE == errno || cstr + str.length() != endptr) {
+        return sl::utils::error_code::invalid_format;
+    }
+    return static_cast<uint64_t> (val);
+}
+
+template<typename T, typename Parse>
+void check(const std::string& str, const sl::utils::result<T>& expected,
+        const sl::utils::result<T>& actual, Parse parse) {
+    FUZZ_CHECK(expected.error() == actual.error());
+    if (expected.ok()) {
+        FUZZ_CHECK(expected.value() == actual.value());
+        FUZZ_CHECK(expected.value() == parse(str));
+    } else {
+        bool thrown = false;
+        try {
+            parse(str);
+        } catch (const sl::utils::utils_exception&) {
+            thrown = true;
+        }
+        FUZZ_CHECK(thrown);
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    std::string str{reinterpret_cast<const char*> (bytes), length};
+    check(str, reference_parse_signed<int16_t>(str), sl::utils::try_parse_int16(str), sl::utils::parse_int16);
+    check(str, reference_parse_unsigned<uint16_t>(str), sl::utils::try_parse_uint16(str), sl::utils::parse_uint16);
+    check(str, reference_parse_signed<int32_t>(str), sl::utils::try_parse_int32(str), sl::utils::parse_int32);
+    check(str, reference_parse_unsigned<uint32_t>(str), sl::utils::try_parse_uint32(str), sl::utils::parse_uint32);
+    check(str, reference_parse_signed<int64_t>(str), sl::utils::try_parse_int64(str), sl::utils::parse_int64);
+    check(str, reference_parse_uint64(str), sl::utils::try_parse_uint64(str), sl::utils::parse_uint64);
+    return 0;
+}
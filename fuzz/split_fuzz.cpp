@@ -0,0 +1,65 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   split_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 11:30 AM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+// getline-based splitting as it was implemented originally
+std::vector<std::string> reference_split(const std::string& str, char delim) {
+    std::stringstream ss{str};
+    std::vector<std::string> res;
+    std::string item;
+    while (std::getline(ss, item, delim)) {
+        if (!item.empty()) {
+            res.push_back(item);
+        }
+    }
+    return res;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    fuzz::input in{bytes, length};
+    char delim = static_cast<char> (in.control);
+    auto expected = reference_split(in.data, delim);
+
+    auto heap = sl::utils::split(in.data, delim);
+    FUZZ_CHECK(expected == heap);
+
+    sl::utils::arena ar{};
+    auto arena = sl::utils::split(in.data, delim, ar);
+    FUZZ_CHECK(expected.size() == arena.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        FUZZ_CHECK(0 == expected[i].compare(0, expected[i].length(), arena[i].data(), arena[i].length()));
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   standalone_main.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 10:15 AM
+ */
+
+// replays the specified corpus files and directories through the fuzz target,
+// used instead of libFuzzer when the compiler does not support it
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#ifdef STATICLIB_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif // STATICLIB_WINDOWS
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace { // anonymous
+
+std::vector<std::string> list_files(const std::string& path) {
+    std::vector<std::string> res;
+#ifdef STATICLIB_WINDOWS
+    WIN32_FIND_DATAA fd;
+    HANDLE ha = ::FindFirstFileA((path + "\\*").c_str(), &fd);
+    if (INVALID_HANDLE_VALUE == ha) {
+        res.push_back(path);
+        return res;
+    }
+    do {
+        if (0 == (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+            res.push_back(path + "\\" + fd.cFileName);
+        }
+    } while (::FindNextFileA(ha, &fd));
+    ::FindClose(ha);
+#else
+    struct stat st;
+    if (0 != ::stat(path.c_str(), &st) || !S_ISDIR(st.st_mode)) {
+        res.push_back(path);
+        return res;
+    }
+    DIR* dir = ::opendir(path.c_str());
+    if (nullptr == dir) {
+        return res;
+    }
+    while (struct dirent* en = ::readdir(dir)) {
+        std::string name = en->d_name;
+        if ("." != name && ".." != name) {
+            res.push_back(path + "/" + name);
+        }
+    }
+    ::closedir(dir);
+#endif // STATICLIB_WINDOWS
+    return res;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = 0;
+    for (int i = 1; i < argc; i++) {
+        for (const std::string& file : list_files(argv[i])) {
+            std::ifstream stream{file, std::ios::binary};
+            if (!stream.is_open()) {
+                std::cerr << "Cannot open input file: [" << file << "]" << std::endl;
+                return 1;
+            }
+            std::string data{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+            LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*> (data.data()), data.size());
+            count += 1;
+        }
+    }
+    std::cout << "Inputs executed: [" << count << "]" << std::endl;
+    return 0;
+}
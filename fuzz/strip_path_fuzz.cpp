@@ -0,0 +1,76 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   strip_path_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 11:50 AM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <string>
+
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+bool is_slash(char ch) {
+    return '/' == ch || '\\' == ch;
+}
+
+std::string reference_strip_filename(const std::string& path) {
+    size_t pos = path.length();
+    while (pos > 0 && !is_slash(path[pos - 1])) {
+        pos -= 1;
+    }
+    // no slashes or trailing slash
+    if (0 == pos || path.length() == pos) {
+        return path;
+    }
+    return path.substr(0, pos);
+}
+
+std::string reference_strip_parent_dir(const std::string& path) {
+    size_t end = path.length();
+    while (end > 0 && is_slash(path[end - 1])) {
+        end -= 1;
+    }
+    size_t pos = end;
+    while (pos > 0 && !is_slash(path[pos - 1])) {
+        pos -= 1;
+    }
+    if (0 == pos) {
+        return path;
+    }
+    return path.substr(pos);
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    std::string path{reinterpret_cast<const char*> (bytes), length};
+
+    std::string filename = sl::utils::strip_filename(path);
+    FUZZ_CHECK(reference_strip_filename(path) == filename);
+    FUZZ_CHECK(sl::utils::starts_with(path, filename));
+
+    std::string parent = sl::utils::strip_parent_dir(path);
+    FUZZ_CHECK(reference_strip_parent_dir(path) == parent);
+    FUZZ_CHECK(sl::utils::ends_with(path, parent));
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   url_decode_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 10:40 AM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <cstdlib>
+#include <string>
+
+#include "staticlib/utils/kv_scanner.hpp"
+#include "staticlib/utils/url_utils.hpp"
+
+namespace { // anonymous
+
+// lenient decoding as it was implemented originally
+std::string reference_decode(const std::string& str) {
+    std::string res;
+    for (size_t pos = 0; pos < str.length(); pos++) {
+        char ch = str[pos];
+        if ('+' == ch) {
+            res.push_back(' ');
+        } else if ('%' == ch && pos + 2 < str.length()) {
+            char buf[3] = {str[pos + 1], str[pos + 2], '\0'};
+            char decoded = static_cast<char> (std::strtol(buf, nullptr, 16));
+            if ('\0' == decoded) {
+                res.push_back('%');
+            } else {
+                res.push_back(decoded);
+                pos += 2;
+            }
+        } else {
+            res.push_back(ch);
+        }
+    }
+    return res;
+}
+
+bool is_hex(char ch) {
+    return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
+}
+
+// strict decoding succeeds only if every '%' starts a valid escape
+bool reference_strict_valid(const std::string& str) {
+    for (size_t pos = 0; pos < str.length(); pos++) {
+        if ('%' == str[pos]) {
+            if (pos + 2 >= str.length() || !is_hex(str[pos + 1]) || !is_hex(str[pos + 2])) {
+                return false;
+            }
+            pos += 2;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    fuzz::input in{bytes, length};
+    const std::string& data = in.data;
+
+    std::string expected = reference_decode(data);
+    FUZZ_CHECK(expected == sl::utils::url_decode(data));
+
+    std::string appended = "prefix";
+    sl::utils::url_decode(data.data(), data.length(), appended);
+    FUZZ_CHECK("prefix" + expected == appended);
+
+    auto strict = sl::utils::try_url_decode(data);
+    FUZZ_CHECK(strict.ok() == reference_strict_valid(data));
+    if (strict.ok()) {
+        // lenient decoding leaves "%00" as is
+        if (std::string::npos == data.find("%00")) {
+            FUZZ_CHECK(expected == strict.value());
+        }
+        FUZZ_CHECK(strict.value() == sl::utils::try_url_decode(sl::utils::url_encode(strict.value())).value());
+    } else {
+        FUZZ_CHECK(sl::utils::error_code::invalid_escape == strict.error());
+    }
+
+    // kv_scanner decodes values with url_decode
+    sl::utils::kv_scanner sc{data};
+    sl::utils::kv_pair kv;
+    while (sc.next(kv)) {
+        std::string raw = kv.raw_value();
+        FUZZ_CHECK(reference_decode(raw) == kv.decoded_value());
+        FUZZ_CHECK(reference_decode(kv.raw_key()) == kv.decoded_key());
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utf8_validate_fuzz.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 12:20 PM
+ */
+
+#include "fuzz_common.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "staticlib/utils/utf_utils.hpp"
+
+namespace { // anonymous
+
+// decodes each sequence by its bit pattern and checks the resulting code point range
+size_t reference_validate(const std::string& st) {
+    size_t i = 0;
+    while (i < st.length()) {
+        uint32_t lead = static_cast<unsigned char> (st[i]);
+        size_t len = 0;
+        uint32_t cp = 0;
+        uint32_t min = 0;
+        if (lead < 0x80) {
+            len = 1; cp = lead; min = 0;
+        } else if (0xc0 == (lead & 0xe0)) {
+            len = 2; cp = lead & 0x1f; min = 0x80;
+        } else if (0xe0 == (lead & 0xf0)) {
+            len = 3; cp = lead & 0x0f; min = 0x800;
+        } else if (0xf0 == (lead & 0xf8)) {
+            len = 4; cp = lead & 0x07; min = 0x10000;
+        } else {
+            return i;
+        }
+        if (i + len > st.length()) return i;
+        for (size_t j = 1; j < len; j++) {
+            uint32_t ch = static_cast<unsigned char> (st[i + j]);
+            if (0x80 != (ch & 0xc0)) return i;
+            cp = (cp << 6) | (ch & 0x3f);
+        }
+        if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) return i;
+        i += len;
+    }
+    return st.length();
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* bytes, size_t length) {
+    fuzz::input in{bytes, length};
+    const std::string& data = in.data;
+    size_t expected = reference_validate(data);
+    bool valid = data.length() == expected;
+
+    auto res = sl::utils::utf8_validate(data);
+    FUZZ_CHECK(valid == res.valid);
+    FUZZ_CHECK(expected == res.position);
+
+    // streaming validation with the chunk size taken from the control byte
+    size_t chunk = 1 + in.control;
+    sl::utils::utf8_validator validator{};
+    for (size_t pos = 0; pos < data.length(); pos += chunk) {
+        size_t len = std::min(chunk, data.length() - pos);
+        if (!validator.update(data.data() + pos, len)) {
+            break;
+        }
+    }
+    auto streamed = validator.finish();
+    FUZZ_CHECK(valid == streamed.valid);
+    FUZZ_CHECK(expected == streamed.position);
+
+    std::u16string u16;
+    auto res16 = sl::utils::utf8_to_utf16(data.data(), data.length(), u16);
+    FUZZ_CHECK(valid == res16.valid);
+    std::u32string u32;
+    auto res32 = sl::utils::utf8_to_utf32(data.data(), data.length(), u32);
+    FUZZ_CHECK(valid == res32.valid);
+    if (valid) {
+        std::string back16;
+        FUZZ_CHECK(sl::utils::utf16_to_utf8(u16.data(), u16.length(), back16).valid);
+        FUZZ_CHECK(data == back16);
+        std::string back32;
+        FUZZ_CHECK(sl::utils::utf32_to_utf8(u32.data(), u32.length(), back32).valid);
+        FUZZ_CHECK(data == back32);
+    } else {
+        FUZZ_CHECK(expected == res16.position);
+        FUZZ_CHECK(expected == res32.position);
+        FUZZ_CHECK(u16.empty());
+        FUZZ_CHECK(u32.empty());
+    }
+    return 0;
+}
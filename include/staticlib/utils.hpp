@@ -26,12 +26,31 @@
 
 #include "staticlib/config.hpp"
 
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/codec_utils.hpp"
+#include "staticlib/utils/cpu_features.hpp"
+#include "staticlib/utils/format.hpp"
+#include "staticlib/utils/hash_utils.hpp"
+#include "staticlib/utils/id_generator.hpp"
+#include "staticlib/utils/instrumentation.hpp"
+#include "staticlib/utils/kv_scanner.hpp"
+#include "staticlib/utils/latency_histogram.hpp"
+#include "staticlib/utils/named_mutex.hpp"
+#include "staticlib/utils/output_aggregator.hpp"
+#include "staticlib/utils/parse_float.hpp"
 #include "staticlib/utils/parse_int.hpp"
+#include "staticlib/utils/parse_units.hpp"
 #include "staticlib/utils/process_utils.hpp"
 #include "staticlib/utils/random_string_generator.hpp"
+#include "staticlib/utils/reactor.hpp"
+#include "staticlib/utils/result.hpp"
+#include "staticlib/utils/shm_ring.hpp"
 #include "staticlib/utils/signal_utils.hpp"
+#include "staticlib/utils/small_string.hpp"
+#include "staticlib/utils/string_interner.hpp"
 #include "staticlib/utils/string_utils.hpp"
 #include "staticlib/utils/url_utils.hpp"
+#include "staticlib/utils/utf_utils.hpp"
 #include "staticlib/utils/utils_exception.hpp"
 #ifdef STATICLIB_WINDOWS
 #include "staticlib/utils/windows.hpp"
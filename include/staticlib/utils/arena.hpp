@@ -0,0 +1,295 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   arena.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:12 AM
+ */
+
+#ifndef STATICLIB_UTILS_ARENA_HPP
+#define STATICLIB_UTILS_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Monotonic (bump) memory arena, memory is allocated from the chunks
+ * obtained from the global heap, chunk sizes grow geometrically.
+ * Individual allocations are never freed, all the memory is released
+ * at once with `reset` or on destruction. Not thread-safe.
+ */
+class arena {
+    struct chunk_header {
+        chunk_header* prev;
+        size_t size;
+    };
+
+    chunk_header* head;
+    char* cur;
+    char* end;
+    size_t next_chunk_size;
+    size_t used;
+    size_t chunks;
+
+public:
+    /**
+     * Default size of the first chunk
+     */
+    static const size_t default_chunk_size = 4096;
+
+    /**
+     * Upper limit for the geometric growth of the chunks sizes
+     */
+    static const size_t max_chunk_size = 1024 * 1024;
+
+    /**
+     * Default alignment of allocated blocks
+     */
+    static const size_t default_alignment = 2 * sizeof(void*);
+
+    /**
+     * Constructor, no memory is allocated until the first
+     * `allocate` call
+     *
+     * @param initial_chunk_size size of the first chunk
+     */
+    explicit arena(size_t initial_chunk_size = default_chunk_size);
+
+    /**
+     * Deleted copy constructor
+     */
+    arena(const arena&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    arena& operator=(const arena&) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    arena(arena&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    arena& operator=(arena&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Destructor, releases all chunks
+     */
+    ~arena() STATICLIB_NOEXCEPT;
+
+    /**
+     * Allocates a block of memory from the current chunk, new chunk
+     * is obtained from the global heap if current one is exhausted
+     *
+     * @param size number of bytes to allocate
+     * @param alignment alignment of the block, must be a power of 2
+     * @return pointer to allocated block, never null
+     * @throws std::bad_alloc if global heap is exhausted
+     */
+    void* allocate(size_t size, size_t alignment = default_alignment);
+
+    /**
+     * Invalidates all allocated blocks, the largest (last) chunk is kept
+     * for reuse, all other chunks are returned to the global heap
+     */
+    void reset() STATICLIB_NOEXCEPT;
+
+    /**
+     * Number of bytes handed out since construction or last `reset`
+     *
+     * @return number of bytes including alignment padding
+     */
+    size_t bytes_used() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Number of chunks currently owned by this arena
+     *
+     * @return number of chunks
+     */
+    size_t chunks_count() const STATICLIB_NOEXCEPT;
+
+private:
+    void add_chunk(size_t min_size);
+
+    void release_chunks(chunk_header* last) STATICLIB_NOEXCEPT;
+};
+
+/**
+ * STL allocator that takes memory from the specified arena,
+ * `deallocate` is a no-op
+ */
+template<typename T>
+class arena_allocator {
+    template<typename U> friend class arena_allocator;
+
+    arena* ar;
+
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<typename U>
+    struct rebind {
+        typedef arena_allocator<U> other;
+    };
+
+    /**
+     * Constructor
+     *
+     * @param ar arena to allocate from, must outlive this allocator
+     *        and all the containers that use it
+     */
+    explicit arena_allocator(arena& ar) STATICLIB_NOEXCEPT :
+    ar(std::addressof(ar)) { }
+
+    /**
+     * Converting constructor
+     *
+     * @param other allocator for other type
+     */
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) STATICLIB_NOEXCEPT :
+    ar(other.ar) { }
+
+    /**
+     * Allocates memory for the specified number of elements
+     *
+     * @param n number of elements
+     * @return pointer to uninitialized memory
+     */
+    T* allocate(size_t n, const void* = nullptr) {
+        if (n > max_size()) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*> (ar->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * No-op, memory is released with the arena
+     */
+    void deallocate(T*, size_t) STATICLIB_NOEXCEPT { }
+
+    /**
+     * Max number of elements that can be allocated at once
+     *
+     * @return max number of elements
+     */
+    size_t max_size() const STATICLIB_NOEXCEPT {
+        return std::numeric_limits<size_t>::max() / sizeof(T);
+    }
+
+    /**
+     * Address of the specified element
+     *
+     * @param ref element reference
+     * @return element address
+     */
+    T* address(T& ref) const STATICLIB_NOEXCEPT {
+        return std::addressof(ref);
+    }
+
+    /**
+     * Address of the specified element
+     *
+     * @param ref element reference
+     * @return element address
+     */
+    const T* address(const T& ref) const STATICLIB_NOEXCEPT {
+        return std::addressof(ref);
+    }
+
+    /**
+     * Constructs element in place
+     *
+     * @param ptr memory to construct element in
+     * @param args constructor arguments
+     */
+    template<typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        ::new (static_cast<void*> (ptr)) U(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroys element in place
+     *
+     * @param ptr element pointer
+     */
+    template<typename U>
+    void destroy(U* ptr) {
+        ptr->~U();
+    }
+
+    /**
+     * Accessor for the underlying arena
+     *
+     * @return arena reference
+     */
+    arena& get_arena() const STATICLIB_NOEXCEPT {
+        return *ar;
+    }
+
+    template<typename U>
+    bool operator==(const arena_allocator<U>& other) const STATICLIB_NOEXCEPT {
+        return ar == other.ar;
+    }
+
+    template<typename U>
+    bool operator!=(const arena_allocator<U>& other) const STATICLIB_NOEXCEPT {
+        return ar != other.ar;
+    }
+};
+
+/**
+ * String type that allocates from the arena
+ */
+typedef std::basic_string<char, std::char_traits<char>, arena_allocator<char>> arena_string;
+
+/**
+ * Vector of arena strings that allocates from the same arena
+ */
+typedef std::vector<arena_string, arena_allocator<arena_string>> arena_string_vector;
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_ARENA_HPP */
+
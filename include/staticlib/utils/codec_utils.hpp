@@ -0,0 +1,163 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   codec_utils.hpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 9:15 AM
+ */
+
+#ifndef STATICLIB_UTILS_CODEC_UTILS_HPP
+#define STATICLIB_UTILS_CODEC_UTILS_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Base64 alphabet and padding variants
+ */
+enum class base64_variant {
+    /**
+     * RFC 4648 section 4, '+' and '/', padded with '='
+     */
+    standard,
+    /**
+     * RFC 4648 section 5, '-' and '_', padded with '='
+     */
+    url,
+    /**
+     * RFC 4648 section 5, '-' and '_', without padding
+     */
+    url_unpadded
+};
+
+/**
+ * Input validation modes for decoders
+ */
+enum class decode_mode {
+    /**
+     * Only canonical input is accepted: no whitespace, alphabet and padding
+     * must match the variant exactly, Base64 trailing bits must be zero
+     */
+    strict,
+    /**
+     * ASCII whitespace is skipped, Base64 padding is optional, both Base64
+     * alphabets are accepted, Base64 trailing bits are ignored
+     */
+    lenient
+};
+
+/**
+ * Encodes bytes as hexadecimal string appending result to the specified string,
+ * uses SIMD instructions when available
+ * 
+ * @param data bytes to encode
+ * @param length number of bytes
+ * @param out string to append encoded data to
+ * @param upper_case whether to use upper case letters
+ */
+void hex_encode(const char* data, size_t length, std::string& out, bool upper_case = false);
+
+/**
+ * Encodes string as hexadecimal string
+ * 
+ * @param str string to encode
+ * @param upper_case whether to use upper case letters
+ * @return encoded string
+ */
+std::string hex_encode(const std::string& str, bool upper_case = false);
+
+/**
+ * Decodes hexadecimal string (both letter cases are accepted)
+ * appending result to the specified string
+ * 
+ * @param data hexadecimal characters
+ * @param length number of characters
+ * @param out string to append decoded bytes to
+ * @param mode input validation mode
+ * @throws utils_exception on invalid input
+ */
+void hex_decode(const char* data, size_t length, std::string& out, decode_mode mode = decode_mode::strict);
+
+/**
+ * Decodes hexadecimal string (both letter cases are accepted)
+ * 
+ * @param str hexadecimal string
+ * @param mode input validation mode
+ * @return decoded bytes
+ * @throws utils_exception on invalid input
+ */
+std::string hex_decode(const std::string& str, decode_mode mode = decode_mode::strict);
+
+/**
+ * Encodes bytes as Base64 appending result to the specified string,
+ * uses SIMD instructions when available
+ * 
+ * @param data bytes to encode
+ * @param length number of bytes
+ * @param out string to append encoded data to
+ * @param variant alphabet and padding variant
+ */
+void base64_encode(const char* data, size_t length, std::string& out,
+        base64_variant variant = base64_variant::standard);
+
+/**
+ * Encodes string as Base64
+ * 
+ * @param str string to encode
+ * @param variant alphabet and padding variant
+ * @return encoded string
+ */
+std::string base64_encode(const std::string& str, base64_variant variant = base64_variant::standard);
+
+/**
+ * Decodes Base64 appending result to the specified string,
+ * uses SIMD instructions when available
+ * 
+ * @param data Base64 characters
+ * @param length number of characters
+ * @param out string to append decoded bytes to
+ * @param variant alphabet and padding variant
+ * @param mode input validation mode
+ * @throws utils_exception on invalid input
+ */
+void base64_decode(const char* data, size_t length, std::string& out,
+        base64_variant variant = base64_variant::standard, decode_mode mode = decode_mode::strict);
+
+/**
+ * Decodes Base64 string
+ * 
+ * @param str Base64 string
+ * @param variant alphabet and padding variant
+ * @param mode input validation mode
+ * @return decoded bytes
+ * @throws utils_exception on invalid input
+ */
+std::string base64_decode(const std::string& str, base64_variant variant = base64_variant::standard,
+        decode_mode mode = decode_mode::strict);
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_CODEC_UTILS_HPP */
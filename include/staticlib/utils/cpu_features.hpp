@@ -0,0 +1,58 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   cpu_features.hpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 9:40 AM
+ */
+
+#ifndef STATICLIB_UTILS_CPU_FEATURES_HPP
+#define STATICLIB_UTILS_CPU_FEATURES_HPP
+
+#include "staticlib/config.hpp"
+
+// SIMD kernels use "__attribute__((target(...)))" and are compiled only with GCC 5+ and Clang
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define STATICLIB_UTILS_X86_SIMD
+#endif // x86 && (clang || gcc5+)
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Checks whether SSSE3 instructions can be used by the SIMD kernels
+ * of this library, always false on non-x86 platforms and compilers
+ * without support for per-function target attributes
+ * 
+ * @return true if SSSE3 kernels are enabled
+ */
+bool cpu_has_ssse3() STATICLIB_NOEXCEPT;
+
+/**
+ * Checks whether AVX2 instructions can be used by the SIMD kernels
+ * of this library, always false on non-x86 platforms and compilers
+ * without support for per-function target attributes
+ * 
+ * @return true if AVX2 kernels are enabled
+ */
+bool cpu_has_avx2() STATICLIB_NOEXCEPT;
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_CPU_FEATURES_HPP */
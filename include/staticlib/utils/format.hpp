@@ -0,0 +1,290 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   format.hpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 10:05 AM
+ */
+
+#ifndef STATICLIB_UTILS_FORMAT_HPP
+#define STATICLIB_UTILS_FORMAT_HPP
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "staticlib/config.hpp"
+
+/**
+ * Formats the message into `format_buffer`, first argument must be a string literal
+ * with `{}` placeholders, number of placeholders is checked against the number
+ * of the remaining arguments at compile time, see `format_arg` for supported types.
+ * 
+ * Example: `STATICLIB_UTILS_FORMAT("Error opening file: [{}], error: [{}]", path, sl::utils::errno_text(errno))`
+ */
+#define STATICLIB_UTILS_FORMAT(...) sl::utils::detail::format_checked< \
+        sl::utils::detail::count_placeholders(STATICLIB_UTILS_FORMAT_FIRST(__VA_ARGS__)) + 1 == \
+        sizeof(sl::utils::detail::args_counter(__VA_ARGS__))>(__VA_ARGS__)
+
+// standard C++11 requires at least one argument for "...", so dummy one is added
+#define STATICLIB_UTILS_FORMAT_FIRST(...) STATICLIB_UTILS_FORMAT_FIRST_HELPER(__VA_ARGS__, 0)
+#define STATICLIB_UTILS_FORMAT_FIRST_HELPER(first, ...) first
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Error code to be formatted as its text description (as returned by `strerror`)
+ */
+struct errno_text {
+    /**
+     * Error code
+     */
+    int code;
+
+    /**
+     * Constructor
+     * 
+     * @param code error code, usually `errno`
+     */
+    explicit errno_text(int code) :
+    code(code) { }
+};
+
+/**
+ * Character buffer for the formatted messages, short messages are written
+ * into the inline storage, memory is allocated only for the longer ones.
+ * Contents are always null-terminated.
+ */
+class format_buffer {
+public:
+    /**
+     * Size of the inline storage, including null terminator
+     */
+    static const size_t inline_capacity = 256;
+
+private:
+    char* buf;
+    size_t len;
+    size_t cap;
+    char inline_data[inline_capacity];
+
+public:
+    /**
+     * Constructor, creates empty buffer
+     */
+    format_buffer() STATICLIB_NOEXCEPT;
+
+    /**
+     * Copy constructor
+     * 
+     * @param other other instance
+     */
+    format_buffer(const format_buffer& other);
+
+    /**
+     * Copy assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    format_buffer& operator=(const format_buffer& other);
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    format_buffer(format_buffer&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    format_buffer& operator=(format_buffer&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Destructor
+     */
+    ~format_buffer() STATICLIB_NOEXCEPT;
+
+    /**
+     * Appends characters to the buffer
+     * 
+     * @param data characters to append
+     * @param length number of characters
+     * @throws std::bad_alloc if buffer cannot be grown
+     */
+    void append(const char* data, size_t length);
+
+    /**
+     * Null-terminated contents
+     * 
+     * @return pointer to contents
+     */
+    const char* c_str() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Contents length
+     * 
+     * @return number of characters, not including null terminator
+     */
+    size_t length() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Whether contents are stored in the inline storage
+     * 
+     * @return true if no memory was allocated
+     */
+    bool is_inline() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Copies contents into the string
+     * 
+     * @return string with contents
+     */
+    std::string str() const;
+
+private:
+    void grow(size_t min_capacity);
+};
+
+namespace detail {
+
+void format_signed(format_buffer& buf, long long val);
+
+void format_unsigned(format_buffer& buf, unsigned long long val);
+
+} // namespace
+
+/**
+ * Appends signed integer to the buffer
+ * 
+ * @param buf buffer
+ * @param val value
+ */
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+format_arg(format_buffer& buf, T val) {
+    detail::format_signed(buf, static_cast<long long> (val));
+}
+
+/**
+ * Appends unsigned integer to the buffer
+ * 
+ * @param buf buffer
+ * @param val value
+ */
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+format_arg(format_buffer& buf, T val) {
+    detail::format_unsigned(buf, static_cast<unsigned long long> (val));
+}
+
+/**
+ * Appends string to the buffer
+ * 
+ * @param buf buffer
+ * @param str null-terminated string, "null" is written for nullptr
+ */
+void format_arg(format_buffer& buf, const char* str);
+
+/**
+ * Appends string to the buffer
+ * 
+ * @param buf buffer
+ * @param str string
+ */
+void format_arg(format_buffer& buf, const std::string& str);
+
+/**
+ * Appends character to the buffer
+ * 
+ * @param buf buffer
+ * @param ch character
+ */
+void format_arg(format_buffer& buf, char ch);
+
+/**
+ * Appends "true" or "false" to the buffer
+ * 
+ * @param buf buffer
+ * @param val boolean value
+ */
+void format_arg(format_buffer& buf, bool val);
+
+/**
+ * Appends floating point value to the buffer using "%g" format
+ * 
+ * @param buf buffer
+ * @param val value
+ */
+void format_arg(format_buffer& buf, double val);
+
+/**
+ * Appends error description to the buffer, thread-safe unlike `strerror`
+ * 
+ * @param buf buffer
+ * @param err error code
+ */
+void format_arg(format_buffer& buf, errno_text err);
+
+namespace detail {
+
+const char* find_placeholder(const char* fmt) STATICLIB_NOEXCEPT;
+
+void append_tail(format_buffer& buf, const char* fmt);
+
+constexpr size_t count_placeholders(const char* fmt, size_t count = 0) {
+    return '\0' == fmt[0] ? count :
+            ('{' == fmt[0] && '}' == fmt[1]) ? count_placeholders(fmt + 2, count + 1) :
+            count_placeholders(fmt + 1, count);
+}
+
+// used only in unevaluated context, so arguments do not need to be constant expressions
+template<typename... Args>
+char (&args_counter(const Args&...))[sizeof...(Args)];
+
+inline void format_impl(format_buffer& buf, const char* fmt) {
+    append_tail(buf, fmt);
+}
+
+template<typename T, typename... Args>
+void format_impl(format_buffer& buf, const char* fmt, const T& arg, const Args&... args) {
+    const char* ph = find_placeholder(fmt);
+    buf.append(fmt, static_cast<size_t> (ph - fmt));
+    format_arg(buf, arg);
+    format_impl(buf, '\0' != *ph ? ph + 2 : ph, args...);
+}
+
+template<bool Valid, typename... Args>
+format_buffer format_checked(const char* fmt, const Args&... args) {
+    static_assert(Valid, "Number of '{}' placeholders in format string does not match the number of arguments");
+    format_buffer buf;
+    format_impl(buf, fmt, args...);
+    return buf;
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_FORMAT_HPP */
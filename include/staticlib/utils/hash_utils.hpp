@@ -0,0 +1,138 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   hash_utils.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:10 PM
+ */
+
+#ifndef STATICLIB_UTILS_HASH_UTILS_HPP
+#define STATICLIB_UTILS_HASH_UTILS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Fast non-cryptographic 64-bit hash (wyhash algorithm),
+ * must NOT be used where hash flooding resistance is required;
+ * seed has no default here, so `hash64("foo", 42)` selects the string
+ * overload with the seed instead of reading 42 bytes
+ * 
+ * @param data bytes to hash
+ * @param length number of bytes
+ * @param seed hash seed
+ * @return hash value
+ */
+uint64_t hash64(const char* data, size_t length, uint64_t seed) STATICLIB_NOEXCEPT;
+
+/**
+ * Fast non-cryptographic 64-bit hash (wyhash algorithm)
+ * 
+ * @param str string to hash
+ * @param seed hash seed
+ * @return hash value
+ */
+uint64_t hash64(const std::string& str, uint64_t seed = 0) STATICLIB_NOEXCEPT;
+
+/**
+ * Case insensitive variant of `hash64`, ASCII letters are hashed
+ * as lower case ones, strings that are equal according to `iequals`
+ * have equal hashes, does not support Unicode
+ * 
+ * @param data bytes to hash
+ * @param length number of bytes
+ * @param seed hash seed
+ * @return hash value
+ */
+uint64_t ihash64(const char* data, size_t length, uint64_t seed) STATICLIB_NOEXCEPT;
+
+/**
+ * Case insensitive variant of `hash64`, does not support Unicode
+ * 
+ * @param str string to hash
+ * @param seed hash seed
+ * @return hash value
+ */
+uint64_t ihash64(const std::string& str, uint64_t seed = 0) STATICLIB_NOEXCEPT;
+
+/**
+ * Streaming variant of `hash64` for the data that comes in chunks,
+ * digest does not depend on chunks boundaries and is equal to
+ * `hash64` of the concatenated input
+ */
+class hash64_stream {
+    uint64_t seed;
+    uint64_t see1;
+    uint64_t see2;
+    uint64_t total;
+    size_t pending;
+    bool bulk;
+    // 16 bytes of history followed by 48 bytes of pending data
+    unsigned char buf[64];
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param seed hash seed
+     */
+    explicit hash64_stream(uint64_t seed = 0) STATICLIB_NOEXCEPT;
+
+    /**
+     * Appends data chunk
+     * 
+     * @param data bytes to hash
+     * @param length number of bytes
+     * @return self instance
+     */
+    hash64_stream& update(const char* data, size_t length) STATICLIB_NOEXCEPT;
+
+    /**
+     * Appends data chunk
+     * 
+     * @param str string to hash
+     * @return self instance
+     */
+    hash64_stream& update(const std::string& str) STATICLIB_NOEXCEPT;
+
+    /**
+     * Computes hash of all the data appended so far,
+     * more data can be appended after this call
+     * 
+     * @return hash value
+     */
+    uint64_t digest() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Resets this instance to its initial state
+     * 
+     * @param seed hash seed
+     */
+    void reset(uint64_t seed = 0) STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_HASH_UTILS_HPP */
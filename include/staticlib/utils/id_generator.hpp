@@ -0,0 +1,190 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   id_generator.hpp
+ * Author: alex
+ *
+ * Created on October 27, 2026, 10:10 AM
+ */
+
+#ifndef STATICLIB_UTILS_ID_GENERATOR_HPP
+#define STATICLIB_UTILS_ID_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * UUID value, bytes are stored in the network (big-endian) order
+ */
+struct uuid {
+    /**
+     * Length of the canonical string form: `xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx`
+     */
+    static const size_t string_length = 36;
+
+    /**
+     * UUID bytes
+     */
+    uint8_t bytes[16];
+
+    /**
+     * Creates UUID from two 64-bit halves, version and variant bits are taken as is
+     * 
+     * @param high most significant half
+     * @param low least significant half
+     * @return UUID value
+     */
+    static uuid from_halves(uint64_t high, uint64_t low) STATICLIB_NOEXCEPT;
+
+    /**
+     * Version field value (4 for random UUIDs, 7 for time-ordered ones)
+     * 
+     * @return version number
+     */
+    int version() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Writes canonical lower-case string form into the specified buffer,
+     * NUL terminator is not written
+     * 
+     * @param out buffer of at least `uuid::string_length` chars
+     */
+    void format(char* out) const STATICLIB_NOEXCEPT;
+
+    /**
+     * Canonical lower-case string form
+     * 
+     * @return UUID string
+     */
+    std::string to_string() const;
+
+    bool operator==(const uuid& other) const STATICLIB_NOEXCEPT;
+
+    bool operator!=(const uuid& other) const STATICLIB_NOEXCEPT;
+
+    /**
+     * Byte-wise comparison, time-ordered UUIDs from the same generator compare
+     * in the order of generation
+     */
+    bool operator<(const uuid& other) const STATICLIB_NOEXCEPT;
+};
+
+/**
+ * Generator of RFC 9562 UUIDs, uses xoshiro256** PRNG seeded from `std::random_device`.
+ * Generated IDs are unique but predictable, they must not be used as secrets.
+ * Not thread-safe, use one instance per thread or `generate_uuid_*` functions
+ * that use thread-local instances.
+ */
+class id_generator {
+    uint64_t state[4];
+    uint64_t last_millis;
+    uint64_t v7_counter;
+    uint64_t instance_high;
+    uint64_t sequence;
+
+public:
+    /**
+     * Constructor, seeds the generator from `std::random_device`,
+     * each of 4 PRNG state words is drawn separately
+     */
+    id_generator();
+
+    /**
+     * Constructor for reproducible sequences (tests), time is still
+     * taken from the system clock for version 7 UUIDs
+     * 
+     * @param seed seed value
+     */
+    explicit id_generator(uint64_t seed) STATICLIB_NOEXCEPT;
+
+    /**
+     * Generates random (version 4) UUID
+     * 
+     * @return UUID with 122 random bits
+     */
+    uuid generate_v4() STATICLIB_NOEXCEPT;
+
+    /**
+     * Generates time-ordered (version 7) UUID, 48-bit Unix timestamp in milliseconds
+     * is followed by a 42-bit counter (RFC 9562 method 1), that is re-seeded with random
+     * value every millisecond, and 32 random bits. UUIDs from the same generator are strictly
+     * increasing even if the clock goes backwards.
+     * 
+     * @return UUID value
+     */
+    uuid generate_v7() STATICLIB_NOEXCEPT;
+
+    /**
+     * Generates sequential (version 8) UUID: 60 random bits chosen once per generator
+     * followed by 62-bit counter, does not use the PRNG or the clock on each call
+     * 
+     * @return UUID value
+     */
+    uuid generate_sequential() STATICLIB_NOEXCEPT;
+
+    /**
+     * Re-seeds the PRNG and the sequential prefix from `std::random_device`, ordering
+     * of version 7 UUIDs is preserved, should be called in the child after `fork`
+     * (thread-local generators are re-seeded automatically)
+     */
+    void reseed();
+
+    /**
+     * Next 64 bits from the PRNG
+     * 
+     * @return random value
+     */
+    uint64_t next_random() STATICLIB_NOEXCEPT;
+
+private:
+    void seed_random(uint64_t value) STATICLIB_NOEXCEPT;
+
+    void seed_sequence() STATICLIB_NOEXCEPT;
+};
+
+/**
+ * Generates random (version 4) UUID using thread-local generator
+ * 
+ * @return UUID value
+ */
+uuid generate_uuid_v4();
+
+/**
+ * Generates time-ordered (version 7) UUID using thread-local generator,
+ * UUIDs are strictly increasing within the thread
+ * 
+ * @return UUID value
+ */
+uuid generate_uuid_v7();
+
+/**
+ * Generates sequential (version 8) UUID using thread-local generator
+ * 
+ * @return UUID value
+ */
+uuid generate_uuid_sequential();
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_ID_GENERATOR_HPP */
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   instrumentation.hpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 9:40 AM
+ */
+
+#ifndef STATICLIB_UTILS_INSTRUMENTATION_HPP
+#define STATICLIB_UTILS_INSTRUMENTATION_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+/**
+ * Hot-path instrumentation of the library functions, enabled only when
+ * the library is built with STATICLIB_UTILS_INSTRUMENTATION defined
+ * (`-Dstaticlib_utils_ENABLE_INSTRUMENTATION=ON`), otherwise both macros
+ * expand to nothing and the instrumented code is not affected.
+ * 
+ * Usage: `STATICLIB_UTILS_INSTRUMENTED_FUNCTION(url_decode_stats, "url_decode");`
+ * at namespace scope, `STATICLIB_UTILS_INSTRUMENT(url_decode_stats, length);`
+ * at the beginning of the function body.
+ */
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+#define STATICLIB_UTILS_INSTRUMENTED_FUNCTION(var, name) \
+    const sl::utils::instrumented_function var{name}
+#define STATICLIB_UTILS_INSTRUMENT(var, bytes) \
+    sl::utils::instrumentation_scope var##_scope{var, static_cast<uint64_t> (bytes)}
+#else
+#define STATICLIB_UTILS_INSTRUMENTED_FUNCTION(var, name) \
+    static_assert(true, "instrumentation disabled")
+#define STATICLIB_UTILS_INSTRUMENT(var, bytes) \
+    static_cast<void> (0)
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Number of latency histogram buckets, bucket `i` counts calls that took
+ * from `2^i` to `2^(i+1)` nanoseconds, the last bucket counts all longer calls
+ */
+const size_t instrumentation_latency_buckets = 32;
+
+/**
+ * Max number of instrumented functions
+ */
+const size_t instrumentation_max_functions = 64;
+
+/**
+ * Aggregated counters of the single instrumented function
+ */
+struct function_stats {
+    std::string name;
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t total_ns;
+    std::array<uint64_t, instrumentation_latency_buckets> latency_histogram;
+};
+
+/**
+ * Static registration of the instrumented function, see
+ * STATICLIB_UTILS_INSTRUMENTED_FUNCTION
+ */
+class instrumented_function {
+    size_t idx;
+
+public:
+    /**
+     * Constructor, registers function in the global registry,
+     * functions with the same name share the counters
+     * 
+     * @param name function name, must have static storage duration
+     * @throws utils_exception if max number of functions is exceeded
+     */
+    explicit instrumented_function(const char* name);
+
+    /**
+     * Index of this function in the global registry
+     * 
+     * @return function index
+     */
+    size_t index() const STATICLIB_NOEXCEPT {
+        return idx;
+    }
+};
+
+/**
+ * Records a single call of the instrumented function into the counters
+ * of the current thread
+ * 
+ * @param fun instrumented function
+ * @param bytes number of bytes processed
+ * @param elapsed_ns call duration in nanoseconds
+ */
+void record_call(const instrumented_function& fun, uint64_t bytes, uint64_t elapsed_ns) STATICLIB_NOEXCEPT;
+
+/**
+ * Measures the lifetime of this object and records it as a call
+ * of the instrumented function, see STATICLIB_UTILS_INSTRUMENT
+ */
+class instrumentation_scope {
+    const instrumented_function& fun;
+    uint64_t bytes;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    /**
+     * Constructor, starts the measurement
+     * 
+     * @param fun instrumented function
+     * @param bytes number of bytes processed by this call
+     */
+    instrumentation_scope(const instrumented_function& fun, uint64_t bytes) STATICLIB_NOEXCEPT :
+    fun(fun),
+    bytes(bytes),
+    start(std::chrono::steady_clock::now()) { }
+
+    /**
+     * Deleted copy constructor
+     */
+    instrumentation_scope(const instrumentation_scope&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    instrumentation_scope& operator=(const instrumentation_scope&) = delete;
+
+    /**
+     * Destructor, records the call
+     */
+    ~instrumentation_scope() STATICLIB_NOEXCEPT {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        record_call(fun, bytes, static_cast<uint64_t> (ns));
+    }
+};
+
+/**
+ * Whether the library was built with instrumentation enabled
+ * 
+ * @return true if instrumentation is compiled in
+ */
+bool instrumentation_enabled() STATICLIB_NOEXCEPT;
+
+/**
+ * Snapshot of the counters of all registered functions aggregated
+ * over all threads (including exited ones), counters are not reset.
+ * Allocates memory and locks the registry mutex, must not be called
+ * from the signal handler, intended to be called from the signal
+ * listener thread or periodically.
+ * 
+ * @return counters for every registered function, in registration order
+ */
+std::vector<function_stats> dump_stats();
+
+/**
+ * Makes subsequent `dump_stats` calls to report only the calls
+ * recorded after this call
+ */
+void reset_stats();
+
+/**
+ * Formats counters snapshot as a human-readable table, one line
+ * per function with calls count, bytes, mean and approximate p50/p99 latencies
+ * 
+ * @param stats counters snapshot
+ * @return formatted table
+ */
+std::string format_stats(const std::vector<function_stats>& stats);
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_INSTRUMENTATION_HPP */
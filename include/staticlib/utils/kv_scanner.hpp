@@ -0,0 +1,163 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   kv_scanner.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:05 PM
+ */
+
+#ifndef STATICLIB_UTILS_KV_SCANNER_HPP
+#define STATICLIB_UTILS_KV_SCANNER_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Key-value pair that points into the scanned input,
+ * no data is copied or decoded until requested
+ */
+struct kv_pair {
+    /**
+     * Pointer to the raw (possibly URL-encoded) key
+     */
+    const char* key;
+
+    /**
+     * Raw key length in bytes
+     */
+    size_t key_length;
+
+    /**
+     * Pointer to the raw (possibly URL-encoded) value
+     */
+    const char* value;
+
+    /**
+     * Raw value length in bytes, zero if pair has no key-value separator
+     */
+    size_t value_length;
+
+    /**
+     * Whether raw key contains '%' or '+'
+     */
+    bool key_encoded;
+
+    /**
+     * Whether raw value contains '%' or '+'
+     */
+    bool value_encoded;
+
+    /**
+     * Copies raw key into a new string
+     *
+     * @return raw key
+     */
+    std::string raw_key() const;
+
+    /**
+     * Copies raw value into a new string
+     *
+     * @return raw value
+     */
+    std::string raw_value() const;
+
+    /**
+     * URL-decodes the key, decoding is skipped if key contains
+     * neither '%' nor '+'
+     *
+     * @return decoded key
+     */
+    std::string decoded_key() const;
+
+    /**
+     * URL-decodes the value, decoding is skipped if value contains
+     * neither '%' nor '+'
+     *
+     * @return decoded value
+     */
+    std::string decoded_value() const;
+
+    /**
+     * URL-decodes the value appending result to the specified string
+     *
+     * @param out string to append decoded value to
+     */
+    void decode_value(std::string& out) const;
+
+    /**
+     * Compares raw key with the specified string
+     *
+     * @param str string to compare
+     * @return true if raw key is equal to specified string
+     */
+    bool key_equals(const std::string& str) const STATICLIB_NOEXCEPT;
+};
+
+/**
+ * Single-pass scanner over "k1=v1&k2=v2" style input, separators
+ * are configurable ("k1=v1;k2=v2" config lines). Input is not copied
+ * and must outlive the scanner and all the pairs returned from it.
+ * Empty pairs are skipped, pair without key-value separator
+ * is returned with empty value.
+ */
+class kv_scanner {
+    const char* cur;
+    const char* end;
+    char pair_sep;
+    char kv_sep;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param data input bytes
+     * @param length number of bytes
+     * @param pair_separator separator between pairs
+     * @param kv_separator separator between key and value
+     */
+    kv_scanner(const char* data, size_t length, char pair_separator = '&',
+            char kv_separator = '=') STATICLIB_NOEXCEPT;
+
+    /**
+     * Constructor
+     *
+     * @param str input string, must outlive the scanner
+     * @param pair_separator separator between pairs
+     * @param kv_separator separator between key and value
+     */
+    kv_scanner(const std::string& str, char pair_separator = '&',
+            char kv_separator = '=') STATICLIB_NOEXCEPT;
+
+    /**
+     * Reads the next pair from input
+     *
+     * @param out pair to fill
+     * @return false if input is exhausted, true otherwise
+     */
+    bool next(kv_pair& out) STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_KV_SCANNER_HPP */
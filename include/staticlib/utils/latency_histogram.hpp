@@ -0,0 +1,239 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   latency_histogram.hpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 2:10 PM
+ */
+
+#ifndef STATICLIB_UTILS_LATENCY_HISTOGRAM_HPP
+#define STATICLIB_UTILS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Fixed-memory log-linear (HDR-style) histogram of non-negative integer
+ * values, intended for latencies in nanoseconds.
+ * 
+ * Values below `2^(precision_bits + 1)` are counted exactly, larger
+ * values are counted with relative error of at most `1/2^precision_bits`,
+ * values above `max_value` are counted as `max_value`.
+ * 
+ * Recording is lock-free: counts are kept in a number of shards, each
+ * thread increments the counters of its own shard with atomic relaxed
+ * additions. Queries aggregate all shards and may run concurrently
+ * with recording, such queries see a consistent per-bucket, but not
+ * necessary a global snapshot.
+ */
+class latency_histogram {
+    uint64_t max_val;
+    uint32_t precision;
+    size_t buckets;
+    size_t shard_stride;
+    size_t shards;
+    std::unique_ptr<char[]> storage;
+    // shards * shard_stride counters placed into the storage at the cache
+    // line boundary, each shard is: total count, total sum, then buckets
+    std::atomic<uint64_t>* counts;
+
+public:
+    /**
+     * Default max trackable value, one hour in nanoseconds
+     */
+    static const uint64_t default_max_value = 3600ull * 1000 * 1000 * 1000;
+
+    /**
+     * Default precision, relative error is below 1%
+     */
+    static const uint32_t default_precision_bits = 7;
+
+    /**
+     * Constructor
+     * 
+     * @param max_value max trackable value, larger values are clamped to it
+     * @param precision_bits number of significant bits, from 1 to 16
+     * @param shards_count number of shards, zero to use the number of CPUs
+     * @throws utils_exception on invalid parameters
+     */
+    explicit latency_histogram(uint64_t max_value = default_max_value,
+            uint32_t precision_bits = default_precision_bits, size_t shards_count = 0);
+
+    /**
+     * Deleted copy constructor
+     */
+    latency_histogram(const latency_histogram&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    latency_histogram& operator=(const latency_histogram&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    latency_histogram(latency_histogram&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    latency_histogram& operator=(latency_histogram&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Records specified value, thread-safe and lock-free
+     * 
+     * @param value value to record
+     * @param count number of times to record the value
+     */
+    void record(uint64_t value, uint64_t count = 1) STATICLIB_NOEXCEPT;
+
+    /**
+     * Records specified duration in nanoseconds, negative durations
+     * are recorded as zero
+     * 
+     * @param duration duration to record
+     */
+    template<typename Rep, typename Period>
+    void record_duration(std::chrono::duration<Rep, Period> duration) STATICLIB_NOEXCEPT {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        record(ns > 0 ? static_cast<uint64_t> (ns) : 0);
+    }
+
+    /**
+     * Total number of recorded values
+     * 
+     * @return values count
+     */
+    uint64_t count() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Mean of the recorded values, values are summed before
+     * bucketing, but after clamping to `max_value`
+     * 
+     * @return mean value, zero if histogram is empty
+     */
+    double mean() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Lowest recorded value, with the bucket precision
+     * 
+     * @return lowest value, zero if histogram is empty
+     */
+    uint64_t min() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Highest recorded value, with the bucket precision
+     * 
+     * @return highest value, zero if histogram is empty
+     */
+    uint64_t max() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Value at the specified percentile, the highest value that is
+     * equivalent (falls into the same bucket) to the value at the
+     * specified rank is returned
+     * 
+     * @param percentile percentile from 0 to 100
+     * @return value at percentile, zero if histogram is empty
+     */
+    uint64_t value_at_percentile(double percentile) const STATICLIB_NOEXCEPT;
+
+    /**
+     * Adds all the values recorded in other histogram to this one,
+     * other histogram must have the same `max_value` and `precision_bits`
+     * 
+     * @param other other histogram
+     * @throws utils_exception if histograms layouts differ
+     */
+    void merge(const latency_histogram& other);
+
+    /**
+     * Removes all recorded values, must not be called
+     * concurrently with `record`
+     */
+    void reset() STATICLIB_NOEXCEPT;
+
+    /**
+     * Serializes all recorded values into compact binary form,
+     * only non-empty buckets are written, shards are not preserved
+     * 
+     * @return serialized histogram
+     */
+    std::string serialize() const;
+
+    /**
+     * Restores histogram from the binary form created with `serialize`
+     * 
+     * @param data serialized histogram
+     * @param length data length
+     * @return histogram with a single shard
+     * @throws utils_exception on invalid input
+     */
+    static latency_histogram deserialize(const char* data, size_t length);
+
+    /**
+     * Max trackable value
+     * 
+     * @return max value
+     */
+    uint64_t max_value() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Number of significant bits
+     * 
+     * @return precision bits
+     */
+    uint32_t precision_bits() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Number of buckets in a single shard
+     * 
+     * @return buckets count
+     */
+    size_t buckets_count() const STATICLIB_NOEXCEPT;
+
+private:
+    size_t bucket_index(uint64_t value) const STATICLIB_NOEXCEPT;
+
+    uint64_t bucket_lowest(size_t index) const STATICLIB_NOEXCEPT;
+
+    uint64_t bucket_highest(size_t index) const STATICLIB_NOEXCEPT;
+
+    uint64_t bucket_total(size_t index) const STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_LATENCY_HISTOGRAM_HPP */
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   named_mutex.hpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 10:05 AM
+ */
+
+#ifndef STATICLIB_UTILS_NAMED_MUTEX_HPP
+#define STATICLIB_UTILS_NAMED_MUTEX_HPP
+
+#include <chrono>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+#if defined(STATICLIB_WINDOWS) || defined(STATICLIB_LINUX)
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * OS-global named mutex, implemented with the kernel mutex object on Windows
+ * and with a pair of robust process-shared pthread mutexes placed in the
+ * `shm_open` segment on Linux.
+ * 
+ * Instance that is created first (while no other instance with the same name
+ * exists) becomes an owner of the name, all the other instances are "taken".
+ * On Linux name ownership belongs to the thread that has created
+ * the instance, it is released automatically if the owning process dies.
+ * 
+ * On Linux segments are initialized under the `flock` on the segment
+ * descriptor, so the segment left uninitialized by the process that has
+ * crashed while creating it is initialized by the next instance. Segments
+ * are never removed (removing them would race with the concurrent openers),
+ * they live in `/dev/shm/staticlib_named_mutex_*` until reboot or until
+ * removed manually with `shm_unlink`.
+ */
+class named_mutex {
+    void* handle;
+    bool taken;
+    bool owner_died;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param name unique name for this mutex
+     * @throws utils_exception if OS mutex cannot be opened
+     */ 
+    named_mutex(const std::string& name);
+
+    /**
+     * Deleted copy constructor
+     */ 
+    named_mutex(const named_mutex&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */ 
+    named_mutex& operator=(const named_mutex&) = delete;
+   
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    named_mutex(named_mutex&& other);
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    named_mutex& operator=(named_mutex&& other);
+
+    /**
+     * Destructor, closes OS-global mutex
+     */ 
+    ~named_mutex() STATICLIB_NOEXCEPT; 
+
+    /**
+     * Checks whether mutex is already taken
+     *
+     * @return true if this mutex is already taken (possibly in another process),
+     *         false otherwise
+     */ 
+    bool already_taken() const;
+
+    /**
+     * Acquires the lock, blocks until it is released by the current owner,
+     * lock is not recursive on Linux
+     * 
+     * @throws utils_exception on OS error
+     */
+    void lock();
+
+    /**
+     * Acquires the lock if it is not held by anyone
+     * 
+     * @return true if lock was acquired, false otherwise
+     * @throws utils_exception on OS error
+     */
+    bool try_lock();
+
+    /**
+     * Acquires the lock waiting for it no longer than the specified timeout
+     * 
+     * @param timeout max time to wait
+     * @return true if lock was acquired, false on timeout
+     * @throws utils_exception on OS error
+     */
+    bool lock_for(std::chrono::milliseconds timeout);
+
+    /**
+     * Releases the lock acquired by this thread
+     * 
+     * @throws utils_exception on OS error
+     */
+    void unlock();
+
+    /**
+     * Checks whether the last acquisition of the lock took it over from
+     * the thread (or process) that has died while holding the lock,
+     * data protected by the lock may be inconsistent in this case
+     * 
+     * @return true if previous owner of the lock has died
+     */
+    bool previous_owner_died() const;
+};
+
+} // namespace
+}
+
+#endif // STATICLIB_WINDOWS || STATICLIB_LINUX
+
+#endif /* STATICLIB_UTILS_NAMED_MUTEX_HPP */
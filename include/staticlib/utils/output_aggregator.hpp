@@ -0,0 +1,194 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   output_aggregator.hpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 11:40 AM
+ */
+
+#ifndef STATICLIB_UTILS_OUTPUT_AGGREGATOR_HPP
+#define STATICLIB_UTILS_OUTPUT_AGGREGATOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/process_utils.hpp"
+#include "staticlib/utils/utils_exception.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <sys/types.h>
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Counters of the output aggregator
+ */
+struct output_aggregator_stats {
+    /**
+     * Number of bytes moved into the target, prefixes are not included
+     */
+    uint64_t bytes;
+
+    /**
+     * Number of chunks (each one preceded by a source prefix) moved into the target
+     */
+    uint64_t chunks;
+
+    /**
+     * Number of sources dropped because of the read or write errors
+     */
+    uint64_t errors;
+
+    /**
+     * Number of sources that have not reached EOF yet
+     */
+    size_t active_sources;
+};
+
+/**
+ * Collects the output of multiple child processes (or any other pipe writers)
+ * into a single target descriptor.
+ * 
+ * Each source is a pipe, single background thread waits for the readable pipes
+ * with `epoll` and moves the data into the target with `splice`, so the output
+ * is not copied into the user space. Target is written with `read`/`write` only
+ * if it does not support `splice` (for example, file opened with `O_APPEND`
+ * on older kernels).
+ * 
+ * All the data available in the pipe is moved as a single chunk, chunk is preceded
+ * with the prefix of its source; chunks from different sources are never interleaved,
+ * but a single line of the child output may be split between the chunks.
+ * 
+ * Target descriptor must be blocking, it is not closed by the aggregator.
+ */
+class output_aggregator {
+    struct source;
+
+    int target_fd;
+    int epoll_fd;
+    int wakeup_fd;
+    bool splice_supported;
+    // allocated upfront, worker thread must not allocate
+    std::vector<char> copy_buffer;
+    std::atomic<bool> stopping;
+    std::atomic<uint64_t> bytes_count;
+    std::atomic<uint64_t> chunks_count;
+    std::atomic<uint64_t> errors_count;
+    // errno of the failed `epoll_wait`, guarded by the mutex
+    int worker_error;
+    mutable std::mutex mutex;
+    std::condition_variable drained_cv;
+    std::vector<std::unique_ptr<source>> sources;
+    std::thread worker;
+
+public:
+    /**
+     * Constructor, starts the background thread
+     * 
+     * @param target_fd descriptor to write the collected output to
+     * @throws utils_exception if epoll or eventfd cannot be created
+     */
+    explicit output_aggregator(int target_fd);
+
+    /**
+     * Deleted copy constructor
+     */
+    output_aggregator(const output_aggregator&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    output_aggregator& operator=(const output_aggregator&) = delete;
+
+    /**
+     * Destructor, stops the background thread and closes the read ends of all
+     * the sources, data that was not yet moved into the target is discarded
+     */
+    ~output_aggregator() STATICLIB_NOEXCEPT;
+
+    /**
+     * Creates new source pipe, its read end is owned by the aggregator and is
+     * closed when all the write ends are closed and all the data is moved into the target
+     * 
+     * @param prefix data to write into the target before each chunk from this source,
+     *        may be empty
+     * @return write end of the pipe (with `FD_CLOEXEC` set), must be closed by the caller
+     * @throws utils_exception if pipe cannot be created or registered
+     *         or if the background thread has failed
+     */
+    int add_source(const std::string& prefix);
+
+    /**
+     * Starts the process with its stdout and stderr redirected into the new source,
+     * write end of the source pipe is closed in the parent
+     * 
+     * @param executable path to executable binary or script
+     * @param args list of arguments
+     * @param prefix data to write into the target before each chunk of the process output
+     * @param options child environment and working directory, `out_fd` is ignored
+     * @return child process pid
+     * @throws utils_exception if source cannot be created or process cannot be started
+     */
+    int exec_async(const std::string& executable, const std::vector<std::string>& args,
+            const std::string& prefix, spawn_options options = spawn_options());
+
+    /**
+     * Blocks until all the sources reach EOF and all their data is moved into the target
+     * 
+     * @throws utils_exception if the background thread has failed before
+     *         draining all the sources
+     */
+    void wait_drained();
+
+    /**
+     * Returns aggregator counters
+     * 
+     * @return counters snapshot
+     */
+    output_aggregator_stats stats() const;
+
+private:
+    void run() STATICLIB_NOEXCEPT;
+
+    bool transfer(source& src, uint32_t events) STATICLIB_NOEXCEPT;
+
+    ssize_t copy_chunk(int fd, size_t len) STATICLIB_NOEXCEPT;
+
+    bool write_target(const char* data, size_t len) STATICLIB_NOEXCEPT;
+
+    void remove_source(source* src) STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
+
+#endif /* STATICLIB_UTILS_OUTPUT_AGGREGATOR_HPP */
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_float.hpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 11:20 AM
+ */
+
+#ifndef STATICLIB_UTILS_PARSE_FLOAT_HPP
+#define STATICLIB_UTILS_PARSE_FLOAT_HPP
+
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/result.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Parses `double` from the specified range, does not allocate, does not throw
+ * and does not depend on the current locale. Accepted format is
+ * `[+-]digits[.digits][(e|E)[+-]digits]` (leading or trailing digits around
+ * the point may be omitted, but not both), `inf`, `infinity` and `nan`
+ * (case-insensitive, with optional sign). Whole range must be consumed.
+ * Result is correctly rounded (round-half-to-even), so the output of `%.17g`
+ * is parsed back to the same value. Values that are too small
+ * are rounded to subnormals or to signed zero.
+ * 
+ * @param begin start of the range
+ * @param end end of the range
+ * @return `double` value, `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value is too large for `double`
+ */
+result<double> parse_double(const char* begin, const char* end) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `double` from the specified string, see `parse_double(begin, end)`
+ * 
+ * @param str string containing exactly one `double` value
+ * @return `double` value or error code
+ */
+result<double> parse_double(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `float` from the specified range, format and rounding are the same
+ * as with `parse_double`, value is rounded directly to `float` (without
+ * double rounding through `double`)
+ * 
+ * @param begin start of the range
+ * @param end end of the range
+ * @return `float` value, `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value is too large for `float`
+ */
+result<float> parse_float(const char* begin, const char* end) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `float` from the specified string, see `parse_float(begin, end)`
+ * 
+ * @param str string containing exactly one `float` value
+ * @return `float` value or error code
+ */
+result<float> parse_float(const std::string& str) STATICLIB_NOEXCEPT;
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_PARSE_FLOAT_HPP */
@@ -27,6 +27,9 @@
 #include <cstdint>
 #include <string>
 
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/result.hpp"
 #include "staticlib/utils/utils_exception.hpp"
 
 // std::stoi is not available on Android in NDK 9
@@ -82,6 +85,72 @@ int64_t parse_int64(const std::string& str);
  */
 uint64_t parse_uint64(const std::string& str);
 
+/**
+ * Parses `int16_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `int16_t` value
+ * @return `int16_t` value or `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value does not fit into `int16_t`
+ */
+result<int16_t> try_parse_int16(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `uint16_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `uint16_t` value
+ * @return `uint16_t` value or `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value does not fit into `uint16_t`
+ */
+result<uint16_t> try_parse_uint16(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `int32_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `int32_t` value
+ * @return `int32_t` value or `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value does not fit into `int32_t`
+ */
+result<int32_t> try_parse_int32(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `uint32_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `uint32_t` value
+ * @return `uint32_t` value or `error_code::invalid_format` on parse error,
+ *         `error_code::out_of_range` if value does not fit into `uint32_t`
+ */
+result<uint32_t> try_parse_uint32(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `int64_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `int64_t` value
+ * @return `int64_t` value or `error_code::invalid_format` on parse error
+ */
+result<int64_t> try_parse_int64(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `uint64_t` from specified string using `strto*l`, does not throw
+ * 
+ * @param str string containing exactly one `uint64_t` value
+ * @return `uint64_t` value or `error_code::invalid_format` on parse error
+ */
+result<uint64_t> try_parse_uint64(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses `uint64_t` with base 10 from specified characters range without `strto*l`,
+ * does not allocate and does not require null-terminated input.
+ * Unlike `try_parse_uint64` it accepts only decimal digits (no `0x` or octal
+ * prefixes) and reports overflow as `out_of_range`, so it has a distinct name.
+ * 
+ * @param begin pointer to the first character
+ * @param end pointer past the last character
+ * @return `uint64_t` value or `error_code::invalid_format` if range is empty or contains
+ *         anything except decimal digits (including sign and whitespace),
+ *         `error_code::out_of_range` if value does not fit into `uint64_t`
+ */
+result<uint64_t> try_parse_uint64_decimal(const char* begin, const char* end) STATICLIB_NOEXCEPT;
+
 } // namespace
 }
 
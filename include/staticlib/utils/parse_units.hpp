@@ -0,0 +1,348 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_units.hpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 10:05 AM
+ */
+
+#ifndef STATICLIB_UTILS_PARSE_UNITS_HPP
+#define STATICLIB_UTILS_PARSE_UNITS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/result.hpp"
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Parses duration like `500ms`, `1.5s` or `1h30m` into nanoseconds, does not allocate.
+ * Input is a sequence of `number unit` terms (without spaces) with an optional leading sign,
+ * number is `digits[.digits]`, units are `ns`, `us` (`µs`), `ms`, `s`, `m` (`min`), `h` and `d`.
+ * Unit can be omitted only for `0`. Fractions of nanosecond are truncated.
+ * 
+ * @param begin start of the range
+ * @param end end of the range
+ * @return duration, `error_code::invalid_format` on parse error, `error_code::unknown_unit`
+ *         for unsupported unit, `error_code::out_of_range` if value does not fit into `int64_t` nanoseconds
+ */
+result<std::chrono::nanoseconds> parse_duration(const char* begin, const char* end) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses duration from the specified string, see `parse_duration(begin, end)`
+ * 
+ * @param str string containing exactly one duration
+ * @return duration or error code
+ */
+result<std::chrono::nanoseconds> parse_duration(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses byte size like `4096`, `4GiB` or `1.5k` into number of bytes, does not allocate.
+ * Input is `digits[.digits][unit]` (without spaces), units are `B`, decimal `k` (`K`), `M`, `G`,
+ * `T`, `P`, `E` and binary `Ki`, `Mi`, `Gi`, `Ti`, `Pi`, `Ei`, all of them with an optional `B` suffix.
+ * Fractional number of bytes (like `0.5B` or `0.0001k`) is rejected.
+ * 
+ * @param begin start of the range
+ * @param end end of the range
+ * @return number of bytes, `error_code::invalid_format` on parse error, `error_code::unknown_unit`
+ *         for unsupported unit, `error_code::out_of_range` if value does not fit into `uint64_t`
+ */
+result<uint64_t> parse_bytes(const char* begin, const char* end) STATICLIB_NOEXCEPT;
+
+/**
+ * Parses byte size from the specified string, see `parse_bytes(begin, end)`
+ * 
+ * @param str string containing exactly one byte size
+ * @return number of bytes or error code
+ */
+result<uint64_t> parse_bytes(const std::string& str) STATICLIB_NOEXCEPT;
+
+// parser is written as C++11 constexpr functions (one return statement, recursion
+// instead of loops) to be shared between runtime parsing and literals
+namespace detail {
+
+/**
+ * Max input length accepted by runtime functions, bounds the recursion depth
+ */
+const size_t units_max_input_length = 128;
+
+struct unit_entry {
+    const char* name;
+    size_t length;
+    uint64_t multiplier;
+};
+
+constexpr unit_entry duration_units[] = {
+    {"ns", 2, 1ULL},
+    {"us", 2, 1000ULL},
+    {"\xc2\xb5s", 3, 1000ULL},
+    {"ms", 2, 1000000ULL},
+    {"s", 1, 1000000000ULL},
+    {"m", 1, 60000000000ULL},
+    {"min", 3, 60000000000ULL},
+    {"h", 1, 3600000000000ULL},
+    {"d", 1, 86400000000000ULL}
+};
+
+constexpr unit_entry byte_units[] = {
+    {"", 0, 1ULL},
+    {"B", 1, 1ULL},
+    {"k", 1, 1000ULL},
+    {"kB", 2, 1000ULL},
+    {"K", 1, 1000ULL},
+    {"KB", 2, 1000ULL},
+    {"M", 1, 1000000ULL},
+    {"MB", 2, 1000000ULL},
+    {"G", 1, 1000000000ULL},
+    {"GB", 2, 1000000000ULL},
+    {"T", 1, 1000000000000ULL},
+    {"TB", 2, 1000000000000ULL},
+    {"P", 1, 1000000000000000ULL},
+    {"PB", 2, 1000000000000000ULL},
+    {"E", 1, 1000000000000000000ULL},
+    {"EB", 2, 1000000000000000000ULL},
+    {"Ki", 2, 1ULL << 10},
+    {"KiB", 3, 1ULL << 10},
+    {"Mi", 2, 1ULL << 20},
+    {"MiB", 3, 1ULL << 20},
+    {"Gi", 2, 1ULL << 30},
+    {"GiB", 3, 1ULL << 30},
+    {"Ti", 2, 1ULL << 40},
+    {"TiB", 3, 1ULL << 40},
+    {"Pi", 2, 1ULL << 50},
+    {"PiB", 3, 1ULL << 50},
+    {"Ei", 2, 1ULL << 60},
+    {"EiB", 3, 1ULL << 60}
+};
+
+struct units_result {
+    uint64_t value;
+    error_code code;
+    const char* next;
+};
+
+// floor(0.digits * multiplier) and whether it is exact
+struct units_fraction {
+    uint64_t value;
+    bool exact;
+};
+
+constexpr units_result units_error(error_code code) {
+    return units_result{0, code, nullptr};
+}
+
+constexpr bool units_is_digit(char ch) {
+    return ch >= '0' && ch <= '9';
+}
+
+constexpr uint64_t units_digit(char ch) {
+    return static_cast<uint64_t> (ch - '0');
+}
+
+constexpr bool units_mul_overflows(uint64_t a, uint64_t b) {
+    return 0 != a && b > std::numeric_limits<uint64_t>::max() / a;
+}
+
+constexpr bool units_add_overflows(uint64_t a, uint64_t b) {
+    return b > std::numeric_limits<uint64_t>::max() - a;
+}
+
+constexpr const char* units_skip_digits(const char* p, const char* end) {
+    return (p != end && units_is_digit(*p)) ? units_skip_digits(p + 1, end) : p;
+}
+
+constexpr const char* units_skip_unit(const char* p, const char* end) {
+    return (p != end && !units_is_digit(*p) && '.' != *p) ? units_skip_unit(p + 1, end) : p;
+}
+
+constexpr bool units_chars_equal(const char* a, const char* b, size_t len) {
+    return 0 == len || (*a == *b && units_chars_equal(a + 1, b + 1, len - 1));
+}
+
+// returns 0 if unit is not found
+constexpr uint64_t units_find_multiplier(const unit_entry* table, size_t count, const char* name, size_t len) {
+    return 0 == count ? 0 :
+            (table->length == len && units_chars_equal(table->name, name, len)) ? table->multiplier :
+            units_find_multiplier(table + 1, count - 1, name, len);
+}
+
+constexpr units_result units_parse_integer(const char* p, const char* end, uint64_t acc) {
+    return p == end ? units_result{acc, error_code::ok, end} :
+            acc > (std::numeric_limits<uint64_t>::max() - units_digit(*p)) / 10 ? units_error(error_code::out_of_range) :
+            units_parse_integer(p + 1, end, acc * 10 + units_digit(*p));
+}
+
+// digit * multiplier + tail < 10 * multiplier, fits for multipliers up to 2^60
+constexpr units_fraction units_add_fraction_digit(uint64_t scaled, units_fraction tail) {
+    return units_fraction{(scaled + tail.value) / 10, tail.exact && 0 == (scaled + tail.value) % 10};
+}
+
+constexpr units_fraction units_scale_fraction(const char* p, const char* end, uint64_t multiplier) {
+    return p == end ? units_fraction{0, true} :
+            units_add_fraction_digit(units_digit(*p) * multiplier, units_scale_fraction(p + 1, end, multiplier));
+}
+
+// missing unit is a format error
+constexpr units_result units_scale_term(units_result integer, units_fraction fraction, uint64_t multiplier,
+        bool require_exact, const char* unit_begin, const char* next) {
+    return error_code::ok != integer.code ? integer :
+            0 == multiplier ? units_error(unit_begin == next ? error_code::invalid_format : error_code::unknown_unit) :
+            (require_exact && !fraction.exact) ? units_error(error_code::invalid_format) :
+            units_mul_overflows(integer.value, multiplier) ? units_error(error_code::out_of_range) :
+            units_add_overflows(integer.value * multiplier, fraction.value) ? units_error(error_code::out_of_range) :
+            units_result{integer.value * multiplier + fraction.value, error_code::ok, next};
+}
+
+constexpr units_result units_parse_term_scaled(const char* int_begin, const char* int_end,
+        const char* frac_begin, const char* frac_end, uint64_t multiplier, bool require_exact, const char* next) {
+    return units_scale_term(units_parse_integer(int_begin, int_end, 0),
+            units_scale_fraction(frac_begin, frac_end, multiplier), multiplier, require_exact, frac_end, next);
+}
+
+constexpr units_result units_parse_term_unit(const char* int_begin, const char* int_end,
+        const char* frac_begin, const char* frac_end, const char* unit_end,
+        const unit_entry* table, size_t count, bool require_exact) {
+    return (int_begin == int_end && frac_begin == frac_end) ? units_error(error_code::invalid_format) :
+            units_parse_term_scaled(int_begin, int_end, frac_begin, frac_end,
+                    units_find_multiplier(table, count, frac_end, static_cast<size_t> (unit_end - frac_end)),
+                    require_exact, unit_end);
+}
+
+constexpr units_result units_parse_term_fraction(const char* int_begin, const char* int_end, const char* frac_end,
+        const char* end, const unit_entry* table, size_t count, bool require_exact) {
+    return units_parse_term_unit(int_begin, int_end, int_end + 1, frac_end, units_skip_unit(frac_end, end),
+            table, count, require_exact);
+}
+
+constexpr units_result units_parse_term(const char* begin, const char* int_end, const char* end,
+        const unit_entry* table, size_t count, bool require_exact) {
+    return (int_end != end && '.' == *int_end) ?
+            units_parse_term_fraction(begin, int_end, units_skip_digits(int_end + 1, end), end,
+                    table, count, require_exact) :
+            units_parse_term_unit(begin, int_end, int_end, int_end, units_skip_unit(int_end, end),
+                    table, count, require_exact);
+}
+
+constexpr units_result units_check_end(units_result res, const char* end) {
+    return (error_code::ok == res.code && res.next != end) ? units_error(error_code::invalid_format) : res;
+}
+
+constexpr units_result parse_bytes_constexpr(const char* begin, const char* end) {
+    return units_check_end(units_parse_term(begin, units_skip_digits(begin, end), end,
+            byte_units, sizeof(byte_units) / sizeof(byte_units[0]), true), end);
+}
+
+constexpr units_result units_sum_terms(const char* p, const char* end, uint64_t acc);
+
+constexpr units_result units_sum_next(units_result term, const char* end, uint64_t acc) {
+    return error_code::ok != term.code ? term :
+            units_add_overflows(acc, term.value) ? units_error(error_code::out_of_range) :
+            units_sum_terms(term.next, end, acc + term.value);
+}
+
+constexpr units_result units_sum_terms(const char* p, const char* end, uint64_t acc) {
+    return p == end ? units_result{acc, error_code::ok, end} :
+            units_sum_next(units_parse_term(p, units_skip_digits(p, end), end,
+                    duration_units, sizeof(duration_units) / sizeof(duration_units[0]), false), end, acc);
+}
+
+// magnitude in nanoseconds, range is checked separately
+constexpr units_result units_duration_magnitude(const char* begin, const char* end) {
+    return begin == end ? units_error(error_code::invalid_format) :
+            (1 == end - begin && '0' == *begin) ? units_result{0, error_code::ok, end} :
+            units_sum_terms(begin, end, 0);
+}
+
+constexpr units_result units_signed_duration(units_result magnitude, bool negative) {
+    return error_code::ok != magnitude.code ? magnitude :
+            magnitude.value > static_cast<uint64_t> (std::numeric_limits<int64_t>::max()) + (negative ? 1 : 0) ?
+                    units_error(error_code::out_of_range) :
+            magnitude;
+}
+
+constexpr bool units_has_sign(const char* begin, const char* end) {
+    return begin != end && ('-' == *begin || '+' == *begin);
+}
+
+// value holds the magnitude, negative sign is applied with `units_duration_value`
+constexpr units_result parse_duration_constexpr(const char* begin, const char* end) {
+    return units_signed_duration(units_duration_magnitude(units_has_sign(begin, end) ? begin + 1 : begin, end),
+            begin != end && '-' == *begin);
+}
+
+constexpr int64_t units_duration_value(uint64_t magnitude, bool negative) {
+    return !negative ? static_cast<int64_t> (magnitude) :
+            0 == magnitude ? 0 :
+            -static_cast<int64_t> (magnitude - 1) - 1;
+}
+
+constexpr uint64_t units_literal_value(units_result res, const char* str, size_t len) {
+    return error_code::ok == res.code ? res.value :
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid literal:", str, len);
+}
+
+} // namespace
+
+/**
+ * User-defined literals for constant byte sizes and durations, literals are parsed
+ * at compile time when used in constant expressions, invalid literal is a compile error then
+ * (and `utils_exception` at runtime otherwise):
+ * 
+ * `constexpr uint64_t limit = "4GiB"_bytes;`
+ * `constexpr std::chrono::nanoseconds timeout = "1m30s"_duration;`
+ */
+namespace literals {
+
+/**
+ * Byte size literal, see `parse_bytes`
+ * 
+ * @param str literal
+ * @param len literal length
+ * @return number of bytes
+ */
+constexpr uint64_t operator"" _bytes(const char* str, size_t len) {
+    return detail::units_literal_value(detail::parse_bytes_constexpr(str, str + len), str, len);
+}
+
+/**
+ * Duration literal, see `parse_duration`
+ * 
+ * @param str literal
+ * @param len literal length
+ * @return duration in nanoseconds
+ */
+constexpr std::chrono::nanoseconds operator"" _duration(const char* str, size_t len) {
+    return std::chrono::nanoseconds(detail::units_duration_value(
+            detail::units_literal_value(detail::parse_duration_constexpr(str, str + len), str, len),
+            0 != len && '-' == *str));
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_PARSE_UNITS_HPP */
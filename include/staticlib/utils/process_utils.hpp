@@ -24,14 +24,86 @@
 #ifndef STATICLIB_UTILS_PROCESS_UTILS_HPP
 #define STATICLIB_UTILS_PROCESS_UTILS_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "staticlib/config.hpp"
+
 #include "staticlib/utils/utils_exception.hpp"
 
 namespace staticlib {
 namespace utils {
 
+/**
+ * How `spawn_options::env` is applied to the child process environment
+ */
+enum class spawn_env_mode {
+    /**
+     * Child inherits parent environment, `env` entries are ignored
+     */
+    inherit,
+    /**
+     * Child environment contains only `env` entries
+     */
+    replace,
+    /**
+     * Child inherits parent environment, `env` entries are added to it
+     * replacing parent variables with the same names
+     */
+    overlay
+};
+
+/**
+ * Per-spawn settings for the child process, parent process environment
+ * and working directory are not modified, so concurrent spawns with
+ * different settings do not need to be serialized
+ */
+struct spawn_options {
+    /**
+     * How `env` is applied to the child environment
+     */
+    spawn_env_mode env_mode;
+
+    /**
+     * Environment variables as name-value pairs, names must be non-empty
+     * and must not contain '=', names and values must not contain '\0'
+     */
+    std::vector<std::pair<std::string, std::string>> env;
+
+    /**
+     * Working directory for the child process, empty value means that
+     * parent working directory is inherited
+     */
+    std::string cwd;
+
+    /**
+     * Descriptor to use for child stdout and stderr instead of opening
+     * the `out` path, -1 by default; descriptor is not closed by the spawn
+     * call (not supported on Windows)
+     */
+    int out_fd;
+
+    /**
+     * Whether `exec_async` installs the `SIGCHLD` handler that reaps exited
+     * children, true by default; should be disabled when the child exit status
+     * is collected by other means (for example, with `reactor::add_child`),
+     * handler is process-wide and once installed reaps all the children
+     */
+    bool auto_reap;
+
+    /**
+     * Constructor, child inherits parent environment and working directory,
+     * output is written to the `out` path
+     */
+    spawn_options() :
+    env_mode(spawn_env_mode::inherit),
+    out_fd(-1),
+    auto_reap(true) { }
+};
+
 /**
  * Starts shell process with the specified command and waits for it to exit
  * 
@@ -46,18 +118,52 @@ int shell_exec_and_wait(const std::string& cmd);
  * @param executable path to executable binary or script
  * @param args list of arguments
  * @return command return code
+ * @throws utils_exception if the process cannot be started (reported synchronously
+ *         with the failing setup stage and errno, for example when executable is not found)
  */
 int exec_and_wait(const std::string& executable, const std::vector<std::string>& args, const std::string& out);
 
 /**
- * Starts the process with the specified command and waits for it to exit
+ * Starts the process with the specified command, environment and working directory
+ * and waits for it to exit
+ * 
+ * @param executable path to executable binary or script
+ * @param args list of arguments
+ * @param out path to file for child stdout and stderr
+ * @param options child environment and working directory
+ * @return command return code
+ * @throws utils_exception if options are invalid, if working directory cannot be opened
+ *         or if the process cannot be started
+ */
+int exec_and_wait(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options);
+
+/**
+ * Starts the process with the specified command and does not wait for it to exit
  * 
  * @param executable path to executable binary or script
  * @param args list of arguments
  * @return child process pid
+ * @throws utils_exception if the process cannot be started (reported synchronously
+ *         with the failing setup stage and errno, for example when executable is not found)
  */
 int exec_async(const std::string& executable, const std::vector<std::string>& args, const std::string& out);
 
+/**
+ * Starts the process with the specified command, environment and working directory
+ * and does not wait for it to exit
+ * 
+ * @param executable path to executable binary or script
+ * @param args list of arguments
+ * @param out path to file for child stdout and stderr
+ * @param options child environment and working directory
+ * @return child process pid
+ * @throws utils_exception if options are invalid, if working directory cannot be opened
+ *         or if the process cannot be started
+ */
+int exec_async(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options);
+
 /**
  * Returns path to the current executable file
  * 
@@ -65,6 +171,125 @@ int exec_async(const std::string& executable, const std::vector<std::string>& ar
  */
 std::string current_executable_path();
 
+/**
+ * Resource usage of the process
+ */
+struct process_stats {
+    /**
+     * Resident set size in bytes
+     */
+    uint64_t rss_bytes;
+
+    /**
+     * Virtual memory size in bytes
+     */
+    uint64_t virtual_bytes;
+
+    /**
+     * CPU time spent in user mode (clock ticks resolution)
+     */
+    std::chrono::nanoseconds user_time;
+
+    /**
+     * CPU time spent in kernel mode (clock ticks resolution)
+     */
+    std::chrono::nanoseconds system_time;
+
+    /**
+     * Number of threads
+     */
+    uint32_t threads_count;
+
+    /**
+     * Number of open file descriptors, descriptors held by the reader
+     * itself are not included
+     */
+    uint32_t open_fds_count;
+};
+
+/**
+ * Reads resource usage of the specified process from `/proc/<pid>/stat`,
+ * `/proc/<pid>/statm` and `/proc/<pid>/fd`.
+ * 
+ * Files are opened once in constructor and are re-read with `pread`
+ * into stack buffers, `read` does not allocate memory, so it is cheap
+ * enough for periodic sampling. Not thread-safe. Supported only on Linux.
+ */
+class process_stats_reader {
+    int pid;
+    int stat_fd;
+    int statm_fd;
+    int fd_dir_fd;
+
+public:
+    /**
+     * Constructor, opens `/proc` files of the specified process
+     * 
+     * @param pid process id, for example, returned by `exec_async`
+     * @throws utils_exception if process does not exist or `/proc` is not available
+     */
+    explicit process_stats_reader(int pid);
+
+    /**
+     * Deleted copy constructor
+     */
+    process_stats_reader(const process_stats_reader&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    process_stats_reader& operator=(const process_stats_reader&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    process_stats_reader(process_stats_reader&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    process_stats_reader& operator=(process_stats_reader&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Destructor, closes `/proc` files
+     */
+    ~process_stats_reader() STATICLIB_NOEXCEPT;
+
+    /**
+     * Reads current resource usage of the process
+     * 
+     * @return resource usage
+     * @throws utils_exception if process has exited and was reaped or on read error
+     */
+    process_stats read();
+
+    /**
+     * Process id, that was specified in constructor
+     * 
+     * @return process id
+     */
+    int process_id() const STATICLIB_NOEXCEPT;
+
+private:
+    void close_files() STATICLIB_NOEXCEPT;
+};
+
+/**
+ * Returns resource usage of the current process, `/proc` files
+ * are opened on the first call and are reopened in the forked child.
+ * Thread-safe, does not allocate memory after the first call.
+ * Supported only on Linux.
+ * 
+ * @return resource usage of the current process
+ * @throws utils_exception on `/proc` read error
+ */
+process_stats current_process_stats();
+
 } // namespace
 }
 
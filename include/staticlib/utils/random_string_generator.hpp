@@ -30,6 +30,7 @@
 
 #include "staticlib/config/noexcept.hpp"
 
+#include "staticlib/utils/small_string.hpp"
 #include "staticlib/utils/utils_exception.hpp"
 
 namespace staticlib {
@@ -104,6 +105,15 @@ public:
      * @param str string to fill
      */
     void generate(std::string& str);
+
+    /**
+     * Changes all characters in specified string with random ones,
+     * initial characters are ignored, no memory is allocated
+     * if string length fits into its inline storage
+     * 
+     * @param str string to fill
+     */
+    void generate(inline_string& str);
     
 };
 
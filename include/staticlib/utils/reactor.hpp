@@ -0,0 +1,201 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   reactor.hpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 10:20 AM
+ */
+
+#ifndef STATICLIB_UTILS_REACTOR_HPP
+#define STATICLIB_UTILS_REACTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+#ifdef STATICLIB_LINUX
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Single-threaded event loop over `epoll` that dispatches callbacks for
+ * signals (`signalfd`), child process exits (`pidfd`, Linux 5.3+),
+ * timers (`timerfd`) and tasks posted from other threads (`eventfd`).
+ * 
+ * All the callbacks are called on the thread that runs the loop. Registration
+ * methods (`add_*` and `remove`) must be called on the loop thread (from callbacks)
+ * or while the loop is not running, only `post` and `stop` may be called
+ * from any thread.
+ */
+class reactor {
+    struct entry;
+
+    int epoll_fd;
+    int wakeup_fd;
+    int signal_fd;
+    uint64_t next_id;
+    std::atomic<bool> stop_requested;
+    std::unordered_map<uint64_t, std::shared_ptr<entry>> entries;
+    std::unordered_map<int, uint64_t> signal_ids;
+    std::mutex tasks_mutex;
+    std::vector<std::function<void()>> tasks;
+    std::vector<std::function<void()>> running_tasks;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @throws utils_exception if epoll or eventfd cannot be created
+     */
+    reactor();
+
+    /**
+     * Deleted copy constructor
+     */
+    reactor(const reactor&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    reactor& operator=(const reactor&) = delete;
+
+    /**
+     * Destructor, closes all the descriptors, signals registered with
+     * `add_signal` remain blocked, posted tasks that were not run are discarded
+     */
+    ~reactor() STATICLIB_NOEXCEPT;
+
+    /**
+     * Registers signal callback, signal is blocked in the calling thread and
+     * is received through `signalfd`; signal must be blocked in all other threads
+     * too (simplest way is to call this method before starting any threads),
+     * otherwise it may be delivered to these threads instead
+     * 
+     * @param signum signal number
+     * @param callback function called with the signal number
+     * @return registration id
+     * @throws utils_exception if signal is already registered or cannot be blocked
+     */
+    uint64_t add_signal(int signum, std::function<void(int)> callback);
+
+    /**
+     * Registers callback for the process exit, registration is removed after
+     * the callback is called; process is reaped if it is a child of the current
+     * process and was not reaped yet by someone else (see `spawn_options::auto_reap`)
+     * 
+     * @param pid process id, for example, returned by `exec_async`
+     * @param callback function called with the pid and exit code, exit code is
+     *        128 + signal number if process was killed by a signal and -1 if exit
+     *        status is not available
+     * @return registration id
+     * @throws utils_exception if process does not exist or pidfd is not supported
+     */
+    uint64_t add_child(int pid, std::function<void(int, int)> callback);
+
+    /**
+     * Registers timer callback
+     * 
+     * @param interval delay before the first call and the period between
+     *        the calls, must be positive
+     * @param callback function to call
+     * @param periodic whether timer is repeated, one-shot timer registration
+     *        is removed after the callback is called
+     * @return registration id
+     * @throws utils_exception if interval is not positive or timer cannot be created
+     */
+    uint64_t add_timer(std::chrono::nanoseconds interval, std::function<void()> callback, bool periodic = true);
+
+    /**
+     * Removes registration, pending events for it are not dispatched,
+     * unknown ids are ignored
+     * 
+     * @param id registration id
+     */
+    void remove(uint64_t id) STATICLIB_NOEXCEPT;
+
+    /**
+     * Queues the task to be called on the loop thread, thread-safe
+     * 
+     * @param task function to call
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * Runs the loop until `stop` is called
+     * 
+     * @throws utils_exception on epoll error, exceptions thrown from callbacks
+     *         are propagated to the caller, loop can be run again after that
+     */
+    void run();
+
+    /**
+     * Waits for events once and dispatches them
+     * 
+     * @param timeout max time to wait, negative value means infinite wait
+     * @return number of called callbacks, including posted tasks
+     * @throws utils_exception on epoll error
+     */
+    size_t run_once(std::chrono::milliseconds timeout);
+
+    /**
+     * Requests `run` to return after dispatching current events, thread-safe,
+     * if called when loop is not running, next `run` call returns immediately
+     */
+    void stop();
+
+    /**
+     * Number of active registrations
+     * 
+     * @return number of signals, children and timers registered
+     */
+    size_t registrations_count() const STATICLIB_NOEXCEPT;
+
+private:
+    uint64_t add_entry(std::shared_ptr<entry> en);
+
+    void wakeup() STATICLIB_NOEXCEPT;
+
+    size_t dispatch_tasks();
+
+    size_t dispatch_signals();
+
+    size_t dispatch_child(uint64_t id, const std::shared_ptr<entry>& en);
+
+    size_t dispatch_timer(uint64_t id, const std::shared_ptr<entry>& en);
+
+    void update_signal_mask();
+};
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
+
+#endif /* STATICLIB_UTILS_REACTOR_HPP */
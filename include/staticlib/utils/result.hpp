@@ -0,0 +1,151 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   result.hpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 11:00 AM
+ */
+
+#ifndef STATICLIB_UTILS_RESULT_HPP
+#define STATICLIB_UTILS_RESULT_HPP
+
+#include <cstdint>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Error codes reported by non-throwing parsing utilities
+ */
+enum class error_code : uint8_t {
+    ok = 0,
+    invalid_format,
+    out_of_range,
+    invalid_escape,
+    unknown_unit
+};
+
+/**
+ * Human-readable description of the error code
+ * 
+ * @param code error code
+ * @return static description string
+ */
+const char* error_code_message(error_code code) STATICLIB_NOEXCEPT;
+
+/**
+ * Lightweight "expected-like" result of the operation: either a value
+ * or an error code, value type must be default-constructible
+ */
+template<typename T>
+class result {
+    T val;
+    error_code code;
+
+public:
+    /**
+     * Constructor for the successful result
+     * 
+     * @param value result value
+     */
+    result(T value) :
+    val(std::move(value)),
+    code(error_code::ok) { }
+
+    /**
+     * Constructor for the failed result
+     * 
+     * @param error error code, must not be `error_code::ok`
+     */
+    result(error_code error) :
+    val(),
+    code(error) { }
+
+    /**
+     * Checks whether operation was successful
+     * 
+     * @return true on success
+     */
+    bool ok() const STATICLIB_NOEXCEPT {
+        return error_code::ok == code;
+    }
+
+    /**
+     * Checks whether operation was successful
+     * 
+     * @return true on success
+     */
+    explicit operator bool() const STATICLIB_NOEXCEPT {
+        return ok();
+    }
+
+    /**
+     * Error code
+     * 
+     * @return error code, `error_code::ok` on success
+     */
+    error_code error() const STATICLIB_NOEXCEPT {
+        return code;
+    }
+
+    /**
+     * Result value
+     * 
+     * @return value
+     * @throws utils_exception if operation has failed
+     */
+    const T& value() const {
+        if (!ok()) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code_message(code));
+        }
+        return val;
+    }
+
+    /**
+     * Result value
+     * 
+     * @return value
+     * @throws utils_exception if operation has failed
+     */
+    T& value() {
+        if (!ok()) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code_message(code));
+        }
+        return val;
+    }
+
+    /**
+     * Result value or the specified default if operation has failed
+     * 
+     * @param default_value value to return on error
+     * @return value
+     */
+    T value_or(T default_value) const {
+        return ok() ? val : default_value;
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_RESULT_HPP */
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   shm_ring.hpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 2:10 PM
+ */
+
+#ifndef STATICLIB_UTILS_SHM_RING_HPP
+#define STATICLIB_UTILS_SHM_RING_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+#ifdef STATICLIB_LINUX
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Single-producer single-consumer byte ring in the shared memory segment,
+ * can be used to pass data between the processes (or threads).
+ * 
+ * Reads and writes do not use system calls while the ring is neither empty
+ * nor full, blocking `read` and `write` wait on the futex only when there
+ * is nothing to read or no space to write respectively.
+ * 
+ * Ring is created by one side (usually the parent process) and attached by
+ * another side using the handle string (that can be passed through
+ * the command line arguments). Segment name is removed when the instance that
+ * has created it is destroyed or when `unlink` is called. Only one thread
+ * may write into the ring and only one thread may read from it at a time.
+ * 
+ * Positions in the segment are written by the peer process and are checked
+ * against the capacity before each copy, ring with inconsistent positions
+ * is treated as corrupted and is closed.
+ */
+class shm_ring {
+    void* mapping;
+    size_t mapping_size;
+    std::string name;
+    bool owner;
+    // local copies of the positions of the opposite side
+    uint32_t cached_head;
+    uint32_t cached_tail;
+
+public:
+    /**
+     * Default capacity of the ring
+     */
+    static const size_t default_capacity = 64 * 1024;
+
+    /**
+     * Creates new shared memory segment
+     * 
+     * @param capacity ring capacity in bytes, rounded up to the power of 2,
+     *        must not exceed 1GB
+     * @throws utils_exception if segment cannot be created
+     */
+    explicit shm_ring(size_t capacity = default_capacity);
+
+    /**
+     * Attaches to the ring created by other instance
+     * 
+     * @param handle handle string obtained using `handle()` on the creator side
+     * @throws utils_exception if segment cannot be opened or has invalid layout
+     */
+    explicit shm_ring(const std::string& handle);
+
+    /**
+     * Deleted copy constructor
+     */
+    shm_ring(const shm_ring&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    shm_ring& operator=(const shm_ring&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    shm_ring(shm_ring&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    shm_ring& operator=(shm_ring&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Destructor, unmaps the segment and removes its name if
+     * this instance has created it
+     */
+    ~shm_ring() STATICLIB_NOEXCEPT;
+
+    /**
+     * Handle string that can be used to attach to this ring
+     * 
+     * @return handle string
+     */
+    const std::string& handle() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Removes the name of the segment, already attached instances
+     * continue to work, no new instances can attach
+     */
+    void unlink() STATICLIB_NOEXCEPT;
+
+    /**
+     * Ring capacity
+     * 
+     * @return capacity in bytes
+     */
+    size_t capacity() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Number of bytes available for reading
+     * 
+     * @return number of bytes
+     */
+    size_t available() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Writes as much of the specified data as fits into the ring,
+     * does not block
+     * 
+     * @param data data to write
+     * @param length data length
+     * @return number of bytes written, 0 if ring is full or corrupted
+     */
+    size_t try_write(const char* data, size_t length) STATICLIB_NOEXCEPT;
+
+    /**
+     * Writes all the specified data, waits for the reader to free
+     * the space if necessary. Data may be written partially on timeout
+     * or if ring was closed, returned number of bytes must be checked
+     * by the callers that put framed messages into the ring.
+     * 
+     * @param data data to write
+     * @param length data length
+     * @param timeout max time to wait, limits the whole call, not each wait
+     * @return number of bytes written, less than length on timeout
+     *         or if ring was closed
+     */
+    size_t write(const char* data, size_t length, std::chrono::milliseconds timeout);
+
+    /**
+     * Reads available data into the specified buffer, does not block
+     * 
+     * @param buf destination buffer
+     * @param length buffer length
+     * @return number of bytes read, 0 if ring is empty or corrupted
+     */
+    size_t try_read(char* buf, size_t length) STATICLIB_NOEXCEPT;
+
+    /**
+     * Reads available data into the specified buffer, waits for the
+     * writer if the ring is empty
+     * 
+     * @param buf destination buffer
+     * @param length buffer length
+     * @param timeout max time to wait
+     * @return number of bytes read, 0 on timeout or if ring is empty and closed
+     */
+    size_t read(char* buf, size_t length, std::chrono::milliseconds timeout);
+
+    /**
+     * Marks the ring as closed (can be called by either side) and wakes up
+     * the waiting reader and writer, data written before is still available
+     * for reading
+     */
+    void close() STATICLIB_NOEXCEPT;
+
+    /**
+     * Checks whether the ring was closed
+     * 
+     * @return true if ring was closed
+     */
+    bool closed() const STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
+
+#endif /* STATICLIB_UTILS_SHM_RING_HPP */
@@ -0,0 +1,481 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   small_string.hpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 10:15 AM
+ */
+
+#ifndef STATICLIB_UTILS_SMALL_STRING_HPP
+#define STATICLIB_UTILS_SMALL_STRING_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * String with the inline storage for up to `N` characters, memory
+ * is allocated only when contents become longer than that (contents
+ * are never moved back to inline storage after that).
+ * Contents are always null-terminated, embedded null characters are allowed.
+ */
+template<size_t N>
+class small_string {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+    char* buf;
+    size_t len;
+    size_t cap;
+    char inline_data[N + 1];
+
+public:
+    /**
+     * Number of characters that can be stored without allocating memory,
+     * not including null terminator
+     */
+    static const size_t inline_capacity = N;
+
+    /**
+     * Constructor, creates empty string
+     */
+    small_string() STATICLIB_NOEXCEPT :
+    buf(inline_data),
+    len(0),
+    cap(N) {
+        inline_data[0] = '\0';
+    }
+
+    /**
+     * Constructor
+     * 
+     * @param data characters to copy
+     * @param length number of characters
+     */
+    small_string(const char* data, size_t length) :
+    small_string() {
+        append(data, length);
+    }
+
+    /**
+     * Constructor
+     * 
+     * @param cstr null-terminated string to copy
+     */
+    small_string(const char* cstr) :
+    small_string(cstr, std::strlen(cstr)) { }
+
+    /**
+     * Constructor
+     * 
+     * @param str string to copy
+     */
+    small_string(const std::string& str) :
+    small_string(str.data(), str.length()) { }
+
+    /**
+     * Copy constructor
+     * 
+     * @param other other instance
+     */
+    small_string(const small_string& other) :
+    small_string(other.buf, other.len) { }
+
+    /**
+     * Copy assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    small_string& operator=(const small_string& other) {
+        if (this != std::addressof(other)) {
+            assign(other.buf, other.len);
+        }
+        return *this;
+    }
+
+    /**
+     * Move constructor, heap storage is taken from the other instance,
+     * inline contents are copied
+     * 
+     * @param other other instance
+     */
+    small_string(small_string&& other) STATICLIB_NOEXCEPT :
+    small_string() {
+        *this = std::move(other);
+    }
+
+    /**
+     * Move assignment operator, heap storage is taken from the other instance,
+     * inline contents are copied
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    small_string& operator=(small_string&& other) STATICLIB_NOEXCEPT {
+        if (this == std::addressof(other)) {
+            return *this;
+        }
+        if (buf != inline_data) {
+            delete[] buf;
+        }
+        if (other.buf != other.inline_data) {
+            buf = other.buf;
+            cap = other.cap;
+        } else {
+            buf = inline_data;
+            cap = N;
+            std::memcpy(inline_data, other.inline_data, other.len + 1);
+        }
+        len = other.len;
+        other.buf = other.inline_data;
+        other.cap = N;
+        other.len = 0;
+        other.inline_data[0] = '\0';
+        return *this;
+    }
+
+    /**
+     * Assignment operator
+     * 
+     * @param str string to copy
+     * @return reference to this instance
+     */
+    small_string& operator=(const std::string& str) {
+        assign(str.data(), str.length());
+        return *this;
+    }
+
+    /**
+     * Assignment operator
+     * 
+     * @param cstr null-terminated string to copy
+     * @return reference to this instance
+     */
+    small_string& operator=(const char* cstr) {
+        assign(cstr, std::strlen(cstr));
+        return *this;
+    }
+
+    /**
+     * Destructor
+     */
+    ~small_string() STATICLIB_NOEXCEPT {
+        if (buf != inline_data) {
+            delete[] buf;
+        }
+    }
+
+    /**
+     * Replaces contents with the specified characters
+     * 
+     * @param data characters to copy, may point into this instance
+     * @param length number of characters
+     */
+    void assign(const char* data, size_t length) {
+        // data may point into the current buffer, it is freed after the copy
+        char* old = length > cap ? reallocate(length) : nullptr;
+        std::memmove(buf, data, length);
+        len = length;
+        buf[len] = '\0';
+        delete[] old;
+    }
+
+    /**
+     * Appends characters to the contents
+     * 
+     * @param data characters to append, may point into this instance
+     * @param length number of characters
+     */
+    void append(const char* data, size_t length) {
+        // data may point into the current buffer, it is freed after the copy
+        char* old = len + length > cap ? reallocate(len + length) : nullptr;
+        if (length > 0) {
+            std::memcpy(buf + len, data, length);
+        }
+        len += length;
+        buf[len] = '\0';
+        delete[] old;
+    }
+
+    /**
+     * Appends string to the contents
+     * 
+     * @param str string to append
+     */
+    void append(const std::string& str) {
+        append(str.data(), str.length());
+    }
+
+    /**
+     * Appends character to the contents
+     * 
+     * @param ch character to append
+     */
+    void push_back(char ch) {
+        reserve(len + 1);
+        buf[len] = ch;
+        len += 1;
+        buf[len] = '\0';
+    }
+
+    /**
+     * Changes contents length, new characters are set to the specified value
+     * 
+     * @param length new length
+     * @param ch value for new characters
+     */
+    void resize(size_t length, char ch = '\0') {
+        if (length > len) {
+            reserve(length);
+            std::memset(buf + len, ch, length - len);
+        }
+        len = length;
+        buf[len] = '\0';
+    }
+
+    /**
+     * Ensures that contents of the specified length can be stored
+     * without further allocations
+     * 
+     * @param capacity number of characters, not including null terminator
+     */
+    void reserve(size_t capacity) {
+        if (capacity > cap) {
+            delete[] reallocate(capacity);
+        }
+    }
+
+    /**
+     * Removes all characters, allocated memory is kept
+     */
+    void clear() STATICLIB_NOEXCEPT {
+        len = 0;
+        buf[0] = '\0';
+    }
+
+    /**
+     * Accessor for contents
+     * 
+     * @return pointer to contents
+     */
+    char* data() STATICLIB_NOEXCEPT {
+        return buf;
+    }
+
+    /**
+     * Accessor for contents
+     * 
+     * @return pointer to contents
+     */
+    const char* data() const STATICLIB_NOEXCEPT {
+        return buf;
+    }
+
+    /**
+     * Null-terminated contents
+     * 
+     * @return pointer to contents
+     */
+    const char* c_str() const STATICLIB_NOEXCEPT {
+        return buf;
+    }
+
+    /**
+     * Contents length
+     * 
+     * @return number of characters, not including null terminator
+     */
+    size_t length() const STATICLIB_NOEXCEPT {
+        return len;
+    }
+
+    /**
+     * Contents length
+     * 
+     * @return number of characters, not including null terminator
+     */
+    size_t size() const STATICLIB_NOEXCEPT {
+        return len;
+    }
+
+    /**
+     * Whether contents are empty
+     * 
+     * @return true if length is zero
+     */
+    bool empty() const STATICLIB_NOEXCEPT {
+        return 0 == len;
+    }
+
+    /**
+     * Number of characters that can be stored without further allocations
+     * 
+     * @return number of characters, not including null terminator
+     */
+    size_t capacity() const STATICLIB_NOEXCEPT {
+        return cap;
+    }
+
+    /**
+     * Whether contents are stored in the inline storage
+     * 
+     * @return true if no memory was allocated
+     */
+    bool is_inline() const STATICLIB_NOEXCEPT {
+        return buf == inline_data;
+    }
+
+    /**
+     * Character accessor, index is not checked
+     * 
+     * @param idx character index
+     * @return character reference
+     */
+    char& operator[](size_t idx) STATICLIB_NOEXCEPT {
+        return buf[idx];
+    }
+
+    /**
+     * Character accessor, index is not checked
+     * 
+     * @param idx character index
+     * @return character reference
+     */
+    const char& operator[](size_t idx) const STATICLIB_NOEXCEPT {
+        return buf[idx];
+    }
+
+    /**
+     * Iterator to the first character
+     * 
+     * @return begin iterator
+     */
+    char* begin() STATICLIB_NOEXCEPT {
+        return buf;
+    }
+
+    /**
+     * Iterator to the first character
+     * 
+     * @return begin iterator
+     */
+    const char* begin() const STATICLIB_NOEXCEPT {
+        return buf;
+    }
+
+    /**
+     * Iterator past the last character
+     * 
+     * @return end iterator
+     */
+    char* end() STATICLIB_NOEXCEPT {
+        return buf + len;
+    }
+
+    /**
+     * Iterator past the last character
+     * 
+     * @return end iterator
+     */
+    const char* end() const STATICLIB_NOEXCEPT {
+        return buf + len;
+    }
+
+    /**
+     * Copies contents into the string
+     * 
+     * @return string with contents
+     */
+    std::string str() const {
+        return std::string(buf, len);
+    }
+
+private:
+    // moves contents to the new heap buffer, returns the previous heap buffer
+    // (or null for inline storage) that must be freed by the caller
+    char* reallocate(size_t capacity) {
+        size_t new_cap = cap * 2;
+        if (new_cap < capacity) {
+            new_cap = capacity;
+        }
+        char* new_buf = new char[new_cap + 1];
+        std::memcpy(new_buf, buf, len + 1);
+        char* old = buf != inline_data ? buf : nullptr;
+        buf = new_buf;
+        cap = new_cap;
+        return old;
+    }
+};
+
+template<size_t N>
+bool operator==(const small_string<N>& first, const small_string<N>& second) STATICLIB_NOEXCEPT {
+    return first.length() == second.length() && 0 == std::memcmp(first.data(), second.data(), first.length());
+}
+
+template<size_t N>
+bool operator==(const small_string<N>& first, const std::string& second) STATICLIB_NOEXCEPT {
+    return first.length() == second.length() && 0 == std::memcmp(first.data(), second.data(), first.length());
+}
+
+template<size_t N>
+bool operator==(const std::string& first, const small_string<N>& second) STATICLIB_NOEXCEPT {
+    return second == first;
+}
+
+template<size_t N>
+bool operator==(const small_string<N>& first, const char* second) STATICLIB_NOEXCEPT {
+    return first.length() == std::strlen(second) && 0 == std::memcmp(first.data(), second, first.length());
+}
+
+template<size_t N>
+bool operator==(const char* first, const small_string<N>& second) STATICLIB_NOEXCEPT {
+    return second == first;
+}
+
+template<size_t N, typename T>
+bool operator!=(const small_string<N>& first, const T& second) STATICLIB_NOEXCEPT {
+    return !(first == second);
+}
+
+template<size_t N>
+bool operator!=(const std::string& first, const small_string<N>& second) STATICLIB_NOEXCEPT {
+    return !(second == first);
+}
+
+template<size_t N>
+bool operator!=(const char* first, const small_string<N>& second) STATICLIB_NOEXCEPT {
+    return !(second == first);
+}
+
+/**
+ * Small string with the inline capacity that covers most of the short
+ * results (names, keys, path elements), used by the string utilities
+ */
+typedef small_string<63> inline_string;
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_SMALL_STRING_HPP */
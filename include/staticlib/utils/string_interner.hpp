@@ -0,0 +1,187 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_interner.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 1:10 PM
+ */
+
+#ifndef STATICLIB_UTILS_STRING_INTERNER_HPP
+#define STATICLIB_UTILS_STRING_INTERNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Handle to the canonical copy of the string stored in interner,
+ * handles obtained from the same interner are equal if and only if
+ * their IDs are equal
+ */
+struct interned_string {
+    /**
+     * ID unique within the interner
+     */
+    uint32_t id;
+
+    /**
+     * Pointer to null-terminated canonical data, valid while interner is alive
+     */
+    const char* data;
+
+    /**
+     * Data length in bytes (not including null terminator)
+     */
+    size_t length;
+
+    /**
+     * Compares handles by ID
+     *
+     * @param other other handle from the same interner
+     * @return true if both handles point to the same string
+     */
+    bool operator==(const interned_string& other) const STATICLIB_NOEXCEPT {
+        return id == other.id;
+    }
+
+    /**
+     * Compares handles by ID
+     *
+     * @param other other handle from the same interner
+     * @return true if handles point to different strings
+     */
+    bool operator!=(const interned_string& other) const STATICLIB_NOEXCEPT {
+        return id != other.id;
+    }
+};
+
+/**
+ * Thread-safe string interning table. Lookups are lock-free,
+ * insertions take a lock on one of the shards selected by string hash.
+ * Interned strings are never removed, their storage is released
+ * with the interner.
+ */
+class string_interner {
+    class impl;
+    std::unique_ptr<impl> pimpl;
+
+public:
+    /**
+     * Constructor
+     */
+    string_interner();
+
+    /**
+     * Deleted copy constructor
+     */
+    string_interner(const string_interner&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    string_interner& operator=(const string_interner&) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    string_interner(string_interner&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    string_interner& operator=(string_interner&& other) STATICLIB_NOEXCEPT;
+
+    /**
+     * Destructor, releases all interned strings
+     */
+    ~string_interner() STATICLIB_NOEXCEPT;
+
+    /**
+     * Returns the canonical copy of the specified string,
+     * string is copied into interner on first call
+     *
+     * @param data string data
+     * @param length string length in bytes
+     * @return interned string handle
+     * @throws utils_exception on IDs space exhaustion
+     */
+    interned_string intern(const char* data, size_t length);
+
+    /**
+     * Returns the canonical copy of the specified string,
+     * string is copied into interner on first call
+     *
+     * @param str string to intern
+     * @return interned string handle
+     * @throws utils_exception on IDs space exhaustion
+     */
+    interned_string intern(const std::string& str);
+
+    /**
+     * Lock-free lookup of previously interned string
+     *
+     * @param data string data
+     * @param length string length in bytes
+     * @param out handle to fill if string is found
+     * @return true if string was interned before, false otherwise
+     */
+    bool find(const char* data, size_t length, interned_string& out) const STATICLIB_NOEXCEPT;
+
+    /**
+     * Lock-free lookup of previously interned string
+     *
+     * @param str string to look for
+     * @param out handle to fill if string is found
+     * @return true if string was interned before, false otherwise
+     */
+    bool find(const std::string& str, interned_string& out) const STATICLIB_NOEXCEPT;
+
+    /**
+     * Lock-free lookup of interned string by ID
+     *
+     * @param id ID returned from `intern`
+     * @return interned string handle
+     * @throws utils_exception if specified ID is unknown
+     */
+    interned_string get(uint32_t id) const;
+
+    /**
+     * Number of strings interned so far
+     *
+     * @return number of interned strings
+     */
+    size_t size() const STATICLIB_NOEXCEPT;
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_STRING_INTERNER_HPP */
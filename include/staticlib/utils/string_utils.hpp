@@ -31,8 +31,22 @@
 #include <vector>
 
 #include "staticlib/config.hpp"
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/small_string.hpp"
 #include "staticlib/utils/utils_exception.hpp"
 
+/**
+ * Small functions are defined inline in headers when the library is built
+ * with STATICLIB_UTILS_INLINE defined (`-Dstaticlib_utils_ENABLE_INLINE=ON`),
+ * library users must be compiled with the same definition (it is included
+ * into pkg-config cflags)
+ */
+#ifdef STATICLIB_UTILS_INLINE
+#define STATICLIB_UTILS_INLINE_FUNCTION inline
+#else
+#define STATICLIB_UTILS_INLINE_FUNCTION
+#endif // STATICLIB_UTILS_INLINE
+
 namespace staticlib {
 namespace utils {
 
@@ -45,6 +59,17 @@ namespace utils {
  */
 char* alloc_copy(const std::string& str) STATICLIB_NOEXCEPT;
 
+/**
+ * Copies contents of the string into a null-terminated buffer
+ * allocated from the specified arena. Buffer is owned by the arena
+ * and must NOT be freed by the caller.
+ * 
+ * @param str string to copy
+ * @param ar arena to allocate buffer from
+ * @return arena-allocated buffer
+ */
+char* alloc_copy(const std::string& str, arena& ar);
+
 /**
  * Splits string into vector using specified character as a delimiter,
  * empty result parts are ignored
@@ -55,6 +80,30 @@ char* alloc_copy(const std::string& str) STATICLIB_NOEXCEPT;
  */
 std::vector<std::string> split(const std::string& str, char delim);
 
+/**
+ * Splits string into vector using specified character as a delimiter,
+ * empty result parts are ignored. Both the vector and the parts
+ * are allocated from the specified arena.
+ * 
+ * @param str string to split
+ * @param delim delimiter character
+ * @param ar arena to allocate results from
+ * @return vector containing splitted parts
+ */
+arena_string_vector split(const std::string& str, char delim, arena& ar);
+
+/**
+ * Splits string into vector using specified character as a delimiter,
+ * empty result parts are ignored. Previous contents of the vector are
+ * removed, its storage is reused, parts that fit into the inline
+ * storage do not allocate memory.
+ * 
+ * @param str string to split
+ * @param delim delimiter character
+ * @param out vector to fill with splitted parts
+ */
+void split(const std::string& str, char delim, std::vector<inline_string>& out);
+
 /**
  * Checks whether one string starts with another one
  * 
@@ -62,7 +111,7 @@ std::vector<std::string> split(const std::string& str, char delim);
  * @param start string start
  * @return true if string starts with specified ending, false otherwise
  */
-bool starts_with(const std::string& value, const std::string& start);
+STATICLIB_UTILS_INLINE_FUNCTION bool starts_with(const std::string& value, const std::string& start);
 
 /**
  * Checks whether one string ends with another one
@@ -71,7 +120,7 @@ bool starts_with(const std::string& value, const std::string& start);
  * @param ending string ending
  * @return true if string ends with specified ending, false otherwise
  */
-bool ends_with(const std::string& value, const std::string& ending);
+STATICLIB_UTILS_INLINE_FUNCTION bool ends_with(const std::string& value, const std::string& ending);
 
 /**
  * Returns new string containing specified path but without
@@ -92,6 +141,15 @@ std::string strip_filename(const std::string& file_path);
  */
 std::string strip_parent_dir(const std::string& file_path);
 
+/**
+ * Writes specified path but without the parent directory
+ * into the specified string, input path is not copied
+ * 
+ * @param file_path file path
+ * @param out string to write filename to, previous contents are replaced
+ */
+void strip_parent_dir(const std::string& file_path, inline_string& out);
+
 /**
  * Trims specified string from left and from right using "std::isspace"
  * to check empty bytes, does not support Unicode
@@ -101,6 +159,27 @@ std::string strip_parent_dir(const std::string& file_path);
  */
 std::string trim(const std::string& s);
 
+/**
+ * Trims specified string from left and from right using "std::isspace"
+ * to check empty bytes, does not support Unicode. Result is allocated
+ * from the specified arena.
+ * 
+ * @param s string to trim
+ * @param ar arena to allocate result from
+ * @return trimmed string
+ */
+arena_string trim(const std::string& s, arena& ar);
+
+/**
+ * Trims specified string from left and from right using "std::isspace"
+ * to check empty bytes, does not support Unicode. Result is written
+ * into the specified string.
+ * 
+ * @param s string to trim
+ * @param out string to write result to, previous contents are replaced
+ */
+void trim(const std::string& s, inline_string& out);
+
 /**
  * Case insensitive byte-to-byte string comparison, does not support Unicode
  * 
@@ -109,7 +188,7 @@ std::string trim(const std::string& s);
  * @return true if strings equal ignoring case, false otherwise
  */
 // http://stackoverflow.com/a/27813
-bool iequals(const std::string& str1, const std::string& str2);
+STATICLIB_UTILS_INLINE_FUNCTION bool iequals(const std::string& str1, const std::string& str2);
 
 /**
  * Finds and replaces all "snippet" substrings in specified 
@@ -127,10 +206,14 @@ std::string& replace_all(std::string& str, const std::string& snippet, const std
  * 
  * @return empty string reference
  */
-const std::string& empty_string();
+STATICLIB_UTILS_INLINE_FUNCTION const std::string& empty_string();
 
 } // namespace
 }
 
+#ifdef STATICLIB_UTILS_INLINE
+#include "staticlib/utils/string_utils_inline.hpp"
+#endif // STATICLIB_UTILS_INLINE
+
 #endif /* STATICLIB_UTILS_STRING_UTILS_HPP */
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_utils_inline.hpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 3:10 PM
+ */
+
+// definitions of the small string functions, included from "string_utils.hpp"
+// in inline mode and from "string_utils.cpp" otherwise, must not be included directly
+
+#ifndef STATICLIB_UTILS_STRING_UTILS_INLINE_HPP
+#define STATICLIB_UTILS_STRING_UTILS_INLINE_HPP
+
+#include <cctype>
+#include <string>
+
+#include "staticlib/utils/string_utils.hpp"
+
+namespace staticlib {
+namespace utils {
+
+// http://stackoverflow.com/a/8095276/314015
+STATICLIB_UTILS_INLINE_FUNCTION bool starts_with(const std::string& value, const std::string& start) {
+    return 0 == value.compare(0, start.length(), start);
+}
+
+// http://stackoverflow.com/a/874160/314015
+STATICLIB_UTILS_INLINE_FUNCTION bool ends_with(const std::string& value, const std::string& ending) {
+    if (value.length() >= ending.length()) {
+        return (0 == value.compare(value.length() - ending.length(), ending.length(), ending));
+    } else {
+        return false;
+    }
+}
+
+// http://stackoverflow.com/a/27813
+STATICLIB_UTILS_INLINE_FUNCTION bool iequals(const std::string& str1, const std::string& str2) {
+    if (str1.size() != str2.size()) {
+        return false;
+    }
+    for (std::string::const_iterator c1 = str1.begin(), c2 = str2.begin(); c1 != str1.end(); ++c1, ++c2) {
+        if (std::tolower(*c1) != std::tolower(*c2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+STATICLIB_UTILS_INLINE_FUNCTION const std::string& empty_string() {
+    static std::string empty{""};
+    return empty;
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_STRING_UTILS_INLINE_HPP */
@@ -24,8 +24,11 @@
 #ifndef STATICLIB_UTILS_URL_UTILS_HPP
 #define STATICLIB_UTILS_URL_UTILS_HPP
 
+#include <cstddef>
 #include <string>
 
+#include "staticlib/utils/result.hpp"
+
 namespace staticlib {
 namespace utils {
 
@@ -37,6 +40,26 @@ namespace utils {
  */
 std::string url_decode(const std::string& str);
 
+/**
+ * Unescapes specified URL-encoded bytes (a%20value+with%20spaces)
+ * appending result to the specified string
+ * 
+ * @param data URL-encoded bytes
+ * @param length number of bytes
+ * @param out string to append unescaped (plain) data to
+ */
+void url_decode(const char* data, size_t length, std::string& out);
+
+/**
+ * Unescapes specified URL-encoded string, unlike `url_decode` does not
+ * recover from malformed escapes
+ * 
+ * @param str URL-encoded string
+ * @return unescaped (plain) string or `error_code::invalid_escape` if `%`
+ *         is not followed by two hex digits
+ */
+result<std::string> try_url_decode(const std::string& str);
+
 /**
  * Encodes specified string so that it is safe for URLs (with%20spaces)
  * 
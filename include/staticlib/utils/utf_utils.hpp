@@ -0,0 +1,188 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utf_utils.hpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 2:10 PM
+ */
+
+#ifndef STATICLIB_UTILS_UTF_UTILS_HPP
+#define STATICLIB_UTILS_UTF_UTILS_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace utils {
+
+/**
+ * Result of the transcoding operation
+ */
+struct utf_result {
+    /**
+     * Whether the whole input was valid
+     */
+    bool valid;
+
+    /**
+     * Input length if input is valid, otherwise offset (in input code units)
+     * of the first invalid sequence
+     */
+    size_t position;
+};
+
+/**
+ * Checks whether the specified bytes are valid UTF-8, overlong forms,
+ * surrogates and values above U+10FFFF are rejected
+ * 
+ * @param data input bytes
+ * @param length number of bytes
+ * @return result with the offset of the first invalid sequence
+ */
+utf_result utf8_validate(const char* data, size_t length) STATICLIB_NOEXCEPT;
+
+/**
+ * Checks whether the specified string is valid UTF-8
+ * 
+ * @param str input string
+ * @return result with the offset of the first invalid sequence
+ */
+utf_result utf8_validate(const std::string& str) STATICLIB_NOEXCEPT;
+
+/**
+ * Streaming UTF-8 validator for the chunked input, multibyte sequences
+ * may be split between chunks arbitrarily
+ */
+class utf8_validator {
+    unsigned char pending[4];
+    size_t pending_length;
+    size_t pending_needed;
+    size_t offset;
+    size_t error_offset;
+    bool failed;
+
+public:
+    /**
+     * Constructor
+     */
+    utf8_validator() STATICLIB_NOEXCEPT;
+
+    /**
+     * Validates next chunk of the input, chunks after the first invalid
+     * sequence are ignored
+     * 
+     * @param data chunk bytes
+     * @param length number of bytes
+     * @return false if invalid sequence was found in the input so far
+     */
+    bool update(const char* data, size_t length) STATICLIB_NOEXCEPT;
+
+    /**
+     * Checks that the whole input is valid, sequence truncated at
+     * the end of the input is reported as invalid
+     * 
+     * @return result with the offset (from the start of the first chunk)
+     *         of the first invalid sequence
+     */
+    utf_result finish() const STATICLIB_NOEXCEPT;
+
+    /**
+     * Resets validator state to start the new input
+     */
+    void reset() STATICLIB_NOEXCEPT;
+};
+
+/**
+ * Transcodes UTF-8 into UTF-16 appending result to the specified string,
+ * `out` is not modified if input is invalid
+ * 
+ * @param data UTF-8 bytes
+ * @param length number of bytes
+ * @param out string to append UTF-16 code units to
+ * @return result with invalid sequence offset
+ */
+utf_result utf8_to_utf16(const char* data, size_t length, std::u16string& out);
+
+/**
+ * Transcodes UTF-16 into UTF-8 appending result to the specified string,
+ * `out` is not modified if input is invalid (contains unpaired surrogates)
+ * 
+ * @param data UTF-16 code units
+ * @param length number of code units
+ * @param out string to append UTF-8 bytes to
+ * @return result with invalid code unit offset
+ */
+utf_result utf16_to_utf8(const char16_t* data, size_t length, std::string& out);
+
+/**
+ * Transcodes UTF-8 into UTF-32 appending result to the specified string,
+ * `out` is not modified if input is invalid
+ * 
+ * @param data UTF-8 bytes
+ * @param length number of bytes
+ * @param out string to append UTF-32 code points to
+ * @return result with invalid sequence offset
+ */
+utf_result utf8_to_utf32(const char* data, size_t length, std::u32string& out);
+
+/**
+ * Transcodes UTF-32 into UTF-8 appending result to the specified string,
+ * `out` is not modified if input is invalid (contains surrogates or
+ * values above U+10FFFF)
+ * 
+ * @param data UTF-32 code points
+ * @param length number of code points
+ * @param out string to append UTF-8 bytes to
+ * @return result with invalid code point offset
+ */
+utf_result utf32_to_utf8(const char32_t* data, size_t length, std::string& out);
+
+/**
+ * Convert string from UTF-8 multibyte to widechar (UTF-16 on Windows,
+ * UTF-32 on other platforms), invalid bytes are replaced with U+FFFD
+ * 
+ * @param st UTF-8 multibyte string
+ * @return wide string
+ */
+std::wstring widen(const std::string& st);
+
+/**
+ * Convert string from widechar (UTF-16 on Windows, UTF-32 on other platforms)
+ * to UTF-8 multibyte, invalid code units are replaced with U+FFFD
+ * 
+ * @param wstring wide string
+ * @return UTF-8 multibyte string
+ */
+std::string narrow(std::wstring wstr);
+
+/**
+ * Convert buffer from widechar (UTF-16 on Windows, UTF-32 on other platforms)
+ * to UTF-8 multibyte, invalid code units are replaced with U+FFFD
+ * 
+ * @param wbuf widechar buffer
+ * @param length buffer length in wide chars
+ * @return UTF-8 multibyte string
+ */
+std::string narrow(const wchar_t* wbuf, size_t length);
+
+} // namespace
+}
+
+#endif /* STATICLIB_UTILS_UTF_UTILS_HPP */
@@ -24,33 +24,117 @@
 #ifndef STATICLIB_UTILS_UTILS_EXCEPTION_HPP
 #define STATICLIB_UTILS_UTILS_EXCEPTION_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include "staticlib/config.hpp"
 #include "staticlib/support.hpp"
 
+#include "staticlib/utils/format.hpp"
+
+/**
+ * Source location of the current line, for the lazily formatted exceptions
+ */
+#define STATICLIB_UTILS_TRACE_LOCATION sl::utils::trace_location{__FILE__, __func__, __LINE__}
+
 namespace staticlib {
 namespace utils {
 
+/**
+ * Source location for the lazily formatted exceptions,
+ * all strings must have static storage duration
+ */
+struct trace_location {
+    const char* file;
+    const char* func;
+    int line;
+};
+
 /**
  * Module specific exception
  */
 class utils_exception : public sl::support::exception {
+public:
+    /**
+     * Max length of the argument copied into the lazily formatted exception,
+     * longer arguments are truncated
+     */
+    static const size_t max_argument_length = 128;
+
+private:
+    // lazy message parts, "lazy_message" is null for eagerly formatted exceptions
+    trace_location location;
+    const char* lazy_message;
+    size_t argument_length;
+    bool has_argument;
+    bool argument_truncated;
+    char argument[max_argument_length];
+    // 0: not formatted, 1: formatting in progress, 2: formatted
+    mutable std::atomic<int> format_state;
+    mutable std::string formatted;
+
 public:
     /**
      * Default constructor
      */
-    utils_exception() = default;
+    utils_exception() STATICLIB_NOEXCEPT;
 
     /**
      * Constructor with message
      * 
      * @param msg error message
      */
-    utils_exception(const std::string& msg) :
-    sl::support::exception(msg) { }
+    utils_exception(const std::string& msg);
+
+    /**
+     * Constructor for the hot error paths, does not allocate memory,
+     * the message is formatted on the first `what()` call as
+     * `message[argument]` followed by the source location
+     * 
+     * @param location source location, see STATICLIB_UTILS_TRACE_LOCATION
+     * @param message error message, must have static storage duration
+     * @param data argument to show in the message, copied into the inline buffer,
+     *        may be null
+     * @param length argument length
+     */
+    utils_exception(trace_location location, const char* message,
+            const char* data = nullptr, size_t length = 0) STATICLIB_NOEXCEPT;
+
+    /**
+     * Constructor with the message formatted with `STATICLIB_UTILS_FORMAT`,
+     * source location is appended to the message, message string
+     * is allocated only once
+     * 
+     * @param location source location, see STATICLIB_UTILS_TRACE_LOCATION
+     * @param message formatted message
+     */
+    utils_exception(trace_location location, const format_buffer& message);
+
+    /**
+     * Copy constructor
+     * 
+     * @param other other instance
+     */
+    utils_exception(const utils_exception& other);
 
+    /**
+     * Copy assignment operator
+     * 
+     * @param other other instance
+     * @return reference to this instance
+     */
+    utils_exception& operator=(const utils_exception& other);
+
+    /**
+     * Error message, lazy message is formatted on the first call
+     * 
+     * @return error message
+     */
+    virtual const char* what() const STATICLIB_NOEXCEPT override;
 };
 
+} // namespace
 }
-} //namespace
 
 #endif /* STATICLIB_UTILS_UTILS_EXCEPTION_HPP */
-
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   arena.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:31 AM
+ */
+
+#include "staticlib/utils/arena.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const size_t header_size = (sizeof(void*) * 2 + arena::default_alignment - 1) & ~(arena::default_alignment - 1);
+
+char* align_up(char* ptr, size_t alignment) {
+    uintptr_t addr = reinterpret_cast<uintptr_t> (ptr);
+    uintptr_t aligned = (addr + alignment - 1) & ~(static_cast<uintptr_t> (alignment) - 1);
+    return reinterpret_cast<char*> (aligned);
+}
+
+} // namespace
+
+arena::arena(size_t initial_chunk_size) :
+head(nullptr),
+cur(nullptr),
+end(nullptr),
+next_chunk_size(initial_chunk_size > 0 ? initial_chunk_size : default_chunk_size),
+used(0),
+chunks(0) { }
+
+arena::arena(arena&& other) STATICLIB_NOEXCEPT :
+head(other.head),
+cur(other.cur),
+end(other.end),
+next_chunk_size(other.next_chunk_size),
+used(other.used),
+chunks(other.chunks) {
+    other.head = nullptr;
+    other.cur = nullptr;
+    other.end = nullptr;
+    other.used = 0;
+    other.chunks = 0;
+}
+
+arena& arena::operator=(arena&& other) STATICLIB_NOEXCEPT {
+    release_chunks(nullptr);
+    head = other.head;
+    cur = other.cur;
+    end = other.end;
+    next_chunk_size = other.next_chunk_size;
+    used = other.used;
+    chunks = other.chunks;
+    other.head = nullptr;
+    other.cur = nullptr;
+    other.end = nullptr;
+    other.used = 0;
+    other.chunks = 0;
+    return *this;
+}
+
+arena::~arena() STATICLIB_NOEXCEPT {
+    release_chunks(nullptr);
+}
+
+void* arena::allocate(size_t size, size_t alignment) {
+    if (nullptr != cur) {
+        char* ptr = align_up(cur, alignment);
+        if (ptr <= end && static_cast<size_t> (end - ptr) >= size) {
+            used += static_cast<size_t> (ptr - cur) + size;
+            cur = ptr + size;
+            return ptr;
+        }
+    }
+    if (size > std::numeric_limits<size_t>::max() - alignment - header_size) {
+        throw std::bad_alloc();
+    }
+    add_chunk(size + alignment);
+    char* ptr = align_up(cur, alignment);
+    used += static_cast<size_t> (ptr - cur) + size;
+    cur = ptr + size;
+    return ptr;
+}
+
+void arena::reset() STATICLIB_NOEXCEPT {
+    if (nullptr == head) {
+        return;
+    }
+    release_chunks(head);
+    head->prev = nullptr;
+    cur = reinterpret_cast<char*> (head) + header_size;
+    end = cur + head->size;
+    used = 0;
+    chunks = 1;
+}
+
+size_t arena::bytes_used() const STATICLIB_NOEXCEPT {
+    return used;
+}
+
+size_t arena::chunks_count() const STATICLIB_NOEXCEPT {
+    return chunks;
+}
+
+void arena::add_chunk(size_t min_size) {
+    size_t size = next_chunk_size;
+    while (size < min_size && size < max_chunk_size) {
+        size *= 2;
+    }
+    if (size < min_size) {
+        // oversized allocation gets a dedicated chunk
+        size = min_size;
+    }
+    void* mem = std::malloc(header_size + size);
+    if (nullptr == mem) {
+        throw std::bad_alloc();
+    }
+    chunk_header* ch = static_cast<chunk_header*> (mem);
+    ch->prev = head;
+    ch->size = size;
+    head = ch;
+    cur = static_cast<char*> (mem) + header_size;
+    end = cur + size;
+    chunks += 1;
+    if (next_chunk_size < max_chunk_size) {
+        next_chunk_size *= 2;
+    }
+}
+
+void arena::release_chunks(chunk_header* last) STATICLIB_NOEXCEPT {
+    chunk_header* ch = head;
+    while (nullptr != ch) {
+        chunk_header* prev = ch->prev;
+        if (ch != last) {
+            std::free(ch);
+        }
+        ch = prev;
+    }
+    if (nullptr == last) {
+        head = nullptr;
+        cur = nullptr;
+        end = nullptr;
+        used = 0;
+        chunks = 0;
+    }
+}
+
+} // namespace
+}
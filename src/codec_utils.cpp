@@ -0,0 +1,576 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   codec_utils.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 10:02 AM
+ */
+
+#include "staticlib/utils/codec_utils.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "staticlib/utils/cpu_features.hpp"
+
+#ifdef STATICLIB_UTILS_X86_SIMD
+#include <immintrin.h>
+#endif // STATICLIB_UTILS_X86_SIMD
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+// SIMD stores may write this many bytes past the end of decoded data
+const size_t store_slack = 32;
+
+const uint8_t invalid = 0xff;
+
+const char hex_lower[] = "0123456789abcdef";
+const char hex_upper[] = "0123456789ABCDEF";
+
+const char b64_standard_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char b64_url_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+struct decode_tables {
+    uint8_t hex[256];
+    uint8_t b64_standard[256];
+    uint8_t b64_url[256];
+    uint8_t b64_any[256];
+
+    decode_tables() {
+        std::memset(hex, invalid, sizeof(hex));
+        std::memset(b64_standard, invalid, sizeof(b64_standard));
+        std::memset(b64_url, invalid, sizeof(b64_url));
+        std::memset(b64_any, invalid, sizeof(b64_any));
+        for (uint8_t i = 0; i < 16; i++) {
+            hex[static_cast<uint8_t> (hex_lower[i])] = i;
+            hex[static_cast<uint8_t> (hex_upper[i])] = i;
+        }
+        for (uint8_t i = 0; i < 64; i++) {
+            b64_standard[static_cast<uint8_t> (b64_standard_alphabet[i])] = i;
+            b64_url[static_cast<uint8_t> (b64_url_alphabet[i])] = i;
+            b64_any[static_cast<uint8_t> (b64_standard_alphabet[i])] = i;
+            b64_any[static_cast<uint8_t> (b64_url_alphabet[i])] = i;
+        }
+    }
+};
+
+const decode_tables& tables() {
+    static decode_tables dt{};
+    return dt;
+}
+
+bool is_space(unsigned char ch) {
+    return ' ' == ch || '\t' == ch || '\r' == ch || '\n' == ch || '\f' == ch || '\v' == ch;
+}
+
+bool is_url(base64_variant variant) {
+    return base64_variant::standard != variant;
+}
+
+// appends uninitialized space to the string and returns pointer to it
+unsigned char* grow(std::string& out, size_t size) {
+    size_t prev = out.size();
+    out.resize(prev + size);
+    return reinterpret_cast<unsigned char*> (std::addressof(out.front())) + prev;
+}
+
+void shrink(std::string& out, const unsigned char* end) {
+    const unsigned char* begin = reinterpret_cast<const unsigned char*> (out.data());
+    out.resize(static_cast<size_t> (end - begin));
+}
+
+#ifdef STATICLIB_UTILS_X86_SIMD
+
+// hex, Wojciech Mula: http://0x80.pl/notesen/2022-01-17-validating-hex-parse.html
+
+__attribute__((target("ssse3")))
+size_t hex_encode_ssse3(const unsigned char* src, size_t len, unsigned char* dst, const char* alphabet) {
+    const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*> (alphabet));
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i * 2), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t hex_encode_avx2(const unsigned char* src, size_t len, unsigned char* dst, const char* alphabet) {
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (alphabet)));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, mask));
+        __m256i first = _mm256_unpacklo_epi8(hi, lo);
+        __m256i second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return i;
+}
+
+// converts 16 hex chars to nibbles, returns false if any char is not a hex digit
+__attribute__((target("ssse3")))
+inline bool hex_nibbles_ssse3(__m128i in, __m128i& nibbles) {
+    __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    if (0xffff != _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha))) {
+        return false;
+    }
+    nibbles = _mm_or_si128(_mm_and_si128(is_digit, digit),
+            _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+    return true;
+}
+
+__attribute__((target("ssse3")))
+size_t hex_decode_ssse3(const unsigned char* src, size_t len, unsigned char*& dst) {
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m128i n0, n1;
+        if (!hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i)), n0) ||
+                !hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i + 16)), n1)) {
+            break;
+        }
+        __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(n0, weights), _mm_maddubs_epi16(n1, weights));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst), bytes);
+        dst += 16;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline bool hex_nibbles_avx2(__m256i in, __m256i& nibbles) {
+    __m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    if (-1 != _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha))) {
+        return false;
+    }
+    nibbles = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+            _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+    return true;
+}
+
+__attribute__((target("avx2")))
+size_t hex_decode_avx2(const unsigned char* src, size_t len, unsigned char*& dst) {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m256i n0, n1;
+        if (!hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i)), n0) ||
+                !hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i + 32)), n1)) {
+            break;
+        }
+        __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(n0, weights), _mm256_maddubs_epi16(n1, weights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst), _mm256_permute4x64_epi64(packed, 0xd8));
+        dst += 32;
+    }
+    return i;
+}
+
+// base64, Wojciech Mula, Daniel Lemire: https://arxiv.org/abs/1704.00605
+
+__attribute__((target("ssse3")))
+inline __m128i b64_indices_ssse3(__m128i in) {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+__attribute__((target("ssse3")))
+inline __m128i b64_chars_ssse3(__m128i indices, __m128i shift_lut) {
+    __m128i res = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    res = _mm_or_si128(res, _mm_and_si128(less, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, res), indices);
+}
+
+__attribute__((target("ssse3")))
+inline __m128i b64_shift_lut_ssse3(bool url) {
+    return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, url ? '-' - 62 : '+' - 62, url ? '_' - 63 : '/' - 63, 'A', 0, 0);
+}
+
+__attribute__((target("ssse3")))
+size_t b64_encode_ssse3(const unsigned char* src, size_t len, unsigned char*& dst, bool url) {
+    const __m128i shift_lut = b64_shift_lut_ssse3(url);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 12) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst), b64_chars_ssse3(b64_indices_ssse3(in), shift_lut));
+        dst += 16;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t b64_encode_avx2(const unsigned char* src, size_t len, unsigned char*& dst, bool url) {
+    const __m256i shuf = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m256i shift_lut = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, url ? '-' - 62 : '+' - 62, url ? '_' - 63 : '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, url ? '-' - 62 : '+' - 62, url ? '_' - 63 : '/' - 63, 'A', 0, 0);
+    size_t i = 0;
+    for (; i + 28 <= len; i += 24) {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i + 12)), 1);
+        in = _mm256_shuffle_epi8(in, shuf);
+        __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t1, t3);
+        __m256i res = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        res = _mm256_or_si256(res, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        res = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, res), indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst), res);
+        dst += 32;
+    }
+    return i;
+}
+
+// validation LUTs: char is invalid if (lut_lo[low nibble] & lut_hi[high nibble]) != 0,
+// roll LUT (by high nibble) translates chars into 6-bit values, 63rd char is handled separately
+struct b64_decode_luts {
+    int8_t lo[16];
+    int8_t hi[16];
+    int8_t roll[16];
+    int8_t last;
+};
+
+const b64_decode_luts b64_luts_standard = {
+    {0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15},
+    {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+    {0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0},
+    '/'
+};
+
+const b64_decode_luts b64_luts_url = {
+    {0x0b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27},
+    {0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+    {0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0},
+    '_'
+};
+
+__attribute__((target("ssse3")))
+size_t b64_decode_ssse3(const unsigned char* src, size_t len, unsigned char*& dst, const b64_decode_luts& luts) {
+    const __m128i lut_lo = _mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.lo));
+    const __m128i lut_hi = _mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.hi));
+    const __m128i lut_roll = _mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.roll));
+    const __m128i last = _mm_set1_epi8(luts.last);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask);
+        __m128i lo = _mm_shuffle_epi8(lut_lo, _mm_and_si128(in, mask));
+        __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero))) {
+            break;
+        }
+        __m128i is_last = _mm_cmpeq_epi8(in, last);
+        __m128i values = _mm_add_epi8(in, _mm_shuffle_epi8(lut_roll, hi_nibbles));
+        values = _mm_or_si128(_mm_andnot_si128(is_last, values), _mm_and_si128(is_last, _mm_set1_epi8(63)));
+        __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        packed = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst), packed);
+        dst += 12;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t b64_decode_avx2(const unsigned char* src, size_t len, unsigned char*& dst, const b64_decode_luts& luts) {
+    const __m256i lut_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.lo)));
+    const __m256i lut_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.hi)));
+    const __m256i lut_roll = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (luts.roll)));
+    const __m256i last = _mm256_set1_epi8(luts.last);
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i shuf = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask);
+        __m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(in, mask));
+        __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        if (-1 != _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), zero))) {
+            break;
+        }
+        __m256i is_last = _mm256_cmpeq_epi8(in, last);
+        __m256i values = _mm256_add_epi8(in, _mm256_shuffle_epi8(lut_roll, hi_nibbles));
+        values = _mm256_blendv_epi8(values, _mm256_set1_epi8(63), is_last);
+        __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        packed = _mm256_shuffle_epi8(packed, shuf);
+        packed = _mm256_permutevar8x32_epi32(packed, compact);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst), packed);
+        dst += 24;
+    }
+    return i;
+}
+
+#endif // STATICLIB_UTILS_X86_SIMD
+
+size_t hex_encode_simd(const unsigned char* src, size_t len, unsigned char* dst, const char* alphabet) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return hex_encode_avx2(src, len, dst, alphabet);
+    } else if (cpu_has_ssse3()) {
+        return hex_encode_ssse3(src, len, dst, alphabet);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) alphabet;
+    return 0;
+}
+
+size_t hex_decode_simd(const unsigned char* src, size_t len, unsigned char*& dst) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return hex_decode_avx2(src, len, dst);
+    } else if (cpu_has_ssse3()) {
+        return hex_decode_ssse3(src, len, dst);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    return 0;
+}
+
+size_t b64_encode_simd(const unsigned char* src, size_t len, unsigned char*& dst, bool url) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return b64_encode_avx2(src, len, dst, url);
+    } else if (cpu_has_ssse3()) {
+        return b64_encode_ssse3(src, len, dst, url);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) url;
+    return 0;
+}
+
+size_t b64_decode_simd(const unsigned char* src, size_t len, unsigned char*& dst, bool url) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    const b64_decode_luts& luts = url ? b64_luts_url : b64_luts_standard;
+    if (cpu_has_avx2()) {
+        return b64_decode_avx2(src, len, dst, luts);
+    } else if (cpu_has_ssse3()) {
+        return b64_decode_ssse3(src, len, dst, luts);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) url;
+    return 0;
+}
+
+} // namespace
+
+void hex_encode(const char* data, size_t length, std::string& out, bool upper_case) {
+    const unsigned char* src = reinterpret_cast<const unsigned char*> (data);
+    const char* alphabet = upper_case ? hex_upper : hex_lower;
+    unsigned char* dst = grow(out, length * 2);
+    size_t i = hex_encode_simd(src, length, dst, alphabet);
+    for (; i < length; i++) {
+        dst[i * 2] = static_cast<unsigned char> (alphabet[src[i] >> 4]);
+        dst[i * 2 + 1] = static_cast<unsigned char> (alphabet[src[i] & 0x0f]);
+    }
+}
+
+std::string hex_encode(const std::string& str, bool upper_case) {
+    std::string res;
+    hex_encode(str.data(), str.length(), res, upper_case);
+    return res;
+}
+
+void hex_decode(const char* data, size_t length, std::string& out, decode_mode mode) {
+    const unsigned char* src = reinterpret_cast<const unsigned char*> (data);
+    const uint8_t* table = tables().hex;
+    size_t prev_size = out.size();
+    unsigned char* dst = grow(out, length / 2 + store_slack);
+    size_t i = hex_decode_simd(src, length, dst);
+    uint8_t hi = invalid;
+    for (; i < length; i++) {
+        if (decode_mode::lenient == mode && is_space(src[i])) {
+            continue;
+        }
+        uint8_t val = table[src[i]];
+        if (invalid == val) {
+            out.resize(prev_size);
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Invalid hex character, code: [{}], offset: [{}]", static_cast<int> (src[i]), i));
+        }
+        if (invalid == hi) {
+            hi = val;
+        } else {
+            *dst++ = static_cast<unsigned char> ((hi << 4) | val);
+            hi = invalid;
+        }
+    }
+    if (invalid != hi) {
+        out.resize(prev_size);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid hex input, odd number of digits, length: [{}]", length));
+    }
+    shrink(out, dst);
+}
+
+std::string hex_decode(const std::string& str, decode_mode mode) {
+    std::string res;
+    hex_decode(str.data(), str.length(), res, mode);
+    return res;
+}
+
+void base64_encode(const char* data, size_t length, std::string& out, base64_variant variant) {
+    const unsigned char* src = reinterpret_cast<const unsigned char*> (data);
+    const char* alphabet = is_url(variant) ? b64_url_alphabet : b64_standard_alphabet;
+    unsigned char* begin = grow(out, (length + 2) / 3 * 4);
+    unsigned char* dst = begin;
+    size_t i = b64_encode_simd(src, length, dst, is_url(variant));
+    for (; i + 3 <= length; i += 3) {
+        uint32_t triple = (static_cast<uint32_t> (src[i]) << 16) |
+                (static_cast<uint32_t> (src[i + 1]) << 8) | src[i + 2];
+        dst[0] = static_cast<unsigned char> (alphabet[(triple >> 18) & 0x3f]);
+        dst[1] = static_cast<unsigned char> (alphabet[(triple >> 12) & 0x3f]);
+        dst[2] = static_cast<unsigned char> (alphabet[(triple >> 6) & 0x3f]);
+        dst[3] = static_cast<unsigned char> (alphabet[triple & 0x3f]);
+        dst += 4;
+    }
+    size_t rem = length - i;
+    if (rem > 0) {
+        uint32_t triple = static_cast<uint32_t> (src[i]) << 16;
+        if (2 == rem) {
+            triple |= static_cast<uint32_t> (src[i + 1]) << 8;
+        }
+        *dst++ = static_cast<unsigned char> (alphabet[(triple >> 18) & 0x3f]);
+        *dst++ = static_cast<unsigned char> (alphabet[(triple >> 12) & 0x3f]);
+        if (2 == rem) {
+            *dst++ = static_cast<unsigned char> (alphabet[(triple >> 6) & 0x3f]);
+        }
+        if (base64_variant::url_unpadded != variant) {
+            *dst++ = '=';
+            if (1 == rem) {
+                *dst++ = '=';
+            }
+        }
+    }
+    shrink(out, dst);
+}
+
+std::string base64_encode(const std::string& str, base64_variant variant) {
+    std::string res;
+    base64_encode(str.data(), str.length(), res, variant);
+    return res;
+}
+
+void base64_decode(const char* data, size_t length, std::string& out, base64_variant variant, decode_mode mode) {
+    const unsigned char* src = reinterpret_cast<const unsigned char*> (data);
+    bool lenient = decode_mode::lenient == mode;
+    const decode_tables& dt = tables();
+    const uint8_t* table = lenient ? dt.b64_any : (is_url(variant) ? dt.b64_url : dt.b64_standard);
+    size_t prev_size = out.size();
+    unsigned char* dst = grow(out, length / 4 * 3 + 3 + store_slack);
+    // fast path stops on the first block with padding, whitespace or other alphabet
+    size_t i = b64_decode_simd(src, length, dst, is_url(variant));
+    uint32_t acc = 0;
+    size_t quad = 0;
+    size_t pads = 0;
+    for (; i < length; i++) {
+        unsigned char ch = src[i];
+        if (lenient && is_space(ch)) {
+            continue;
+        }
+        if ('=' == ch) {
+            pads += 1;
+            continue;
+        }
+        uint8_t val = table[ch];
+        if (invalid == val || pads > 0) {
+            out.resize(prev_size);
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Invalid Base64 character, code: [{}], offset: [{}]", static_cast<int> (ch), i));
+        }
+        acc = (acc << 6) | val;
+        quad += 1;
+        if (4 == quad) {
+            dst[0] = static_cast<unsigned char> (acc >> 16);
+            dst[1] = static_cast<unsigned char> (acc >> 8);
+            dst[2] = static_cast<unsigned char> (acc);
+            dst += 3;
+            acc = 0;
+            quad = 0;
+        }
+    }
+    size_t expected_pads = 0 == quad ? 0 : 4 - quad;
+    bool pads_valid = lenient ? (0 == pads || expected_pads == pads) :
+            (base64_variant::url_unpadded == variant ? 0 == pads : expected_pads == pads);
+    bool trailing_valid = lenient || (2 == quad && 0 == (acc & 0x0f)) || (3 == quad && 0 == (acc & 0x03)) || 0 == quad;
+    if (1 == quad || !pads_valid || !trailing_valid) {
+        out.resize(prev_size);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid Base64 input ending, length: [{}], padding: [{}]", length, pads));
+    }
+    if (2 == quad) {
+        *dst++ = static_cast<unsigned char> (acc >> 4);
+    } else if (3 == quad) {
+        *dst++ = static_cast<unsigned char> (acc >> 10);
+        *dst++ = static_cast<unsigned char> (acc >> 2);
+    }
+    shrink(out, dst);
+}
+
+std::string base64_decode(const std::string& str, base64_variant variant, decode_mode mode) {
+    std::string res;
+    base64_decode(str.data(), str.length(), res, variant, mode);
+    return res;
+}
+
+} // namespace
+}
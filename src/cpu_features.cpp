@@ -0,0 +1,73 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   cpu_features.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 9:44 AM
+ */
+
+#include "staticlib/utils/cpu_features.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+// "STATICLIB_UTILS_SIMD=scalar|ssse3" env var limits the kernels used, intended for testing
+int simd_limit() {
+    const char* env = std::getenv("STATICLIB_UTILS_SIMD");
+    if (nullptr == env) {
+        return 2;
+    } else if (0 == std::strcmp(env, "scalar")) {
+        return 0;
+    } else if (0 == std::strcmp(env, "ssse3")) {
+        return 1;
+    }
+    return 2;
+}
+
+bool detect(int level) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (simd_limit() < level) {
+        return false;
+    }
+    return 1 == level ? 0 != __builtin_cpu_supports("ssse3") : 0 != __builtin_cpu_supports("avx2");
+#else
+    (void) simd_limit;
+    (void) level;
+    return false;
+#endif // STATICLIB_UTILS_X86_SIMD
+}
+
+} // namespace
+
+bool cpu_has_ssse3() STATICLIB_NOEXCEPT {
+    static const bool res = detect(1);
+    return res;
+}
+
+bool cpu_has_avx2() STATICLIB_NOEXCEPT {
+    static const bool res = detect(2);
+    return res;
+}
+
+} // namespace
+}
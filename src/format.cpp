@@ -0,0 +1,228 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   format.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 10:50 AM
+ */
+
+#include "staticlib/utils/format.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const size_t error_text_size = 128;
+
+// strerror_r is GNU-specific (returns pointer) or XSI-compliant (returns code)
+struct strerror_adapter {
+    static const char* result(int res, const char* buf) {
+        return 0 == res ? buf : "Unknown error";
+    }
+
+    static const char* result(const char* res, const char*) {
+        return res;
+    }
+};
+
+} // namespace
+
+format_buffer::format_buffer() STATICLIB_NOEXCEPT :
+buf(inline_data),
+len(0),
+cap(inline_capacity) {
+    inline_data[0] = '\0';
+}
+
+format_buffer::format_buffer(const format_buffer& other) :
+format_buffer() {
+    append(other.buf, other.len);
+}
+
+format_buffer& format_buffer::operator=(const format_buffer& other) {
+    if (this != std::addressof(other)) {
+        len = 0;
+        buf[0] = '\0';
+        append(other.buf, other.len);
+    }
+    return *this;
+}
+
+format_buffer::format_buffer(format_buffer&& other) STATICLIB_NOEXCEPT :
+format_buffer() {
+    *this = std::move(other);
+}
+
+format_buffer& format_buffer::operator=(format_buffer&& other) STATICLIB_NOEXCEPT {
+    if (this == std::addressof(other)) {
+        return *this;
+    }
+    if (buf != inline_data) {
+        delete[] buf;
+    }
+    if (other.buf != other.inline_data) {
+        buf = other.buf;
+        cap = other.cap;
+    } else {
+        buf = inline_data;
+        cap = inline_capacity;
+        std::memcpy(inline_data, other.inline_data, other.len + 1);
+    }
+    len = other.len;
+    other.buf = other.inline_data;
+    other.cap = inline_capacity;
+    other.len = 0;
+    other.inline_data[0] = '\0';
+    return *this;
+}
+
+format_buffer::~format_buffer() STATICLIB_NOEXCEPT {
+    if (buf != inline_data) {
+        delete[] buf;
+    }
+}
+
+void format_buffer::append(const char* data, size_t length) {
+    if (len + length + 1 > cap) {
+        grow(len + length + 1);
+    }
+    std::memcpy(buf + len, data, length);
+    len += length;
+    buf[len] = '\0';
+}
+
+const char* format_buffer::c_str() const STATICLIB_NOEXCEPT {
+    return buf;
+}
+
+size_t format_buffer::length() const STATICLIB_NOEXCEPT {
+    return len;
+}
+
+bool format_buffer::is_inline() const STATICLIB_NOEXCEPT {
+    return buf == inline_data;
+}
+
+std::string format_buffer::str() const {
+    return std::string(buf, len);
+}
+
+void format_buffer::grow(size_t min_capacity) {
+    size_t new_cap = cap * 2;
+    while (new_cap < min_capacity) {
+        new_cap *= 2;
+    }
+    char* new_buf = new char[new_cap];
+    std::memcpy(new_buf, buf, len + 1);
+    if (buf != inline_data) {
+        delete[] buf;
+    }
+    buf = new_buf;
+    cap = new_cap;
+}
+
+void format_arg(format_buffer& buf, const char* str) {
+    if (nullptr == str) {
+        buf.append("null", 4);
+    } else {
+        buf.append(str, std::strlen(str));
+    }
+}
+
+void format_arg(format_buffer& buf, const std::string& str) {
+    buf.append(str.data(), str.length());
+}
+
+void format_arg(format_buffer& buf, char ch) {
+    buf.append(std::addressof(ch), 1);
+}
+
+void format_arg(format_buffer& buf, bool val) {
+    if (val) {
+        buf.append("true", 4);
+    } else {
+        buf.append("false", 5);
+    }
+}
+
+void format_arg(format_buffer& buf, double val) {
+    char tmp[32];
+    int res = std::snprintf(tmp, sizeof(tmp), "%g", val);
+    if (res > 0) {
+        buf.append(tmp, static_cast<size_t> (res));
+    }
+}
+
+void format_arg(format_buffer& buf, errno_text err) {
+    char tmp[error_text_size];
+    tmp[0] = '\0';
+#ifdef STATICLIB_WINDOWS
+    const char* text = 0 == ::strerror_s(tmp, sizeof(tmp), err.code) ? tmp : "Unknown error";
+#else
+    const char* text = strerror_adapter::result(::strerror_r(err.code, tmp, sizeof(tmp)), tmp);
+#endif // STATICLIB_WINDOWS
+    format_arg(buf, text);
+}
+
+namespace detail {
+
+void format_signed(format_buffer& buf, long long val) {
+    // negation is done on unsigned type to handle the min value
+    unsigned long long uval = static_cast<unsigned long long> (val);
+    if (val < 0) {
+        buf.append("-", 1);
+        uval = 0 - uval;
+    }
+    format_unsigned(buf, uval);
+}
+
+void format_unsigned(format_buffer& buf, unsigned long long val) {
+    char tmp[24];
+    char* end = tmp + sizeof(tmp);
+    char* ptr = end;
+    do {
+        ptr -= 1;
+        *ptr = static_cast<char> ('0' + val % 10);
+        val /= 10;
+    } while (val > 0);
+    buf.append(ptr, static_cast<size_t> (end - ptr));
+}
+
+const char* find_placeholder(const char* fmt) STATICLIB_NOEXCEPT {
+    const char* ptr = fmt;
+    while ('\0' != *ptr && !('{' == ptr[0] && '}' == ptr[1])) {
+        ptr += 1;
+    }
+    return ptr;
+}
+
+void append_tail(format_buffer& buf, const char* fmt) {
+    buf.append(fmt, std::strlen(fmt));
+}
+
+} // namespace
+
+} // namespace
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   hash_utils.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:24 PM
+ */
+
+#include "staticlib/utils/hash_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif // _MSC_VER && _M_X64
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+// wyhash final version 4, public domain: https://github.com/wangyi-fudan/wyhash
+
+const uint64_t secret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+const size_t block_size = 48;
+
+const size_t history_size = 16;
+
+const size_t lower_buf_size = 256;
+
+inline void mum(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = static_cast<__uint128_t> (a) * b;
+    a = static_cast<uint64_t> (r);
+    b = static_cast<uint64_t> (r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, std::addressof(b));
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t> (a), lb = static_cast<uint32_t> (b);
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    uint64_t c = t < rl ? 1 : 0;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t ? 1 : 0;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    a = lo;
+    b = hi;
+#endif
+}
+
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    mum(a, b);
+    return a ^ b;
+}
+
+inline uint64_t read8(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(std::addressof(v), p, 8);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+inline uint64_t read4(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(std::addressof(v), p, 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    v = __builtin_bswap32(v);
+#endif
+    return v;
+}
+
+inline uint64_t read3(const unsigned char* p, size_t k) {
+    return (static_cast<uint64_t> (p[0]) << 16) | (static_cast<uint64_t> (p[k >> 1]) << 8) | p[k - 1];
+}
+
+inline uint64_t init_seed(uint64_t seed) {
+    return seed ^ mix(seed ^ secret[0], secret[1]);
+}
+
+inline void process_block(const unsigned char* p, uint64_t& seed, uint64_t& see1, uint64_t& see2) {
+    seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+    see1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ see1);
+    see2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ see2);
+}
+
+// "p" points to the last "i" bytes of input, 16 bytes before "p" must be readable if i < 16
+inline uint64_t finish(const unsigned char* p, size_t i, uint64_t len, uint64_t seed) {
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+            b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) {
+            a = read3(p, static_cast<size_t> (len));
+        }
+    } else {
+        while (i > 16) {
+            seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    mum(a, b);
+    return mix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+inline unsigned char to_lower(unsigned char ch) {
+    return (ch >= 'A' && ch <= 'Z') ? static_cast<unsigned char> (ch + ('a' - 'A')) : ch;
+}
+
+} // namespace
+
+uint64_t hash64(const char* data, size_t length, uint64_t seed) STATICLIB_NOEXCEPT {
+    const unsigned char* p = reinterpret_cast<const unsigned char*> (data);
+    seed = init_seed(seed);
+    size_t i = length;
+    if (i > block_size) {
+        uint64_t see1 = seed;
+        uint64_t see2 = seed;
+        do {
+            process_block(p, seed, see1, see2);
+            p += block_size;
+            i -= block_size;
+        } while (i > block_size);
+        seed ^= see1 ^ see2;
+    }
+    return finish(p, i, length, seed);
+}
+
+uint64_t hash64(const std::string& str, uint64_t seed) STATICLIB_NOEXCEPT {
+    return hash64(str.data(), str.length(), seed);
+}
+
+uint64_t ihash64(const char* data, size_t length, uint64_t seed) STATICLIB_NOEXCEPT {
+    unsigned char lower[lower_buf_size];
+    if (length <= lower_buf_size) {
+        for (size_t i = 0; i < length; i++) {
+            lower[i] = to_lower(static_cast<unsigned char> (data[i]));
+        }
+        return hash64(reinterpret_cast<const char*> (lower), length, seed);
+    }
+    hash64_stream stream{seed};
+    for (size_t off = 0; off < length; off += lower_buf_size) {
+        size_t chunk = std::min(lower_buf_size, length - off);
+        for (size_t i = 0; i < chunk; i++) {
+            lower[i] = to_lower(static_cast<unsigned char> (data[off + i]));
+        }
+        stream.update(reinterpret_cast<const char*> (lower), chunk);
+    }
+    return stream.digest();
+}
+
+uint64_t ihash64(const std::string& str, uint64_t seed) STATICLIB_NOEXCEPT {
+    return ihash64(str.data(), str.length(), seed);
+}
+
+hash64_stream::hash64_stream(uint64_t seed) STATICLIB_NOEXCEPT {
+    reset(seed);
+}
+
+void hash64_stream::reset(uint64_t seed) STATICLIB_NOEXCEPT {
+    this->seed = init_seed(seed);
+    this->see1 = this->seed;
+    this->see2 = this->seed;
+    this->total = 0;
+    this->pending = 0;
+    this->bulk = false;
+    std::memset(buf, '\0', sizeof(buf));
+}
+
+hash64_stream& hash64_stream::update(const char* data, size_t length) STATICLIB_NOEXCEPT {
+    const unsigned char* p = reinterpret_cast<const unsigned char*> (data);
+    total += length;
+    while (length > 0) {
+        // block is processed only when it is known that more data follows it
+        if (block_size == pending) {
+            process_block(buf + history_size, seed, see1, see2);
+            std::memcpy(buf, buf + history_size + block_size - history_size, history_size);
+            pending = 0;
+            bulk = true;
+        }
+        if (0 == pending) {
+            while (length > block_size) {
+                process_block(p, seed, see1, see2);
+                std::memcpy(buf, p + block_size - history_size, history_size);
+                bulk = true;
+                p += block_size;
+                length -= block_size;
+            }
+        }
+        size_t take = std::min(block_size - pending, length);
+        std::memcpy(buf + history_size + pending, p, take);
+        pending += take;
+        p += take;
+        length -= take;
+    }
+    return *this;
+}
+
+hash64_stream& hash64_stream::update(const std::string& str) STATICLIB_NOEXCEPT {
+    return update(str.data(), str.length());
+}
+
+uint64_t hash64_stream::digest() const STATICLIB_NOEXCEPT {
+    uint64_t sd = seed;
+    if (bulk) {
+        sd ^= see1 ^ see2;
+    }
+    return finish(buf + history_size, pending, total, sd);
+}
+
+} // namespace
+}
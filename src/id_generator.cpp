@@ -0,0 +1,253 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   id_generator.cpp
+ * Author: alex
+ *
+ * Created on October 27, 2026, 11:25 AM
+ */
+
+#include "staticlib/utils/id_generator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <random>
+
+#ifdef STATICLIB_LINUX
+#include <pthread.h>
+#endif // STATICLIB_LINUX
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+// two hex digits for each byte value
+const char hex_pairs[] =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+// offsets of the bytes in the canonical string form
+const uint8_t format_offsets[16] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+const uint64_t v7_counter_bits = 42;
+
+uint64_t rotl(uint64_t x, int k) STATICLIB_NOEXCEPT {
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t splitmix64(uint64_t& x) STATICLIB_NOEXCEPT {
+    x += 0x9e3779b97f4a7c15ULL;
+    uint64_t z = x;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t random_device_word(std::random_device& rd) {
+    uint64_t res = rd();
+    res = (res << 32) ^ rd();
+    return res;
+}
+
+uint64_t current_millis() STATICLIB_NOEXCEPT {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return static_cast<uint64_t> (std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+}
+
+#ifdef STATICLIB_LINUX
+// forked child must not repeat IDs of the parent
+std::atomic<uint32_t> fork_generation{0};
+
+void on_fork_child() {
+    fork_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t current_fork_generation() {
+    static bool registered = (pthread_atfork(nullptr, nullptr, on_fork_child), true);
+    (void) registered;
+    return fork_generation.load(std::memory_order_relaxed);
+}
+#else
+uint32_t current_fork_generation() {
+    return 0;
+}
+#endif // STATICLIB_LINUX
+
+id_generator& local_generator() {
+    static thread_local id_generator gen;
+    static thread_local uint32_t generation = current_fork_generation();
+    uint32_t current = current_fork_generation();
+    if (current != generation) {
+        gen.reseed();
+        generation = current;
+    }
+    return gen;
+}
+
+} // namespace
+
+uuid uuid::from_halves(uint64_t high, uint64_t low) STATICLIB_NOEXCEPT {
+    uuid res;
+    for (size_t i = 0; i < 8; i++) {
+        res.bytes[i] = static_cast<uint8_t> (high >> (56 - 8 * i));
+        res.bytes[i + 8] = static_cast<uint8_t> (low >> (56 - 8 * i));
+    }
+    return res;
+}
+
+int uuid::version() const STATICLIB_NOEXCEPT {
+    return bytes[6] >> 4;
+}
+
+void uuid::format(char* out) const STATICLIB_NOEXCEPT {
+    for (size_t i = 0; i < 16; i++) {
+        const char* pair = hex_pairs + 2 * bytes[i];
+        out[format_offsets[i]] = pair[0];
+        out[format_offsets[i] + 1] = pair[1];
+    }
+    out[8] = '-';
+    out[13] = '-';
+    out[18] = '-';
+    out[23] = '-';
+}
+
+std::string uuid::to_string() const {
+    char buf[string_length];
+    format(buf);
+    return std::string(buf, string_length);
+}
+
+bool uuid::operator==(const uuid& other) const STATICLIB_NOEXCEPT {
+    return 0 == std::memcmp(bytes, other.bytes, sizeof(bytes));
+}
+
+bool uuid::operator!=(const uuid& other) const STATICLIB_NOEXCEPT {
+    return !(*this == other);
+}
+
+bool uuid::operator<(const uuid& other) const STATICLIB_NOEXCEPT {
+    return std::memcmp(bytes, other.bytes, sizeof(bytes)) < 0;
+}
+
+id_generator::id_generator() :
+last_millis(0),
+v7_counter(0) {
+    reseed();
+}
+
+id_generator::id_generator(uint64_t seed) STATICLIB_NOEXCEPT :
+last_millis(0),
+v7_counter(0) {
+    seed_random(seed);
+}
+
+uuid id_generator::generate_v4() STATICLIB_NOEXCEPT {
+    uint64_t high = next_random();
+    uint64_t low = next_random();
+    high = (high & 0xffffffffffff0fffULL) | 0x0000000000004000ULL;
+    low = (low & 0x3fffffffffffffffULL) | 0x8000000000000000ULL;
+    return uuid::from_halves(high, low);
+}
+
+uuid id_generator::generate_v7() STATICLIB_NOEXCEPT {
+    uint64_t rnd = next_random();
+    uint64_t now = current_millis();
+    if (now > last_millis) {
+        last_millis = now;
+        // most significant bit is left clear to have room for increments
+        v7_counter = (rnd >> 32) & ((1ULL << (v7_counter_bits - 1)) - 1);
+    } else {
+        v7_counter += 1;
+        if (0 != (v7_counter >> v7_counter_bits)) {
+            // counter overflow, borrow from the next millisecond
+            last_millis += 1;
+            v7_counter = (rnd >> 32) & ((1ULL << (v7_counter_bits - 1)) - 1);
+        }
+    }
+    uint64_t high = ((last_millis & 0xffffffffffffULL) << 16) | 0x7000ULL | (v7_counter >> 30);
+    uint64_t low = 0x8000000000000000ULL | ((v7_counter & 0x3fffffffULL) << 32) | (rnd & 0xffffffffULL);
+    return uuid::from_halves(high, low);
+}
+
+uuid id_generator::generate_sequential() STATICLIB_NOEXCEPT {
+    uint64_t low = 0x8000000000000000ULL | (sequence & 0x3fffffffffffffffULL);
+    sequence += 1;
+    return uuid::from_halves(instance_high, low);
+}
+
+// xoshiro256**, see: https://prng.di.unimi.it/xoshiro256starstar.c
+uint64_t id_generator::next_random() STATICLIB_NOEXCEPT {
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+// each state word is drawn separately, so the state gets up to 256 bits of entropy
+void id_generator::reseed() {
+    std::random_device rd;
+    uint64_t any = 0;
+    for (size_t i = 0; i < 4; i++) {
+        state[i] = random_device_word(rd);
+        any |= state[i];
+    }
+    if (0 == any) {
+        // all-zero state is the fixed point of xoshiro
+        state[0] = 1;
+    }
+    seed_sequence();
+}
+
+void id_generator::seed_random(uint64_t value) STATICLIB_NOEXCEPT {
+    for (size_t i = 0; i < 4; i++) {
+        state[i] = splitmix64(value);
+    }
+    seed_sequence();
+}
+
+void id_generator::seed_sequence() STATICLIB_NOEXCEPT {
+    instance_high = (next_random() & 0xffffffffffff0fffULL) | 0x0000000000008000ULL;
+    sequence = next_random() >> 2;
+}
+
+uuid generate_uuid_v4() {
+    return local_generator().generate_v4();
+}
+
+uuid generate_uuid_v7() {
+    return local_generator().generate_v7();
+}
+
+uuid generate_uuid_sequential() {
+    return local_generator().generate_sequential();
+}
+
+} // namespace
+}
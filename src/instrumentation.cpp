@@ -0,0 +1,280 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   instrumentation.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 10:05 AM
+ */
+
+#include "staticlib/utils/instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include "staticlib/utils/utils_exception.hpp"
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+struct totals {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t total_ns;
+    std::array<uint64_t, instrumentation_latency_buckets> histogram;
+};
+
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+
+// written only by the owning thread, so plain load and store
+// are used instead of the read-modify-write operations
+struct alignas(64) function_counters {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> total_ns;
+    std::array<std::atomic<uint64_t>, instrumentation_latency_buckets> histogram;
+};
+
+struct thread_counters;
+
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+
+struct stats_registry {
+    std::mutex mutex;
+    std::vector<const char*> names;
+    std::array<totals, instrumentation_max_functions> baseline;
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+    std::vector<thread_counters*> threads;
+    std::array<totals, instrumentation_max_functions> retired;
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+
+    stats_registry() {
+        baseline.fill(totals());
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+        retired.fill(totals());
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+    }
+};
+
+// never destroyed, threads may exit after the static destructors have run
+stats_registry& registry() {
+    static stats_registry* reg = new stats_registry();
+    return *reg;
+}
+
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+
+void add_totals(totals& to, const totals& from) {
+    to.calls += from.calls;
+    to.bytes += from.bytes;
+    to.total_ns += from.total_ns;
+    for (size_t i = 0; i < instrumentation_latency_buckets; i++) {
+        to.histogram[i] += from.histogram[i];
+    }
+}
+
+void add_counter(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+totals load_totals(const function_counters& fc) {
+    totals res;
+    res.calls = fc.calls.load(std::memory_order_relaxed);
+    res.bytes = fc.bytes.load(std::memory_order_relaxed);
+    res.total_ns = fc.total_ns.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < instrumentation_latency_buckets; i++) {
+        res.histogram[i] = fc.histogram[i].load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+struct thread_counters {
+    std::array<function_counters, instrumentation_max_functions> functions;
+
+    thread_counters() {
+        for (function_counters& fc : functions) {
+            fc.calls.store(0, std::memory_order_relaxed);
+            fc.bytes.store(0, std::memory_order_relaxed);
+            fc.total_ns.store(0, std::memory_order_relaxed);
+            for (auto& bucket : fc.histogram) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+        stats_registry& reg = registry();
+        std::lock_guard<std::mutex> guard{reg.mutex};
+        reg.threads.push_back(this);
+    }
+
+    // counters of the exited thread are kept in the registry
+    ~thread_counters() {
+        stats_registry& reg = registry();
+        std::lock_guard<std::mutex> guard{reg.mutex};
+        for (size_t i = 0; i < functions.size(); i++) {
+            add_totals(reg.retired[i], load_totals(functions[i]));
+        }
+        reg.threads.erase(std::remove(reg.threads.begin(), reg.threads.end(), this), reg.threads.end());
+    }
+};
+
+thread_counters& local_counters() {
+    thread_local thread_counters tc;
+    return tc;
+}
+
+size_t latency_bucket(uint64_t ns) {
+    size_t bucket = 0;
+    while (ns > 1 && bucket < instrumentation_latency_buckets - 1) {
+        ns >>= 1;
+        bucket += 1;
+    }
+    return bucket;
+}
+
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+
+// collects totals under registry lock
+std::vector<totals> collect_totals(stats_registry& reg) {
+    std::vector<totals> res;
+    res.resize(reg.names.size(), totals());
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+    for (size_t i = 0; i < res.size(); i++) {
+        add_totals(res[i], reg.retired[i]);
+        for (thread_counters* tc : reg.threads) {
+            add_totals(res[i], load_totals(tc->functions[i]));
+        }
+    }
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+    return res;
+}
+
+uint64_t subtract(uint64_t value, uint64_t baseline) {
+    return value > baseline ? value - baseline : 0;
+}
+
+// upper bound of the histogram bucket that contains the specified quantile
+uint64_t quantile_upper_bound(const function_stats& st, double quantile) {
+    uint64_t target = static_cast<uint64_t> (static_cast<double> (st.calls) * quantile);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < instrumentation_latency_buckets; i++) {
+        cumulative += st.latency_histogram[i];
+        if (cumulative > target || cumulative == st.calls) {
+            return static_cast<uint64_t> (2) << i;
+        }
+    }
+    return static_cast<uint64_t> (2) << (instrumentation_latency_buckets - 1);
+}
+
+} // namespace
+
+instrumented_function::instrumented_function(const char* name) {
+    stats_registry& reg = registry();
+    std::lock_guard<std::mutex> guard{reg.mutex};
+    for (size_t i = 0; i < reg.names.size(); i++) {
+        if (0 == std::string(name).compare(reg.names[i])) {
+            idx = i;
+            return;
+        }
+    }
+    if (reg.names.size() >= instrumentation_max_functions) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+                "Max number of instrumented functions exceeded, name:", name, std::strlen(name));
+    }
+    idx = reg.names.size();
+    reg.names.push_back(name);
+}
+
+void record_call(const instrumented_function& fun, uint64_t bytes, uint64_t elapsed_ns) STATICLIB_NOEXCEPT {
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+    function_counters& fc = local_counters().functions[fun.index()];
+    add_counter(fc.calls, 1);
+    add_counter(fc.bytes, bytes);
+    add_counter(fc.total_ns, elapsed_ns);
+    add_counter(fc.histogram[latency_bucket(elapsed_ns)], 1);
+#else
+    (void) fun;
+    (void) bytes;
+    (void) elapsed_ns;
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+}
+
+bool instrumentation_enabled() STATICLIB_NOEXCEPT {
+#ifdef STATICLIB_UTILS_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif // STATICLIB_UTILS_INSTRUMENTATION
+}
+
+std::vector<function_stats> dump_stats() {
+    stats_registry& reg = registry();
+    std::lock_guard<std::mutex> guard{reg.mutex};
+    std::vector<totals> current = collect_totals(reg);
+    std::vector<function_stats> res;
+    res.reserve(current.size());
+    for (size_t i = 0; i < current.size(); i++) {
+        const totals& cur = current[i];
+        const totals& base = reg.baseline[i];
+        function_stats st;
+        st.name = reg.names[i];
+        st.calls = subtract(cur.calls, base.calls);
+        st.bytes = subtract(cur.bytes, base.bytes);
+        st.total_ns = subtract(cur.total_ns, base.total_ns);
+        for (size_t j = 0; j < instrumentation_latency_buckets; j++) {
+            st.latency_histogram[j] = subtract(cur.histogram[j], base.histogram[j]);
+        }
+        res.push_back(std::move(st));
+    }
+    return res;
+}
+
+void reset_stats() {
+    stats_registry& reg = registry();
+    std::lock_guard<std::mutex> guard{reg.mutex};
+    std::vector<totals> current = collect_totals(reg);
+    for (size_t i = 0; i < current.size(); i++) {
+        reg.baseline[i] = current[i];
+    }
+}
+
+std::string format_stats(const std::vector<function_stats>& stats) {
+    std::string res;
+    char buf[256];
+    std::snprintf(buf, sizeof(buf), "%-32s %14s %16s %12s %12s %12s\n",
+            "function", "calls", "bytes", "mean ns", "p50 ns <=", "p99 ns <=");
+    res.append(buf);
+    for (const function_stats& st : stats) {
+        if (0 == st.calls) {
+            continue;
+        }
+        std::snprintf(buf, sizeof(buf), "%-32s %14llu %16llu %12llu %12llu %12llu\n", st.name.c_str(),
+                static_cast<unsigned long long> (st.calls),
+                static_cast<unsigned long long> (st.bytes),
+                static_cast<unsigned long long> (st.total_ns / st.calls),
+                static_cast<unsigned long long> (quantile_upper_bound(st, 0.5)),
+                static_cast<unsigned long long> (quantile_upper_bound(st, 0.99)));
+        res.append(buf);
+    }
+    return res;
+}
+
+} // namespace
+}
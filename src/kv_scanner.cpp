@@ -0,0 +1,120 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   kv_scanner.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:21 PM
+ */
+
+#include "staticlib/utils/kv_scanner.hpp"
+
+#include <cstring>
+
+#include "staticlib/utils/url_utils.hpp"
+
+namespace staticlib {
+namespace utils {
+
+std::string kv_pair::raw_key() const {
+    return std::string(key, key_length);
+}
+
+std::string kv_pair::raw_value() const {
+    return std::string(value, value_length);
+}
+
+std::string kv_pair::decoded_key() const {
+    if (!key_encoded) {
+        return raw_key();
+    }
+    std::string res;
+    url_decode(key, key_length, res);
+    return res;
+}
+
+std::string kv_pair::decoded_value() const {
+    std::string res;
+    decode_value(res);
+    return res;
+}
+
+void kv_pair::decode_value(std::string& out) const {
+    if (value_encoded) {
+        url_decode(value, value_length, out);
+    } else {
+        out.append(value, value_length);
+    }
+}
+
+bool kv_pair::key_equals(const std::string& str) const STATICLIB_NOEXCEPT {
+    return str.length() == key_length && 0 == std::memcmp(str.data(), key, key_length);
+}
+
+kv_scanner::kv_scanner(const char* data, size_t length, char pair_separator,
+        char kv_separator) STATICLIB_NOEXCEPT :
+cur(data),
+end(data + length),
+pair_sep(pair_separator),
+kv_sep(kv_separator) { }
+
+kv_scanner::kv_scanner(const std::string& str, char pair_separator,
+        char kv_separator) STATICLIB_NOEXCEPT :
+kv_scanner(str.data(), str.length(), pair_separator, kv_separator) { }
+
+bool kv_scanner::next(kv_pair& out) STATICLIB_NOEXCEPT {
+    // skip empty pairs
+    while (cur < end && pair_sep == *cur) {
+        ++cur;
+    }
+    if (cur >= end) {
+        return false;
+    }
+    out.key = cur;
+    out.value = nullptr;
+    out.key_encoded = false;
+    out.value_encoded = false;
+    bool in_value = false;
+    bool encoded = false;
+    for (; cur < end; ++cur) {
+        char ch = *cur;
+        if (pair_sep == ch) {
+            break;
+        } else if (kv_sep == ch && !in_value) {
+            out.key_length = static_cast<size_t> (cur - out.key);
+            out.key_encoded = encoded;
+            out.value = cur + 1;
+            in_value = true;
+            encoded = false;
+        } else if ('%' == ch || '+' == ch) {
+            encoded = true;
+        }
+    }
+    if (in_value) {
+        out.value_length = static_cast<size_t> (cur - out.value);
+        out.value_encoded = encoded;
+    } else {
+        out.key_length = static_cast<size_t> (cur - out.key);
+        out.key_encoded = encoded;
+        out.value = cur;
+        out.value_length = 0;
+    }
+    return true;
+}
+
+} // namespace
+}
@@ -0,0 +1,380 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   latency_histogram.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 2:45 PM
+ */
+
+#include "staticlib/utils/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const char serialized_magic[] = {'S', 'L', 'H', 'G'};
+const uint8_t serialized_version = 1;
+const size_t shard_header = 2;
+const size_t max_shards = 64;
+// counters per cache line
+const size_t line_counters = 8;
+const size_t cache_line_size = line_counters * sizeof(uint64_t);
+
+std::atomic<size_t> next_thread_id{0};
+
+size_t current_thread_id() STATICLIB_NOEXCEPT {
+    static thread_local size_t id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+uint32_t highest_bit(uint64_t value) STATICLIB_NOEXCEPT {
+#ifdef _MSC_VER
+    unsigned long res;
+    _BitScanReverse64(std::addressof(res), value);
+    return static_cast<uint32_t> (res);
+#else
+    return static_cast<uint32_t> (63 - __builtin_clzll(value));
+#endif // _MSC_VER
+}
+
+void write_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char> ((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char> (value));
+}
+
+uint64_t read_varint(const char* data, size_t length, size_t& pos) {
+    uint64_t res = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7) {
+        if (pos >= length) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Truncated serialized histogram");
+        }
+        uint8_t byte = static_cast<uint8_t> (data[pos++]);
+        uint64_t bits = byte & 0x7f;
+        if (shift == 63 && bits > 1) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid varint in serialized histogram");
+        }
+        res |= bits << shift;
+        if (0 == (byte & 0x80)) {
+            return res;
+        }
+    }
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid varint in serialized histogram");
+}
+
+} // namespace
+
+latency_histogram::latency_histogram(uint64_t max_value, uint32_t precision_bits, size_t shards_count) :
+max_val(max_value),
+precision(precision_bits),
+buckets(0),
+shard_stride(0),
+shards(shards_count),
+counts(nullptr) {
+    if (precision_bits < 1 || precision_bits > 16) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid histogram precision bits: [{}], must be from 1 to 16", precision_bits));
+    }
+    if (max_value < 1) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid histogram max value: [0]");
+    }
+    if (0 == shards) {
+        shards = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    shards = std::min(shards, max_shards);
+    buckets = bucket_index(max_val) + 1;
+    shard_stride = (shard_header + buckets + line_counters - 1) / line_counters * line_counters;
+    size_t total = shards * shard_stride;
+    // new[] does not over-align in C++11, storage is over-allocated so that
+    // each shard starts at the cache line boundary
+    storage.reset(new char[total * sizeof(uint64_t) + cache_line_size]);
+    size_t addr = reinterpret_cast<size_t> (storage.get());
+    size_t offset = (cache_line_size - addr % cache_line_size) % cache_line_size;
+    counts = reinterpret_cast<std::atomic<uint64_t>*> (storage.get() + offset);
+    for (size_t i = 0; i < total; i++) {
+        new (counts + i) std::atomic<uint64_t>(0);
+    }
+}
+
+latency_histogram::latency_histogram(latency_histogram&& other) STATICLIB_NOEXCEPT :
+max_val(other.max_val),
+precision(other.precision),
+buckets(other.buckets),
+shard_stride(other.shard_stride),
+shards(other.shards),
+storage(std::move(other.storage)),
+counts(other.counts) {
+    other.buckets = 0;
+    other.shards = 0;
+    other.counts = nullptr;
+}
+
+latency_histogram& latency_histogram::operator=(latency_histogram&& other) STATICLIB_NOEXCEPT {
+    max_val = other.max_val;
+    precision = other.precision;
+    buckets = other.buckets;
+    shard_stride = other.shard_stride;
+    shards = other.shards;
+    storage = std::move(other.storage);
+    counts = other.counts;
+    other.buckets = 0;
+    other.shards = 0;
+    other.counts = nullptr;
+    return *this;
+}
+
+void latency_histogram::record(uint64_t value, uint64_t count) STATICLIB_NOEXCEPT {
+    if (0 == shards) {
+        return;
+    }
+    if (value > max_val) {
+        value = max_val;
+    }
+    size_t base = (current_thread_id() % shards) * shard_stride;
+    counts[base].fetch_add(count, std::memory_order_relaxed);
+    counts[base + 1].fetch_add(value * count, std::memory_order_relaxed);
+    counts[base + shard_header + bucket_index(value)].fetch_add(count, std::memory_order_relaxed);
+}
+
+uint64_t latency_histogram::count() const STATICLIB_NOEXCEPT {
+    uint64_t res = 0;
+    for (size_t i = 0; i < shards; i++) {
+        res += counts[i * shard_stride].load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+double latency_histogram::mean() const STATICLIB_NOEXCEPT {
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < shards; i++) {
+        total += counts[i * shard_stride].load(std::memory_order_relaxed);
+        sum += counts[i * shard_stride + 1].load(std::memory_order_relaxed);
+    }
+    return total > 0 ? static_cast<double> (sum) / static_cast<double> (total) : 0;
+}
+
+uint64_t latency_histogram::min() const STATICLIB_NOEXCEPT {
+    for (size_t i = 0; i < buckets; i++) {
+        if (bucket_total(i) > 0) {
+            return bucket_lowest(i);
+        }
+    }
+    return 0;
+}
+
+uint64_t latency_histogram::max() const STATICLIB_NOEXCEPT {
+    for (size_t i = buckets; i > 0; i--) {
+        if (bucket_total(i - 1) > 0) {
+            return std::min(bucket_highest(i - 1), max_val);
+        }
+    }
+    return 0;
+}
+
+uint64_t latency_histogram::value_at_percentile(double percentile) const STATICLIB_NOEXCEPT {
+    uint64_t total = count();
+    if (0 == total) {
+        return 0;
+    }
+    double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t> (std::ceil(clamped / 100.0 * static_cast<double> (total)));
+    rank = std::max(rank, static_cast<uint64_t> (1));
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        cumulative += bucket_total(i);
+        if (cumulative >= rank) {
+            return std::min(bucket_highest(i), max_val);
+        }
+    }
+    // concurrent recording may make bucket totals exceed the count read above
+    return max();
+}
+
+void latency_histogram::merge(const latency_histogram& other) {
+    if (max_val != other.max_val || precision != other.precision) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Cannot merge histograms with different layouts, max value: [{}], other max value: [{}],"
+                " precision bits: [{}], other precision bits: [{}]",
+                max_val, other.max_val, precision, other.precision));
+    }
+    if (0 == shards) {
+        return;
+    }
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < other.shards; i++) {
+        total += other.counts[i * other.shard_stride].load(std::memory_order_relaxed);
+        sum += other.counts[i * other.shard_stride + 1].load(std::memory_order_relaxed);
+    }
+    size_t base = (current_thread_id() % shards) * shard_stride;
+    counts[base].fetch_add(total, std::memory_order_relaxed);
+    counts[base + 1].fetch_add(sum, std::memory_order_relaxed);
+    for (size_t i = 0; i < buckets; i++) {
+        uint64_t bt = other.bucket_total(i);
+        if (bt > 0) {
+            counts[base + shard_header + i].fetch_add(bt, std::memory_order_relaxed);
+        }
+    }
+}
+
+void latency_histogram::reset() STATICLIB_NOEXCEPT {
+    for (size_t i = 0; i < shards * shard_stride; i++) {
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+// layout: magic, version, then varints: precision bits, max value,
+// values sum, non-empty buckets count, then pairs of bucket index delta and bucket count
+std::string latency_histogram::serialize() const {
+    std::vector<uint64_t> totals;
+    totals.reserve(buckets);
+    size_t non_empty = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        uint64_t bt = bucket_total(i);
+        totals.push_back(bt);
+        if (bt > 0) {
+            non_empty += 1;
+        }
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < shards; i++) {
+        sum += counts[i * shard_stride + 1].load(std::memory_order_relaxed);
+    }
+    std::string res;
+    res.reserve(32 + non_empty * 4);
+    res.append(serialized_magic, sizeof(serialized_magic));
+    res.push_back(static_cast<char> (serialized_version));
+    write_varint(res, precision);
+    write_varint(res, max_val);
+    write_varint(res, sum);
+    write_varint(res, non_empty);
+    size_t prev = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        if (totals[i] > 0) {
+            write_varint(res, i - prev);
+            write_varint(res, totals[i]);
+            prev = i;
+        }
+    }
+    return res;
+}
+
+latency_histogram latency_histogram::deserialize(const char* data, size_t length) {
+    if (length < sizeof(serialized_magic) + 1 ||
+            0 != std::memcmp(data, serialized_magic, sizeof(serialized_magic))) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid serialized histogram header");
+    }
+    if (serialized_version != static_cast<uint8_t> (data[sizeof(serialized_magic)])) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Unsupported serialized histogram version");
+    }
+    size_t pos = sizeof(serialized_magic) + 1;
+    uint64_t precision_bits = read_varint(data, length, pos);
+    uint64_t max_value = read_varint(data, length, pos);
+    if (precision_bits < 1 || precision_bits > 16 || max_value < 1) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid serialized histogram layout");
+    }
+    latency_histogram res{max_value, static_cast<uint32_t> (precision_bits), 1};
+    uint64_t sum = read_varint(data, length, pos);
+    uint64_t non_empty = read_varint(data, length, pos);
+    if (non_empty > res.buckets) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid serialized histogram buckets count");
+    }
+    uint64_t total = 0;
+    uint64_t idx = 0;
+    for (uint64_t i = 0; i < non_empty; i++) {
+        uint64_t delta = read_varint(data, length, pos);
+        uint64_t bt = read_varint(data, length, pos);
+        if ((i > 0 && 0 == delta) || delta >= res.buckets - idx || 0 == bt) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid serialized histogram bucket");
+        }
+        idx += delta;
+        res.counts[shard_header + idx].store(bt, std::memory_order_relaxed);
+        total += bt;
+    }
+    if (pos != length) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid serialized histogram trailing data");
+    }
+    res.counts[0].store(total, std::memory_order_relaxed);
+    res.counts[1].store(sum, std::memory_order_relaxed);
+    return res;
+}
+
+uint64_t latency_histogram::max_value() const STATICLIB_NOEXCEPT {
+    return max_val;
+}
+
+uint32_t latency_histogram::precision_bits() const STATICLIB_NOEXCEPT {
+    return precision;
+}
+
+size_t latency_histogram::buckets_count() const STATICLIB_NOEXCEPT {
+    return buckets;
+}
+
+// values below 2^(precision + 1) map to their own buckets, larger values
+// are shifted right to keep "precision + 1" significant bits
+size_t latency_histogram::bucket_index(uint64_t value) const STATICLIB_NOEXCEPT {
+    if (value < (static_cast<uint64_t> (2) << precision)) {
+        return static_cast<size_t> (value);
+    }
+    uint32_t shift = highest_bit(value) - precision;
+    return (static_cast<size_t> (shift) << precision) + static_cast<size_t> (value >> shift);
+}
+
+uint64_t latency_histogram::bucket_lowest(size_t index) const STATICLIB_NOEXCEPT {
+    if (index < (static_cast<size_t> (2) << precision)) {
+        return index;
+    }
+    size_t shift = (index >> precision) - 1;
+    uint64_t sub_bucket = index - (shift << precision);
+    return sub_bucket << shift;
+}
+
+uint64_t latency_histogram::bucket_highest(size_t index) const STATICLIB_NOEXCEPT {
+    if (index < (static_cast<size_t> (2) << precision)) {
+        return index;
+    }
+    size_t shift = (index >> precision) - 1;
+    return bucket_lowest(index) + ((static_cast<uint64_t> (1) << shift) - 1);
+}
+
+uint64_t latency_histogram::bucket_total(size_t index) const STATICLIB_NOEXCEPT {
+    uint64_t res = 0;
+    for (size_t i = 0; i < shards; i++) {
+        res += counts[i * shard_stride + shard_header + index].load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+} // namespace
+}
@@ -0,0 +1,326 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   named_mutex.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 10:40 AM
+ */
+
+#include "staticlib/utils/named_mutex.hpp"
+
+#if defined(STATICLIB_WINDOWS) || defined(STATICLIB_LINUX)
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#ifdef STATICLIB_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include "staticlib/utils/windows.hpp"
+#endif // STATICLIB_WINDOWS
+#ifdef STATICLIB_LINUX
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif // STATICLIB_LINUX
+
+#include "staticlib/support.hpp"
+
+namespace staticlib {
+namespace utils {
+
+#ifdef STATICLIB_LINUX
+
+namespace { // anonymous
+
+const uint32_t ready_magic = 0x4e4d5458;
+
+struct shared_state {
+    pthread_mutex_t instance;
+    pthread_mutex_t lock;
+    std::atomic<uint32_t> ready;
+};
+
+shared_state* state(void* handle) {
+    if (nullptr == handle) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid 'named_mutex' instance");
+    return static_cast<shared_state*> (handle);
+}
+
+std::string error_string(int err) {
+    return std::string(::strerror(err));
+}
+
+std::string segment_name(const std::string& name) {
+    std::string res = "/staticlib_named_mutex_";
+    for (char ch : name) {
+        res.push_back('/' == ch ? '_' : ch);
+    }
+    return res;
+}
+
+void init_mutex(pthread_mutex_t* mx, const std::string& path) {
+    pthread_mutexattr_t attr;
+    ::pthread_mutexattr_init(std::addressof(attr));
+    ::pthread_mutexattr_setpshared(std::addressof(attr), PTHREAD_PROCESS_SHARED);
+    ::pthread_mutexattr_setrobust(std::addressof(attr), PTHREAD_MUTEX_ROBUST);
+    ::pthread_mutexattr_settype(std::addressof(attr), PTHREAD_MUTEX_ERRORCHECK);
+    int err = ::pthread_mutex_init(mx, std::addressof(attr));
+    ::pthread_mutexattr_destroy(std::addressof(attr));
+    if (0 != err) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error initializing shared mutex, name: [{}], error: [{}]", path, error_string(err)));
+}
+
+// exclusive lock on the segment file, released by the kernel if the process dies
+void lock_segment(int fd, const std::string& path) {
+    int res = -1;
+    do {
+        res = ::flock(fd, LOCK_EX);
+    } while (-1 == res && EINTR == errno);
+    if (-1 == res) {
+        int err = errno;
+        ::close(fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error locking shared memory segment, name: [{}], error: [{}]", path, error_string(err)));
+    }
+}
+
+// segment is sized and initialized under the file lock by whoever opens it first,
+// segment left uninitialized by the crashed process is initialized by the next one
+shared_state* open_state(const std::string& name) {
+    auto path = segment_name(name);
+    int fd = ::shm_open(path.c_str(), O_RDWR | O_CREAT, 0600);
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening shared memory segment, name: [{}], error: [{}]", path, error_string(errno)));
+    lock_segment(fd, path);
+    struct stat st;
+    bool sized = 0 == ::fstat(fd, std::addressof(st)) &&
+            (st.st_size >= static_cast<off_t> (sizeof(shared_state)) || 0 == ::ftruncate(fd, sizeof(shared_state)));
+    if (!sized) {
+        int err = errno;
+        ::close(fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error sizing shared memory segment, name: [{}], error: [{}]", path, error_string(err)));
+    }
+    void* mem = ::mmap(nullptr, sizeof(shared_state), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == mem) {
+        int err = errno;
+        ::close(fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error mapping shared memory segment, name: [{}], error: [{}]", path, error_string(err)));
+    }
+    shared_state* shared = static_cast<shared_state*> (mem);
+    try {
+        if (ready_magic != shared->ready.load(std::memory_order_acquire)) {
+            init_mutex(std::addressof(shared->instance), path);
+            init_mutex(std::addressof(shared->lock), path);
+            shared->ready.store(ready_magic, std::memory_order_release);
+        }
+    } catch (...) {
+        ::munmap(mem, sizeof(shared_state));
+        ::close(fd);
+        throw;
+    }
+    // mapping keeps the open file alive, so the lock is not released on close
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+    return shared;
+}
+
+// returns true if lock was acquired, state is made consistent if its owner has died
+bool check_acquired(int err, pthread_mutex_t* mx, bool& owner_died) {
+    if (0 == err) {
+        owner_died = false;
+        return true;
+    }
+    if (EOWNERDEAD == err) {
+        ::pthread_mutex_consistent(mx);
+        owner_died = true;
+        return true;
+    }
+    if (EBUSY == err || ETIMEDOUT == err) {
+        return false;
+    }
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error acquiring 'named_mutex', error: [{}]", error_string(err)));
+}
+
+} // namespace
+
+named_mutex::named_mutex(const std::string& name) :
+handle(open_state(name)),
+taken(false),
+owner_died(false) {
+    shared_state* st = state(handle);
+    int err = ::pthread_mutex_trylock(std::addressof(st->instance));
+    if (EOWNERDEAD == err) {
+        // previous owner of the name has died
+        ::pthread_mutex_consistent(std::addressof(st->instance));
+        err = 0;
+    }
+    if (0 != err && EBUSY != err && EDEADLK != err) {
+        ::munmap(handle, sizeof(shared_state));
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error checking 'named_mutex' owner, name: [{}], error: [{}]", name, error_string(err)));
+    }
+    taken = 0 != err;
+}
+
+named_mutex::~named_mutex() STATICLIB_NOEXCEPT {
+    if (nullptr != handle) {
+        shared_state* st = static_cast<shared_state*> (handle);
+        if (!taken) {
+            ::pthread_mutex_unlock(std::addressof(st->instance));
+        }
+        ::munmap(handle, sizeof(shared_state));
+    }
+}
+
+void named_mutex::lock() {
+    shared_state* st = state(handle);
+    int err = ::pthread_mutex_lock(std::addressof(st->lock));
+    check_acquired(err, std::addressof(st->lock), owner_died);
+}
+
+bool named_mutex::try_lock() {
+    shared_state* st = state(handle);
+    int err = ::pthread_mutex_trylock(std::addressof(st->lock));
+    if (EDEADLK == err) {
+        // already held by this thread
+        return false;
+    }
+    return check_acquired(err, std::addressof(st->lock), owner_died);
+}
+
+bool named_mutex::lock_for(std::chrono::milliseconds timeout) {
+    shared_state* st = state(handle);
+    // timedlock only supports CLOCK_REALTIME in older glibc
+    struct timespec deadline;
+    ::clock_gettime(CLOCK_REALTIME, std::addressof(deadline));
+    auto count = timeout.count() > 0 ? timeout.count() : 0;
+    deadline.tv_sec += static_cast<time_t> (count / 1000);
+    deadline.tv_nsec += static_cast<long> ((count % 1000) * 1000000);
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000;
+    }
+    int err = ::pthread_mutex_timedlock(std::addressof(st->lock), std::addressof(deadline));
+    return check_acquired(err, std::addressof(st->lock), owner_died);
+}
+
+void named_mutex::unlock() {
+    shared_state* st = state(handle);
+    int err = ::pthread_mutex_unlock(std::addressof(st->lock));
+    if (0 != err) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error releasing 'named_mutex', error: [{}]", error_string(err)));
+}
+
+#endif // STATICLIB_LINUX
+
+#ifdef STATICLIB_WINDOWS
+
+namespace { // anonymous
+
+bool check_acquired(unsigned long res, bool& owner_died) {
+    switch (res) {
+    case WAIT_OBJECT_0:
+        owner_died = false;
+        return true;
+    case WAIT_ABANDONED:
+        owner_died = true;
+        return true;
+    case WAIT_TIMEOUT:
+        return false;
+    default:
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error acquiring 'named_mutex', error: [{}]", errcode_to_string(::GetLastError())));
+    }
+}
+
+} // namespace
+
+named_mutex::named_mutex(const std::string& name) :
+handle(::CreateMutexW(nullptr, FALSE, widen(name).c_str())),
+taken(ERROR_ALREADY_EXISTS == ::GetLastError()),
+owner_died(false) {
+    if (nullptr == handle) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating 'named_mutex', name: [{}], error: [{}]", name, errcode_to_string(::GetLastError())));
+}
+
+named_mutex::~named_mutex() STATICLIB_NOEXCEPT {
+    if (nullptr != handle) {
+        ::CloseHandle(handle);
+    }
+}
+
+void named_mutex::lock() {
+    check_acquired(::WaitForSingleObject(handle, INFINITE), owner_died);
+}
+
+bool named_mutex::try_lock() {
+    return check_acquired(::WaitForSingleObject(handle, 0), owner_died);
+}
+
+bool named_mutex::lock_for(std::chrono::milliseconds timeout) {
+    auto count = timeout.count() > 0 ? timeout.count() : 0;
+    return check_acquired(::WaitForSingleObject(handle, static_cast<DWORD> (count)), owner_died);
+}
+
+void named_mutex::unlock() {
+    if (0 == ::ReleaseMutex(handle)) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error releasing 'named_mutex', error: [{}]", errcode_to_string(::GetLastError())));
+}
+
+#endif // STATICLIB_WINDOWS
+
+named_mutex::named_mutex(named_mutex&& other) :
+handle(other.handle),
+taken(other.taken),
+owner_died(other.owner_died) {
+    other.handle = nullptr;
+}
+
+named_mutex& named_mutex::operator=(named_mutex&& other) {
+    named_mutex tmp{std::move(*this)};
+    handle = other.handle;
+    other.handle = nullptr;
+    taken = other.taken;
+    owner_died = other.owner_died;
+    return *this;
+}
+
+bool named_mutex::already_taken() const {
+    return taken;
+}
+
+bool named_mutex::previous_owner_died() const {
+    return owner_died;
+}
+
+} // namespace
+}
+
+#endif // STATICLIB_WINDOWS || STATICLIB_LINUX
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   output_aggregator.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 12:15 PM
+ */
+
+#include "staticlib/utils/output_aggregator.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "staticlib/support.hpp"
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const size_t copy_buffer_size = 64 * 1024;
+
+const int max_events = 64;
+
+void close_nothrow(int fd) {
+    if (-1 != fd) {
+        ::close(fd);
+    }
+}
+
+} // namespace
+
+struct output_aggregator::source {
+    int fd;
+    std::string prefix;
+
+    source(int fd, const std::string& prefix) :
+    fd(fd),
+    prefix(prefix) { }
+};
+
+output_aggregator::output_aggregator(int target_fd) :
+target_fd(target_fd),
+epoll_fd(-1),
+wakeup_fd(-1),
+splice_supported(true),
+copy_buffer(copy_buffer_size),
+stopping(false),
+bytes_count(0),
+chunks_count(0),
+errors_count(0),
+worker_error(0) {
+    epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (-1 == epoll_fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating epoll instance: [{}]", errno_text(errno)));
+    wakeup_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (-1 == wakeup_fd) {
+        int err = errno;
+        ::close(epoll_fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error creating wakeup eventfd: [{}]", errno_text(err)));
+    }
+    // null data pointer marks the wakeup descriptor
+    struct epoll_event ev;
+    std::memset(std::addressof(ev), 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = nullptr;
+    if (-1 == ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, std::addressof(ev))) {
+        int err = errno;
+        ::close(wakeup_fd);
+        ::close(epoll_fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error registering wakeup eventfd: [{}]", errno_text(err)));
+    }
+    try {
+        worker = std::thread([this] {
+            run();
+        });
+    } catch (...) {
+        ::close(wakeup_fd);
+        ::close(epoll_fd);
+        throw;
+    }
+}
+
+output_aggregator::~output_aggregator() STATICLIB_NOEXCEPT {
+    stopping.store(true, std::memory_order_release);
+    uint64_t one = 1;
+    ssize_t res;
+    do {
+        res = ::write(wakeup_fd, std::addressof(one), sizeof(one));
+    } while (-1 == res && EINTR == errno);
+    worker.join();
+    for (auto& src : sources) {
+        ::close(src->fd);
+    }
+    ::close(wakeup_fd);
+    ::close(epoll_fd);
+}
+
+int output_aggregator::add_source(const std::string& prefix) {
+    int fds[2];
+    if (-1 == ::pipe2(fds, O_CLOEXEC)) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating source pipe: [{}], prefix: [{}]", errno_text(errno), prefix));
+    try {
+        std::unique_ptr<source> src{new source(fds[0], prefix)};
+        struct epoll_event ev;
+        std::memset(std::addressof(ev), 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.ptr = src.get();
+        // worker cannot remove the source until it is added to the list
+        std::lock_guard<std::mutex> guard{mutex};
+        if (0 != worker_error) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Aggregator worker has failed: [{}], prefix: [{}]", errno_text(worker_error), prefix));
+        }
+        sources.reserve(sources.size() + 1);
+        if (-1 == ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fds[0], std::addressof(ev))) {
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Error registering source pipe: [{}], prefix: [{}]", errno_text(errno), prefix));
+        }
+        sources.push_back(std::move(src));
+    } catch (...) {
+        ::close(fds[0]);
+        ::close(fds[1]);
+        throw;
+    }
+    return fds[1];
+}
+
+int output_aggregator::exec_async(const std::string& executable, const std::vector<std::string>& args,
+        const std::string& prefix, spawn_options options) {
+    int write_fd = add_source(prefix);
+    options.out_fd = write_fd;
+    try {
+        int pid = sl::utils::exec_async(executable, args, std::string(), options);
+        ::close(write_fd);
+        return pid;
+    } catch (...) {
+        // read end gets EOF and is removed by the worker
+        ::close(write_fd);
+        throw;
+    }
+}
+
+void output_aggregator::wait_drained() {
+    std::unique_lock<std::mutex> guard{mutex};
+    drained_cv.wait(guard, [this] {
+        return sources.empty() || 0 != worker_error;
+    });
+    if (sources.empty()) {
+        return;
+    }
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Aggregator worker has failed: [{}], active sources: [{}]", errno_text(worker_error), sources.size()));
+}
+
+output_aggregator_stats output_aggregator::stats() const {
+    output_aggregator_stats res;
+    res.bytes = bytes_count.load(std::memory_order_relaxed);
+    res.chunks = chunks_count.load(std::memory_order_relaxed);
+    res.errors = errors_count.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> guard{mutex};
+    res.active_sources = sources.size();
+    return res;
+}
+
+void output_aggregator::run() STATICLIB_NOEXCEPT {
+    std::array<struct epoll_event, max_events> events;
+    while (!stopping.load(std::memory_order_acquire)) {
+        int count = ::epoll_wait(epoll_fd, events.data(), max_events, -1);
+        if (-1 == count) {
+            if (EINTR == errno) {
+                continue;
+            }
+            int err = errno;
+            errors_count.fetch_add(1, std::memory_order_relaxed);
+            // sources are not drained anymore, waiters must not block forever
+            std::lock_guard<std::mutex> guard{mutex};
+            worker_error = err;
+            drained_cv.notify_all();
+            return;
+        }
+        for (int i = 0; i < count; i++) {
+            void* ptr = events[i].data.ptr;
+            if (nullptr == ptr) {
+                uint64_t val;
+                ssize_t res = ::read(wakeup_fd, std::addressof(val), sizeof(val));
+                (void) res;
+                continue;
+            }
+            source* src = static_cast<source*> (ptr);
+            if (!transfer(*src, events[i].events)) {
+                remove_source(src);
+            }
+        }
+    }
+}
+
+// returns false when source is exhausted or failed
+bool output_aggregator::transfer(source& src, uint32_t events) STATICLIB_NOEXCEPT {
+    int available = 0;
+    if (-1 == ::ioctl(src.fd, FIONREAD, std::addressof(available))) {
+        errors_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (available <= 0) {
+        // readable pipe without data means that all write ends are closed
+        return 0 == (events & (EPOLLHUP | EPOLLERR));
+    }
+    if (!src.prefix.empty() && !write_target(src.prefix.data(), src.prefix.length())) {
+        errors_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    // chunk is moved completely, so the next prefix is not written in the middle of it
+    size_t remaining = static_cast<size_t> (available);
+    while (remaining > 0) {
+        ssize_t moved;
+        if (splice_supported) {
+            moved = ::splice(src.fd, nullptr, target_fd, nullptr, remaining, SPLICE_F_MOVE | SPLICE_F_MORE);
+        } else {
+            moved = copy_chunk(src.fd, remaining);
+        }
+        if (moved > 0) {
+            remaining -= static_cast<size_t> (moved);
+            bytes_count.fetch_add(static_cast<uint64_t> (moved), std::memory_order_relaxed);
+        } else if (-1 == moved && EINTR == errno) {
+            continue;
+        } else if (-1 == moved && EINVAL == errno && splice_supported) {
+            // target does not support splice, nothing was moved
+            splice_supported = false;
+        } else {
+            errors_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    chunks_count.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+ssize_t output_aggregator::copy_chunk(int fd, size_t len) STATICLIB_NOEXCEPT {
+    ssize_t res = ::read(fd, copy_buffer.data(), std::min(len, copy_buffer.size()));
+    if (res > 0 && !write_target(copy_buffer.data(), static_cast<size_t> (res))) {
+        return -1;
+    }
+    return res;
+}
+
+bool output_aggregator::write_target(const char* data, size_t len) STATICLIB_NOEXCEPT {
+    size_t written = 0;
+    while (written < len) {
+        ssize_t res = ::write(target_fd, data + written, len - written);
+        if (res > 0) {
+            written += static_cast<size_t> (res);
+        } else if (-1 == res && EINTR == errno) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void output_aggregator::remove_source(source* src) STATICLIB_NOEXCEPT {
+    ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, src->fd, nullptr);
+    std::lock_guard<std::mutex> guard{mutex};
+    auto it = std::find_if(sources.begin(), sources.end(), [src](const std::unique_ptr<source>& el) {
+        return el.get() == src;
+    });
+    if (sources.end() != it) {
+        close_nothrow((*it)->fd);
+        std::swap(*it, sources.back());
+        sources.pop_back();
+    }
+    if (sources.empty()) {
+        drained_cv.notify_all();
+    }
+}
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
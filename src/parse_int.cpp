@@ -26,88 +26,167 @@
 #include <cstdlib>
 #include <cerrno>
 #include <climits>
-
+#include <limits>
 
 namespace staticlib {
 namespace utils {
 
-int16_t parse_int16(const std::string& str) {
+result<int16_t> try_parse_int16(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtol(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse int16_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     if (l < SHRT_MIN || l > SHRT_MAX) {
-        throw utils_exception(TRACEMSG("Value overflow for int16_t from string:[" + str + "]"));
+        return error_code::out_of_range;
     }
     return static_cast<int16_t> (l);
 }
 
-uint16_t parse_uint16(const std::string& str) {
+result<uint16_t> try_parse_uint16(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtol(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse uint16_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     if (l < 0 || l > USHRT_MAX) {
-        throw utils_exception(TRACEMSG("Value overflow for uint16_t from string:[" + str + "]"));
+        return error_code::out_of_range;
     }
     return static_cast<uint16_t> (l);
 }
 
-int32_t parse_int32(const std::string& str) {
+result<int32_t> try_parse_int32(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtol(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse int32_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     if (l < INT_MIN || l > INT_MAX) {
-        throw utils_exception(TRACEMSG("Value overflow for int32_t from string:[" + str + "]"));
+        return error_code::out_of_range;
     }
     return static_cast<int32_t> (l);
 }
 
-uint32_t parse_uint32(const std::string& str) {
+result<uint32_t> try_parse_uint32(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtoll(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse uint32_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     if (l < 0 || l > UINT_MAX) {
-        throw utils_exception(TRACEMSG("Value overflow for uint32_t from string:[" + str + "]"));
+        return error_code::out_of_range;
     }
     return static_cast<uint32_t> (l);
 }
 
-int64_t parse_int64(const std::string& str) {
+result<int64_t> try_parse_int64(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtoll(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse int64_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     return static_cast<int64_t> (l);
 }
 
-uint64_t parse_uint64(const std::string& str) {
+result<uint64_t> try_parse_uint64(const std::string& str) STATICLIB_NOEXCEPT {
     auto cstr = str.c_str();
     char* endptr;
     errno = 0;
     auto l = strtoull(cstr, &endptr, 0);
     if (errno == ERANGE || cstr + str.length() != endptr) {
-        throw utils_exception(TRACEMSG("Cannot parse uint64_t from string:[" + str + "]"));
+        return error_code::invalid_format;
     }
     return static_cast<uint64_t> (l);
 }
 
+result<uint64_t> try_parse_uint64_decimal(const char* begin, const char* end) STATICLIB_NOEXCEPT {
+    if (begin >= end) {
+        return error_code::invalid_format;
+    }
+    uint64_t res = 0;
+    for (const char* ptr = begin; ptr < end; ptr++) {
+        unsigned digit = static_cast<unsigned> (*ptr - '0');
+        if (digit > 9) {
+            return error_code::invalid_format;
+        }
+        if (res > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+            return error_code::out_of_range;
+        }
+        res = res * 10 + digit;
+    }
+    return res;
+}
+
+// messages are selected here, not in a shared helper, to keep
+// the source location of the throwing function
+
+int16_t parse_int16(const std::string& str) {
+    auto res = try_parse_int16(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code::out_of_range == res.error() ?
+                "Value overflow for int16_t from string:" : "Cannot parse int16_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
+uint16_t parse_uint16(const std::string& str) {
+    auto res = try_parse_uint16(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code::out_of_range == res.error() ?
+                "Value overflow for uint16_t from string:" : "Cannot parse uint16_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
+int32_t parse_int32(const std::string& str) {
+    auto res = try_parse_int32(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code::out_of_range == res.error() ?
+                "Value overflow for int32_t from string:" : "Cannot parse int32_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
+uint32_t parse_uint32(const std::string& str) {
+    auto res = try_parse_uint32(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, error_code::out_of_range == res.error() ?
+                "Value overflow for uint32_t from string:" : "Cannot parse uint32_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
+int64_t parse_int64(const std::string& str) {
+    auto res = try_parse_int64(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Cannot parse int64_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
+uint64_t parse_uint64(const std::string& str) {
+    auto res = try_parse_uint64(str);
+    if (!res) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Cannot parse uint64_t from string:",
+                str.data(), str.length());
+    }
+    return res.value();
+}
+
 } // namespace
 }
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_units.cpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 11:40 AM
+ */
+
+#include "staticlib/utils/parse_units.hpp"
+
+namespace staticlib {
+namespace utils {
+
+result<std::chrono::nanoseconds> parse_duration(const char* begin, const char* end) STATICLIB_NOEXCEPT {
+    if (nullptr == begin || begin > end || static_cast<size_t> (end - begin) > detail::units_max_input_length) {
+        return error_code::invalid_format;
+    }
+    auto res = detail::parse_duration_constexpr(begin, end);
+    if (error_code::ok != res.code) {
+        return res.code;
+    }
+    bool negative = begin != end && '-' == *begin;
+    return std::chrono::nanoseconds(detail::units_duration_value(res.value, negative));
+}
+
+result<std::chrono::nanoseconds> parse_duration(const std::string& str) STATICLIB_NOEXCEPT {
+    return parse_duration(str.data(), str.data() + str.length());
+}
+
+result<uint64_t> parse_bytes(const char* begin, const char* end) STATICLIB_NOEXCEPT {
+    if (nullptr == begin || begin > end || static_cast<size_t> (end - begin) > detail::units_max_input_length) {
+        return error_code::invalid_format;
+    }
+    auto res = detail::parse_bytes_constexpr(begin, end);
+    if (error_code::ok != res.code) {
+        return res.code;
+    }
+    return res.value;
+}
+
+result<uint64_t> parse_bytes(const std::string& str) STATICLIB_NOEXCEPT {
+    return parse_bytes(str.data(), str.data() + str.length());
+}
+
+} // namespace
+}
@@ -25,15 +25,17 @@
 
 #include <algorithm>
 #include <array>
-#include <iostream>
+#include <memory>
+#include <mutex>
 #include <vector>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
 #include "staticlib/config.hpp"
 
 #ifdef STATICLIB_WINDOWS
-#include <mutex>
+#include <cwctype>
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <windows.h>
@@ -47,17 +49,40 @@
 #include <fcntl.h>
 #include <signal.h>
 #endif // STATICLIB_LINUX || STATICLIB_MAC
+#if defined(STATICLIB_LINUX)
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#endif // STATICLIB_LINUX
 #if defined(STATICLIB_MAC)
 #include <mach-o/dyld.h>
 #endif // STATCILIB_MAC
 
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/instrumentation.hpp"
+#include "staticlib/utils/parse_int.hpp"
 #include "staticlib/utils/string_utils.hpp"
 
+#if defined(STATICLIB_LINUX) || defined(STATICLIB_MAC)
+extern char** environ;
+#endif // STATICLIB_LINUX || STATICLIB_MAC
+
 namespace staticlib {
 namespace utils {
 
 namespace { // anonymous
 
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(shell_exec_and_wait_stats, "shell_exec_and_wait");
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(exec_and_wait_stats, "exec_and_wait");
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(exec_async_stats, "exec_async");
+
+void check_env_entry(const std::pair<std::string, std::string>& en) {
+    const std::string& name = en.first;
+    const std::string& value = en.second;
+    if (name.empty() || std::string::npos != name.find('=') || std::string::npos != name.find('\0') ||
+            std::string::npos != value.find('\0')) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("Invalid environment variable, name: [{}], value: [{}]", name, value));
+}
+
 #if defined(STATICLIB_LINUX) || defined(STATICLIB_MAC)
 int parse_int_nothrow(char* fd_name) {
     size_t i = 0;
@@ -74,16 +99,52 @@ int parse_int_nothrow(char* fd_name) {
     return res;
 }
 
+// failing stage of the child setup, reported to the parent through the error pipe
+enum class spawn_stage : int32_t {
+    dup2 = 1,
+    chdir,
+    close_fds,
+    setsid,
+    signals,
+    exec
+};
+
+struct spawn_error {
+    int32_t stage;
+    int32_t err;
+};
+
+const char* spawn_stage_name(int32_t stage) {
+    switch (static_cast<spawn_stage> (stage)) {
+    case spawn_stage::dup2: return "dup2";
+    case spawn_stage::chdir: return "fchdir";
+    case spawn_stage::close_fds: return "close_fds";
+    case spawn_stage::setsid: return "setsid";
+    case spawn_stage::signals: return "signals";
+    case spawn_stage::exec: return "execve";
+    default: return "unknown";
+    }
+}
+
+// only async-signal-safe calls are allowed in the child after vfork
+void report_child_error_nothrow(int err_fd, spawn_stage stage, int err) {
+    spawn_error se;
+    se.stage = static_cast<int32_t> (stage);
+    se.err = static_cast<int32_t> (err);
+    ssize_t res;
+    do {
+        res = ::write(err_fd, std::addressof(se), sizeof(se));
+    } while ((-1 == res) && (EINTR == errno));
+    _exit(127);
+}
+
 #ifdef STATICLIB_LINUX
-void close_descriptors_nothrow() {    
+void close_descriptors_nothrow(int err_fd) {
     for (;;) {        
         // open descriptors dir
         DIR* dp = ::opendir("/proc/self/fd");
         if (NULL == dp) {
-            std::cout << 
-                    TRACEMSG("Process opendir(\"/proc/self/fd\") failed: [" + ::strerror(errno) + "]") 
-                    << std::endl;
-            _exit(errno);
+            report_child_error_nothrow(err_fd, spawn_stage::close_fds, errno);
         }
         // collect descriptors
         std::array<int, 1024> fd_list{{}};
@@ -92,7 +153,7 @@ void close_descriptors_nothrow() {
         struct dirent* dirp;
         while ((dirp = readdir(dp)) != NULL) {
             int fd = parse_int_nothrow(dirp->d_name);            
-            if (-1 != fd && STDOUT_FILENO != fd && STDERR_FILENO != fd) {
+            if (-1 != fd && STDOUT_FILENO != fd && STDERR_FILENO != fd && err_fd != fd && dirfd(dp) != fd) {
                fd_list[idx++] = fd;
                if (idx >= fd_list.size()) break;
             }
@@ -100,10 +161,7 @@ void close_descriptors_nothrow() {
         }                
         // readdir failed
         if (errno > 0) {
-            std::cout << 
-                    TRACEMSG("Process readdir failed: [" + ::strerror(errno) + "]") 
-                    << std::endl;
-            _exit(errno);
+            report_child_error_nothrow(err_fd, spawn_stage::close_fds, errno);
         }
         for (size_t i = 0; i < idx; i++) {
             close(fd_list[i]);
@@ -115,39 +173,51 @@ void close_descriptors_nothrow() {
 }
 #endif // STATICLIB_LINUX
 #ifdef STATICLIB_MAC
-void close_descriptors_nothrow() {    
+void close_descriptors_nothrow(int err_fd) {    
     (void) parse_int_nothrow; 
     int max_fd = static_cast<int>(::sysconf(_SC_OPEN_MAX));
     close(STDIN_FILENO);
     for (int fd = STDERR_FILENO + 1; fd < max_fd; fd++) {
-        close(fd);
+        if (err_fd != fd) {
+            close(fd);
+        }
     }
 }
 #endif // STATICLIB_MAC
 
-void copy_descriptor_nothrow(int from, int to) {
+void copy_descriptor_nothrow(int from, int to, int err_fd) {
     long int res;
     do {
         res = ::dup2(from, to);
     } while ((-1 == res) && (errno == EINTR));
-    // cannot throw here and it is yet no destination to write error to
-    if (-1 == res) _exit(errno);
+    if (-1 == res) {
+        report_child_error_nothrow(err_fd, spawn_stage::dup2, errno);
+    }
+}
+
+void change_dir_nothrow(int dir_fd, int err_fd) {
+    if (-1 == dir_fd) {
+        return;
+    }
+    int res = ::fchdir(dir_fd);
+    if (-1 == res) {
+        report_child_error_nothrow(err_fd, spawn_stage::chdir, errno);
+    }
 }
 
-void setsid_nothrow() {
+void setsid_nothrow(int err_fd) {
 // todo: fixme for mac
 #ifdef STATICLIB_LINUX
     pid_t sid = setsid();
     if (sid < 0) {
-        std::cout << 
-                TRACEMSG("Process setsid error: [" + ::strerror(errno) + "]") 
-                << std::endl;
-        _exit(sid);
+        report_child_error_nothrow(err_fd, spawn_stage::setsid, errno);
     }
+#else
+    (void) err_fd;
 #endif // STATICLIB_LINUX
 }
 
-void reset_signals_nothrow() {
+void reset_signals_nothrow(int err_fd) {
     // set signals to default
     struct sigaction sig_action;
     sig_action.sa_handler = SIG_DFL;
@@ -161,10 +231,7 @@ void reset_signals_nothrow() {
     sigfillset(std::addressof(allmask));
     int err = ::pthread_sigmask(SIG_SETMASK, std::addressof(allmask), nullptr);
     if (0 != err) {
-        std::cout << 
-                TRACEMSG("Error resuming signals in child: [" + ::strerror(err) + "]") 
-                << std::endl;
-        _exit(err);
+        report_child_error_nothrow(err_fd, spawn_stage::signals, err);
     }
 }
 
@@ -181,21 +248,23 @@ void register_signal(int signum, int flags, void (*handler)(int)) {
     sigemptyset(std::addressof(sa.sa_mask));
     sa.sa_flags = flags;
     int res = ::sigaction(signum, std::addressof(sa), 0);
-    if (-1 == res) throw utils_exception(TRACEMSG("Error registering signal: [" + sl::support::to_string(signum) + "],"
-            " with flags: [" + sl::support::to_string(flags) + "], error: [" + ::strerror(errno) + "]"));
+    if (-1 == res) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error registering signal: [{}], with flags: [{}], error: [{}]", signum, flags, errno_text(errno)));
 }
 
 sigset_t block_signals() {
     sigset_t oldmask, newmask;
     sigfillset(std::addressof(newmask));
     int err = ::pthread_sigmask(SIG_SETMASK, std::addressof(newmask), std::addressof(oldmask));
-    if (0 != err) throw utils_exception(TRACEMSG("Error blocking signals in parent: [" + ::strerror(err) + "]"));
+    if (0 != err) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error blocking signals in parent: [{}]", errno_text(err)));
     return oldmask;
 }
 
 void resume_signals(sigset_t& oldmask) {
     int err = ::pthread_sigmask(SIG_SETMASK, std::addressof(oldmask), nullptr);
-    if (0 != err) throw utils_exception(TRACEMSG("Error resuming signals in parent: [" + ::strerror(err) + "]"));
+    if (0 != err) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error resuming signals in parent: [{}]", errno_text(err)));
 }
 
 int open_fd(const std::string& path) {
@@ -204,11 +273,31 @@ int open_fd(const std::string& path) {
     do {
         fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
     } while ((-1 == fd) && (EINTR == errno));
-    if (-1 == fd) throw utils_exception(TRACEMSG("Error opening out file descriptor: [" + ::strerror(errno) + "]" +
-            ", specified out path: [" + path + "]"));
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening out file descriptor: [{}], specified out path: [{}]", errno_text(errno), path));
+    return fd;
+}
+
+// directory is opened in parent, so the invalid path is reported with its name
+int open_dir_fd(const std::string& path) {
+    if (path.empty()) {
+        return -1;
+    }
+    int fd;
+    do {
+        fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } while ((-1 == fd) && (EINTR == errno));
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening working directory: [{}], specified cwd: [{}]", errno_text(errno), path));
     return fd;
 }
 
+void close_fd_nothrow(int fd) {
+    if (-1 != fd) {
+        ::close(fd);
+    }
+}
+
 std::vector<char*> prepare_args(const std::string& executable, const std::vector<std::string>& args) {
     std::vector<char*> res;
     res.reserve(args.size() + 2);
@@ -221,36 +310,194 @@ std::vector<char*> prepare_args(const std::string& executable, const std::vector
     return res;
 }
 
-int exec_async_unix(const std::string& executable, const std::vector<std::string>& args, const std::string& out) {
+// entry is "name=value"
+bool env_overridden(const char* entry, const std::vector<std::pair<std::string, std::string>>& env) {
+    for (auto& en : env) {
+        const std::string& name = en.first;
+        if (0 == ::strncmp(entry, name.c_str(), name.length()) && '=' == entry[name.length()]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// pointers array and "name=value" strings are placed into a single arena chunk,
+// that is sized upfront, so envp is ready before vfork and parent environment is not touched
+char** prepare_env(const spawn_options& options, arena& ar) {
+    if (spawn_env_mode::inherit == options.env_mode) {
+        return environ;
+    }
+    for (auto& en : options.env) {
+        check_env_entry(en);
+    }
+    bool overlay = spawn_env_mode::overlay == options.env_mode;
+    size_t inherited_count = 0;
+    size_t inherited_bytes = 0;
+    if (overlay) {
+        for (char** ep = environ; nullptr != *ep; ep++) {
+            if (!env_overridden(*ep, options.env)) {
+                inherited_count += 1;
+                inherited_bytes += ::strlen(*ep) + 1;
+            }
+        }
+    }
+    size_t count = inherited_count;
+    size_t bytes = inherited_bytes;
+    for (auto& en : options.env) {
+        count += 1;
+        bytes += en.first.length() + en.second.length() + 2;
+    }
+    size_t ptrs_bytes = (count + 1) * sizeof(char*);
+    ar = arena(ptrs_bytes + bytes + arena::default_alignment);
+    char** envp = static_cast<char**> (ar.allocate(ptrs_bytes, alignof(char*)));
+    char* dest = static_cast<char*> (ar.allocate(bytes, 1));
+    // environ may change between the passes, inherited entries are limited
+    // to the space counted for them, so the explicit entries always fit
+    char* inherited_end = dest + inherited_bytes;
+    size_t idx = 0;
+    if (overlay) {
+        for (char** ep = environ; nullptr != *ep && idx < inherited_count; ep++) {
+            if (env_overridden(*ep, options.env)) {
+                continue;
+            }
+            size_t len = ::strlen(*ep) + 1;
+            if (len > static_cast<size_t> (inherited_end - dest)) {
+                break;
+            }
+            std::memcpy(dest, *ep, len);
+            envp[idx++] = dest;
+            dest += len;
+        }
+    }
+    for (auto& en : options.env) {
+        envp[idx++] = dest;
+        std::memcpy(dest, en.first.data(), en.first.length());
+        dest += en.first.length();
+        *dest++ = '=';
+        std::memcpy(dest, en.second.data(), en.second.length());
+        dest += en.second.length();
+        *dest++ = '\0';
+    }
+    envp[idx] = nullptr;
+    return envp;
+}
+
+// write end is closed on successful exec, so parent reads either EOF or the child error
+void open_error_pipe(int fds[2]) {
+    int res;
+#ifdef STATICLIB_LINUX
+    res = ::pipe2(fds, O_CLOEXEC);
+#else
+    res = ::pipe(fds);
+    if (0 == res) {
+        ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    }
+#endif // STATICLIB_LINUX
+    if (-1 == res) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating error pipe: [{}]", errno_text(errno)));
+    // write end must survive dup2 to stdout and stderr in child
+    if (fds[1] <= STDERR_FILENO) {
+        int moved = ::fcntl(fds[1], F_DUPFD_CLOEXEC, STDERR_FILENO + 1);
+        int err = errno;
+        ::close(fds[1]);
+        if (-1 == moved) {
+            ::close(fds[0]);
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Error moving error pipe descriptor: [{}]", errno_text(err)));
+        }
+        fds[1] = moved;
+    }
+}
+
+// returns true if child reported an error
+bool read_child_error(int fd, spawn_error& se) {
+    size_t received = 0;
+    char* buf = reinterpret_cast<char*> (std::addressof(se));
+    while (received < sizeof(se)) {
+        ssize_t res = ::read(fd, buf + received, sizeof(se) - received);
+        if (res > 0) {
+            received += static_cast<size_t> (res);
+        } else if (0 == res || EINTR != errno) {
+            break;
+        }
+    }
+    return sizeof(se) == received;
+}
+
+void reap_child(pid_t pid) {
+    int status;
+    while (::waitpid(pid, std::addressof(status), 0) < 0 && EINTR == errno);
+}
+
+int exec_async_unix(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options) {
     // some preparations
-    volatile sigset_t oldmask = block_signals();
     volatile const char* exec_path = executable.c_str();
-    volatile std::vector<char*> args_ptrs = prepare_args(executable, args);    
-    volatile int out_fd = open_fd(out);
+    volatile std::vector<char*> args_ptrs = prepare_args(executable, args);
+    arena env_arena{0};
+    char** volatile envp = prepare_env(options, env_arena);
+    volatile sigset_t oldmask = block_signals();
+    volatile int out_fd = options.out_fd;
+    volatile int owned_out_fd = -1;
+    volatile int dir_fd = -1;
+    int err_pipe[2];
+    try {
+        if (-1 == out_fd) {
+            out_fd = open_fd(out);
+            owned_out_fd = out_fd;
+        }
+        dir_fd = open_dir_fd(options.cwd);
+        open_error_pipe(err_pipe);
+    } catch (...) {
+        close_fd_nothrow(owned_out_fd);
+        close_fd_nothrow(dir_fd);
+        sigset_t& oldmask_ref = const_cast<sigset_t&>(oldmask);
+        resume_signals(oldmask_ref);
+        throw;
+    }
+    volatile int err_fd = err_pipe[1];
     // do fork
     volatile pid_t pid = ::vfork();
     if (-1 == pid) { // no child created
-        ::close(out_fd);
-        throw utils_exception{TRACEMSG("Process vfork error: [" + ::strerror(errno) + "]")};
+        int err = errno;
+        close_fd_nothrow(owned_out_fd);
+        close_fd_nothrow(dir_fd);
+        ::close(err_pipe[0]);
+        ::close(err_pipe[1]);
+        sigset_t& oldmask_ref = const_cast<sigset_t&>(oldmask);
+        resume_signals(oldmask_ref);
+        throw utils_exception{STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Process vfork error: [{}]", errno_text(err))};
     } else if (pid > 0) { // return pid to parent
-        ::close(out_fd);
+        close_fd_nothrow(owned_out_fd);
+        close_fd_nothrow(dir_fd);
+        ::close(err_pipe[1]);
+        // vfork parent resumes after child exec or exit, error is already written
+        spawn_error se;
+        bool failed = read_child_error(err_pipe[0], se);
+        ::close(err_pipe[0]);
         sigset_t& oldmask_ref = const_cast<sigset_t&>(oldmask);
         resume_signals(oldmask_ref);
+        if (failed) {
+            reap_child(pid);
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                    "Process spawn error, stage: [{}], error: [{}], executable: [{}], args size: [{}]",
+                    spawn_stage_name(se.stage), errno_text(se.err), executable, args.size()));
+        }
         return pid;
     } else { // we are in child process      
-        copy_descriptor_nothrow(out_fd, STDOUT_FILENO);
-        copy_descriptor_nothrow(out_fd, STDERR_FILENO);
-        close_descriptors_nothrow();
-        setsid_nothrow();
-        reset_signals_nothrow();
+        copy_descriptor_nothrow(out_fd, STDOUT_FILENO, err_fd);
+        copy_descriptor_nothrow(out_fd, STDERR_FILENO, err_fd);
+        change_dir_nothrow(dir_fd, err_fd);
+        close_descriptors_nothrow(err_fd);
+        setsid_nothrow(err_fd);
+        reset_signals_nothrow(err_fd);
         // prepare and do exec        
         const char* exec_path_child = const_cast<const char*>(exec_path);
         std::vector<char*>& arg_ptrs_child = const_cast<std::vector<char*>&>(args_ptrs);
-        errno = 0;
-        int res = ::execv(exec_path_child, arg_ptrs_child.data());
-        std::cout << TRACEMSG(" Process execv error: [" + ::strerror(errno) + "]," +
-                " executable: [" + executable + "], args size: [" + sl::support::to_string(args.size()) + "]") << std::endl;
-        if (-1 == res) _exit(errno);        
+        ::execve(exec_path_child, arg_ptrs_child.data(), envp);
+        report_child_error_nothrow(err_fd, spawn_stage::exec, errno);
         return 0;
     }
 }
@@ -261,7 +508,65 @@ std::mutex& get_static_mutex() {
     return mutex;
 }
 
-HANDLE exec_async_windows(const std::string& executable, const std::vector<std::string>& args, const std::string& out) {
+std::wstring env_name_upper(const std::wstring& entry) {
+    // leading '=' belongs to the name of hidden drive entries like "=C:=C:\\"
+    size_t eq = entry.find(L'=', 1);
+    std::wstring res = entry.substr(0, eq);
+    std::transform(res.begin(), res.end(), res.begin(), ::towupper);
+    return res;
+}
+
+// environment block for CreateProcessW must be sorted by name case-insensitively,
+// empty block means that parent environment is inherited
+std::wstring prepare_env_windows(const spawn_options& options) {
+    if (spawn_env_mode::inherit == options.env_mode) {
+        return std::wstring();
+    }
+    std::vector<std::pair<std::wstring, std::wstring>> entries;
+    std::vector<std::wstring> overrides;
+    for (auto& en : options.env) {
+        check_env_entry(en);
+        std::wstring entry = widen(en.first + "=" + en.second);
+        overrides.push_back(env_name_upper(entry));
+        entries.emplace_back(overrides.back(), std::move(entry));
+    }
+    if (spawn_env_mode::overlay == options.env_mode) {
+        wchar_t* parent = ::GetEnvironmentStringsW();
+        if (nullptr == parent) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error reading parent environment: [{}]", errcode_to_string(::GetLastError())));
+        for (wchar_t* ep = parent; L'\0' != *ep; ep += ::wcslen(ep) + 1) {
+            std::wstring entry(ep);
+            std::wstring name = env_name_upper(entry);
+            if (overrides.end() == std::find(overrides.begin(), overrides.end(), name)) {
+                entries.emplace_back(std::move(name), std::move(entry));
+            }
+        }
+        ::FreeEnvironmentStringsW(parent);
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const std::pair<std::wstring, std::wstring>& a,
+            const std::pair<std::wstring, std::wstring>& b) {
+        return a.first < b.first;
+    });
+    std::wstring res;
+    for (auto& en : entries) {
+        res.append(en.second);
+        res.push_back(L'\0');
+    }
+    // block is terminated with two nulls even if empty
+    res.push_back(L'\0');
+    if (1 == res.length()) {
+        res.push_back(L'\0');
+    }
+    return res;
+}
+
+HANDLE exec_async_windows(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options) {
+    // prepared before taking the lock, invalid options are reported without touching the out file
+    std::wstring env_block = prepare_env_windows(options);
+    std::wstring cwd = options.cwd.empty() ? std::wstring() : widen(options.cwd);
+    if (-1 != options.out_fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Output descriptor option is not supported on this platform, executable: [{}]", executable));
     // workaround for handle inheritance race condition here, solution exists for vista+
     // http://blogs.msdn.com/b/oldnewthing/archive/2011/12/16/10248328.aspx
     std::lock_guard<std::mutex> guard{get_static_mutex()};
@@ -278,9 +583,9 @@ HANDLE exec_async_windows(const std::string& executable, const std::vector<std::
             CREATE_ALWAYS,
             FILE_ATTRIBUTE_NORMAL,
             nullptr);
-    if (INVALID_HANDLE_VALUE == out_handle) throw utils_exception(TRACEMSG(
-            "Error opening out file descriptor: [" + errcode_to_string(::GetLastError()) + "]" +
-            ", specified out path: [" + out + "]"));
+    if (INVALID_HANDLE_VALUE == out_handle) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("Error opening out file descriptor: [{}], specified out path: [{}]",
+            errcode_to_string(::GetLastError()), out));
     // prepare process
     STARTUPINFOW si;
     ::memset(std::addressof(si), 0, sizeof(STARTUPINFO));
@@ -304,14 +609,14 @@ HANDLE exec_async_windows(const std::string& executable, const std::vector<std::
             nullptr, 
             true, 
             CREATE_NEW_PROCESS_GROUP | DETACHED_PROCESS | CREATE_NO_WINDOW | CREATE_UNICODE_ENVIRONMENT, 
-            nullptr, 
-            nullptr, 
+            env_block.empty() ? nullptr : static_cast<void*> (std::addressof(env_block.front())), 
+            cwd.empty() ? nullptr : cwd.c_str(), 
             std::addressof(si), 
             std::addressof(pi));
     ::CloseHandle(out_handle);
-    if (0 == ret) throw utils_exception(TRACEMSG(
-            " Process create error: [" + errcode_to_string(::GetLastError()) + "]," +
-            " command line: [" + cmd_string + "], output: [" + out + "]"));
+    if (0 == ret) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            " Process create error: [{}], command line: [{}], output: [{}]",
+            errcode_to_string(::GetLastError()), cmd_string, out));
     ::CloseHandle(pi.hThread);
     return pi.hProcess;
 }
@@ -320,6 +625,7 @@ HANDLE exec_async_windows(const std::string& executable, const std::vector<std::
 } // namespace
 
 int shell_exec_and_wait(const std::string& cmd) {
+    STATICLIB_UTILS_INSTRUMENT(shell_exec_and_wait_stats, 0);
 #ifdef STATICLIB_WINDOWS
     std::string quoted = "\"" + cmd + "\"";
     std::wstring ws = widen(quoted);
@@ -330,8 +636,14 @@ int shell_exec_and_wait(const std::string& cmd) {
 }
 
 int exec_and_wait(const std::string& executable, const std::vector<std::string>& args, const std::string& out) {
+    return exec_and_wait(executable, args, out, spawn_options());
+}
+
+int exec_and_wait(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options) {
+    STATICLIB_UTILS_INSTRUMENT(exec_and_wait_stats, 0);
 #if defined(STATICLIB_LINUX) || defined(STATICLIB_MAC)
-    pid_t pid = exec_async_unix(executable, args, out);
+    pid_t pid = exec_async_unix(executable, args, out, options);
     int status;
     while (::waitpid(pid, std::addressof(status), 0) < 0) {
         switch (errno) {
@@ -342,12 +654,11 @@ int exec_and_wait(const std::string& executable, const std::vector<std::string>&
     }
     return WEXITSTATUS(status);
 #elif defined(STATICLIB_WINDOWS)
-    HANDLE ha = exec_async_windows(executable, args, out);
+    HANDLE ha = exec_async_windows(executable, args, out, options);
     auto ret = WaitForSingleObject(ha, INFINITE);
-    if (WAIT_FAILED == ret) throw utils_exception(TRACEMSG(
-            "Error waiting for child process: [" + errcode_to_string(::GetLastError()) + "]" +
-            " executable: [" + executable + "], args size: [" + sl::support::to_string(args.size()) + "], " +
-            " specified out path: [" + out + "]"));
+    if (WAIT_FAILED == ret) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error waiting for child process: [{}] executable: [{}], args size: [{}],  specified out path: [{}]",
+            errcode_to_string(::GetLastError()), executable, args.size(), out));
     DWORD res;
     ::GetExitCodeProcess(ha, std::addressof(res));
     return res;
@@ -355,17 +666,26 @@ int exec_and_wait(const std::string& executable, const std::vector<std::string>&
     (void) executable;
     (void) args;
     (void) out;
+    (void) options;
     return -1;
 #endif
 }
 
 int exec_async(const std::string& executable, const std::vector<std::string>& args, const std::string& out) {
+    return exec_async(executable, args, out, spawn_options());
+}
+
+int exec_async(const std::string& executable, const std::vector<std::string>& args, const std::string& out,
+        const spawn_options& options) {
+    STATICLIB_UTILS_INSTRUMENT(exec_async_stats, 0);
 #if defined(STATICLIB_LINUX) || defined(STATICLIB_MAC)
-    pid_t pid =  exec_async_unix(executable, args, out);
-    register_signal(SIGCHLD, SA_RESTART | SA_NOCLDSTOP, sigchild_handler);
+    pid_t pid =  exec_async_unix(executable, args, out, options);
+    if (options.auto_reap) {
+        register_signal(SIGCHLD, SA_RESTART | SA_NOCLDSTOP, sigchild_handler);
+    }
     return pid;
 #elif defined(STATICLIB_WINDOWS)
-    HANDLE ha = exec_async_windows(executable, args, out);
+    HANDLE ha = exec_async_windows(executable, args, out, options);
     int res = ::GetProcessId(ha);
     ::CloseHandle(ha);
     return res;
@@ -373,6 +693,7 @@ int exec_async(const std::string& executable, const std::vector<std::string>& ar
     (void) executable;
     (void) args;
     (void) out;
+    (void) options;
     return -1;
 #endif
 }
@@ -388,7 +709,8 @@ std::string current_executable_path_linux() {
     for (;;) {
         res.resize(size);
         ssize_t res_size = readlink("/proc/self/exe", std::addressof(res.front()), size);
-        if (res_size < 0) throw utils_exception(TRACEMSG(strerror(errno)));
+        if (res_size < 0) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "{}", errno_text(errno)));
         if (res_size < size) {
             res.resize(res_size);
             break;
@@ -410,7 +732,7 @@ std::string current_executable_path_windows() {
         if (0 == res_size) {
             auto code = GetLastError();
             auto code_str = errcode_to_string(code);
-            throw utils_exception(TRACEMSG(code_str));
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT("{}", code_str));
         } else if (res_size < size) {
             std::string out_bytes = narrow(out.c_str(), res_size);
             return out_bytes;
@@ -431,13 +753,13 @@ std::string current_executable_path_mac() {
         // trim null terminated buffer
         return std::string(out.c_str());
     } else if (-1 != res) {
-        throw utils_exception(TRACEMSG("_NSGetExecutablePath error"));
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "_NSGetExecutablePath error");
     } else {
         out.resize(size);
         path = std::addressof(out.front());
         res = _NSGetExecutablePath(path, &size);
         if (0 != res) {
-            throw utils_exception(TRACEMSG("_NSGetExecutablePath secondary error"));
+            throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "_NSGetExecutablePath secondary error");
         }
         // trim null terminated buffer
         return std::string(out.c_str());
@@ -455,10 +777,262 @@ std::string current_executable_path() {
 #elif defined(STATICLIB_MAC)
     return current_executable_path_mac();
 #else
-    throw utils_exception(TRACEMSG("Cannot determine current executable path on this platform"));
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Cannot determine current executable path on this platform");
 #endif 
 }
 
+// process stats
+
+namespace { // anonymous
+
+#if defined(STATICLIB_LINUX)
+// fields of /proc/<pid>/stat are counted from the state (field 3), that follows the command name
+const size_t stat_utime_idx = 11;
+const size_t stat_stime_idx = 12;
+const size_t stat_threads_idx = 17;
+
+// descriptors opened by the reader for its own process
+const uint32_t reader_fds_count = 3;
+
+const size_t stat_buffer_size = 2048;
+
+const size_t statm_buffer_size = 256;
+
+const size_t dirents_buffer_size = 4096;
+
+struct linux_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+int open_proc_file(int pid, const char* name, int flags) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/%s", pid, name);
+    int fd;
+    do {
+        fd = ::open(path, flags | O_CLOEXEC);
+    } while ((-1 == fd) && (EINTR == errno));
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening process stats file: [{}], error: [{}]", path, errno_text(errno)));
+    return fd;
+}
+
+[[noreturn]] void throw_stats_error(int pid, const char* name, int err) {
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error reading process stats, pid: [{}], file: [{}], error: [{}]", pid, name, errno_text(err)));
+}
+
+// proc files are generated on read, so the whole file is read from the start every time
+size_t pread_proc_file(int pid, int fd, const char* name, char* buf, size_t len) {
+    size_t total = 0;
+    while (total < len) {
+        ssize_t res = ::pread(fd, buf + total, len - total, static_cast<off_t> (total));
+        if (res > 0) {
+            total += static_cast<size_t> (res);
+        } else if (0 == res) {
+            break;
+        } else if (EINTR != errno) {
+            throw_stats_error(pid, name, errno);
+        }
+    }
+    if (0 == total) {
+        throw_stats_error(pid, name, ESRCH);
+    }
+    return total;
+}
+
+// splits fields by spaces and parses the numeric ones with the range parser
+class fields_scanner {
+    const char* cur;
+    const char* end;
+
+public:
+    fields_scanner(const char* begin, const char* end) :
+    cur(begin),
+    end(end) { }
+
+    bool skip(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            next_field();
+        }
+        return cur < end;
+    }
+
+    uint64_t next_uint() {
+        const char* start = next_field();
+        return try_parse_uint64_decimal(start, cur).value_or(0);
+    }
+
+private:
+    const char* next_field() {
+        while (cur < end && ' ' == *cur) {
+            cur += 1;
+        }
+        const char* start = cur;
+        while (cur < end && ' ' != *cur && '\n' != *cur) {
+            cur += 1;
+        }
+        return start;
+    }
+};
+
+uint32_t count_fds(int pid, int dir_fd) {
+    // since Linux 6.2 directory size is the number of open descriptors
+    struct stat st;
+    if (0 == ::fstat(dir_fd, std::addressof(st)) && st.st_size > 0) {
+        return static_cast<uint32_t> (st.st_size);
+    }
+    if (-1 == ::lseek(dir_fd, 0, SEEK_SET)) {
+        throw_stats_error(pid, "fd", errno);
+    }
+    alignas(linux_dirent64) char buf[dirents_buffer_size];
+    uint32_t count = 0;
+    for (;;) {
+        long res = ::syscall(SYS_getdents64, dir_fd, buf, sizeof(buf));
+        if (0 == res) {
+            break;
+        }
+        if (res < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            throw_stats_error(pid, "fd", errno);
+        }
+        for (long pos = 0; pos < res;) {
+            linux_dirent64* de = reinterpret_cast<linux_dirent64*> (buf + pos);
+            if ('.' != de->d_name[0]) {
+                count += 1;
+            }
+            pos += de->d_reclen;
+        }
+    }
+    return count;
+}
+#endif // STATICLIB_LINUX
+
 } // namespace
+
+process_stats_reader::process_stats_reader(int pid) :
+pid(pid),
+stat_fd(-1),
+statm_fd(-1),
+fd_dir_fd(-1) {
+#if defined(STATICLIB_LINUX)
+    try {
+        stat_fd = open_proc_file(pid, "stat", O_RDONLY);
+        statm_fd = open_proc_file(pid, "statm", O_RDONLY);
+        fd_dir_fd = open_proc_file(pid, "fd", O_RDONLY | O_DIRECTORY);
+    } catch (...) {
+        close_files();
+        throw;
+    }
+#else
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Process stats are not supported on this platform, pid: [{}]", pid));
+#endif // STATICLIB_LINUX
+}
+
+process_stats_reader::process_stats_reader(process_stats_reader&& other) STATICLIB_NOEXCEPT :
+pid(other.pid),
+stat_fd(other.stat_fd),
+statm_fd(other.statm_fd),
+fd_dir_fd(other.fd_dir_fd) {
+    other.stat_fd = -1;
+    other.statm_fd = -1;
+    other.fd_dir_fd = -1;
+}
+
+process_stats_reader& process_stats_reader::operator=(process_stats_reader&& other) STATICLIB_NOEXCEPT {
+    close_files();
+    pid = other.pid;
+    stat_fd = other.stat_fd;
+    statm_fd = other.statm_fd;
+    fd_dir_fd = other.fd_dir_fd;
+    other.stat_fd = -1;
+    other.statm_fd = -1;
+    other.fd_dir_fd = -1;
+    return *this;
+}
+
+process_stats_reader::~process_stats_reader() STATICLIB_NOEXCEPT {
+    close_files();
+}
+
+process_stats process_stats_reader::read() {
+    process_stats res;
+#if defined(STATICLIB_LINUX)
+    static const uint64_t page_size = static_cast<uint64_t> (::sysconf(_SC_PAGESIZE));
+    static const uint64_t clock_tick_ns = 1000000000 / static_cast<uint64_t> (::sysconf(_SC_CLK_TCK));
+    // stat, command name may contain spaces and parens, so fields start after the last ')'
+    char stat_buf[stat_buffer_size];
+    size_t stat_len = pread_proc_file(pid, stat_fd, "stat", stat_buf, sizeof(stat_buf));
+    const char* comm_end = static_cast<const char*> (::memrchr(stat_buf, ')', stat_len));
+    if (nullptr == comm_end) {
+        throw_stats_error(pid, "stat", EINVAL);
+    }
+    fields_scanner stat_fields(comm_end + 1, stat_buf + stat_len);
+    if (!stat_fields.skip(stat_utime_idx)) {
+        throw_stats_error(pid, "stat", EINVAL);
+    }
+    uint64_t utime = stat_fields.next_uint();
+    uint64_t stime = stat_fields.next_uint();
+    stat_fields.skip(stat_threads_idx - stat_stime_idx - 1);
+    uint64_t threads = stat_fields.next_uint();
+    // statm: size resident shared text lib data dt, in pages
+    char statm_buf[statm_buffer_size];
+    size_t statm_len = pread_proc_file(pid, statm_fd, "statm", statm_buf, sizeof(statm_buf));
+    fields_scanner statm_fields(statm_buf, statm_buf + statm_len);
+    uint64_t size_pages = statm_fields.next_uint();
+    uint64_t resident_pages = statm_fields.next_uint();
+    uint32_t fds = count_fds(pid, fd_dir_fd);
+    if (::getpid() == pid && fds >= reader_fds_count) {
+        fds -= reader_fds_count;
+    }
+    res.rss_bytes = resident_pages * page_size;
+    res.virtual_bytes = size_pages * page_size;
+    res.user_time = std::chrono::nanoseconds(static_cast<int64_t> (utime * clock_tick_ns));
+    res.system_time = std::chrono::nanoseconds(static_cast<int64_t> (stime * clock_tick_ns));
+    res.threads_count = static_cast<uint32_t> (threads);
+    res.open_fds_count = fds;
+#else
+    std::memset(std::addressof(res), 0, sizeof(res));
+#endif // STATICLIB_LINUX
+    return res;
+}
+
+int process_stats_reader::process_id() const STATICLIB_NOEXCEPT {
+    return pid;
 }
 
+void process_stats_reader::close_files() STATICLIB_NOEXCEPT {
+#if defined(STATICLIB_LINUX) || defined(STATICLIB_MAC)
+    close_fd_nothrow(stat_fd);
+    close_fd_nothrow(statm_fd);
+    close_fd_nothrow(fd_dir_fd);
+#endif // STATICLIB_LINUX || STATICLIB_MAC
+    stat_fd = -1;
+    statm_fd = -1;
+    fd_dir_fd = -1;
+}
+
+process_stats current_process_stats() {
+#if defined(STATICLIB_LINUX)
+    static std::mutex mutex;
+    static std::unique_ptr<process_stats_reader> reader;
+    std::lock_guard<std::mutex> guard{mutex};
+    // files opened in parent describe the parent process after fork
+    int pid = ::getpid();
+    if (nullptr == reader.get() || reader->process_id() != pid) {
+        reader.reset(new process_stats_reader(pid));
+    }
+    return reader->read();
+#else
+    throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Process stats are not supported on this platform");
+#endif // STATICLIB_LINUX
+}
+
+} // namespace
+}
@@ -52,7 +52,7 @@ random_string_generator::random_string_generator(std::string charset) :
 charset(std::move(charset)),
 engine(std::random_device{}()),
 dist(static_cast<size_t>(0), this->charset.size() - 1) {
-    if(this->charset.empty()) throw utils_exception(TRACEMSG("Invalid empty charset specified"));
+    if(this->charset.empty()) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, "Invalid empty charset specified");
 }
 
 
@@ -68,5 +68,11 @@ void random_string_generator::generate(std::string& str) {
     } 
 }
 
+void random_string_generator::generate(inline_string& str) {
+    for (char& ch : str) {
+        ch = charset[dist(engine)];
+    }
+}
+
 }
 } // namespace
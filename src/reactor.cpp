@@ -0,0 +1,424 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   reactor.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 11:05 AM
+ */
+
+#include "staticlib/utils/reactor.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "staticlib/support.hpp"
+
+// not defined by older kernel headers, number is the same on all architectures except alpha
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif // SYS_pidfd_open
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const uint64_t wakeup_id = 0;
+
+const uint64_t signal_fd_id = 1;
+
+const int max_events = 32;
+
+void epoll_add(int epoll_fd, int fd, uint64_t id) {
+    struct epoll_event ev;
+    std::memset(std::addressof(ev), 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u64 = id;
+    if (-1 == ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, std::addressof(ev))) {
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error registering descriptor in epoll: [{}]", errno_text(errno)));
+    }
+}
+
+void close_nothrow(int fd) {
+    if (-1 != fd) {
+        ::close(fd);
+    }
+}
+
+// shell convention for the processes killed by signals
+int exit_code(const siginfo_t& info) {
+    switch (info.si_code) {
+    case CLD_EXITED: return info.si_status;
+    case CLD_KILLED:
+    case CLD_DUMPED: return 128 + info.si_status;
+    default: return -1;
+    }
+}
+
+} // namespace
+
+struct reactor::entry {
+    enum class kind {
+        signal,
+        child,
+        timer
+    };
+
+    kind type;
+    int fd;
+    int pid;
+    int signum;
+    bool periodic;
+    std::function<void(int)> signal_callback;
+    std::function<void(int, int)> child_callback;
+    std::function<void()> timer_callback;
+
+    explicit entry(kind type) :
+    type(type),
+    fd(-1),
+    pid(0),
+    signum(0),
+    periodic(false) { }
+};
+
+reactor::reactor() :
+epoll_fd(-1),
+wakeup_fd(-1),
+signal_fd(-1),
+next_id(signal_fd_id + 1),
+stop_requested(false) {
+    epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (-1 == epoll_fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating epoll instance: [{}]", errno_text(errno)));
+    wakeup_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (-1 == wakeup_fd) {
+        int err = errno;
+        ::close(epoll_fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error creating wakeup eventfd: [{}]", errno_text(err)));
+    }
+    try {
+        epoll_add(epoll_fd, wakeup_fd, wakeup_id);
+    } catch (...) {
+        ::close(wakeup_fd);
+        ::close(epoll_fd);
+        throw;
+    }
+}
+
+reactor::~reactor() STATICLIB_NOEXCEPT {
+    for (auto& pa : entries) {
+        close_nothrow(pa.second->fd);
+    }
+    close_nothrow(signal_fd);
+    ::close(wakeup_fd);
+    ::close(epoll_fd);
+}
+
+uint64_t reactor::add_signal(int signum, std::function<void(int)> callback) {
+    if (signal_ids.end() != signal_ids.find(signum)) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("Signal is already registered: [{}]", signum));
+    sigset_t mask;
+    sigemptyset(std::addressof(mask));
+    if (-1 == sigaddset(std::addressof(mask), signum)) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("Invalid signal number: [{}]", signum));
+    int err = ::pthread_sigmask(SIG_BLOCK, std::addressof(mask), nullptr);
+    if (0 != err) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error blocking signal: [{}], error: [{}]", signum, errno_text(err)));
+    if (-1 == signal_fd) {
+        int fd = ::signalfd(-1, std::addressof(mask), SFD_NONBLOCK | SFD_CLOEXEC);
+        if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error creating signalfd: [{}]", errno_text(errno)));
+        try {
+            epoll_add(epoll_fd, fd, signal_fd_id);
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+        signal_fd = fd;
+    }
+    auto en = std::make_shared<entry>(entry::kind::signal);
+    en->signum = signum;
+    en->signal_callback = std::move(callback);
+    uint64_t id = add_entry(std::move(en));
+    signal_ids.insert(std::make_pair(signum, id));
+    try {
+        update_signal_mask();
+    } catch (...) {
+        remove(id);
+        throw;
+    }
+    return id;
+}
+
+uint64_t reactor::add_child(int pid, std::function<void(int, int)> callback) {
+    int fd = static_cast<int> (::syscall(SYS_pidfd_open, static_cast<pid_t> (pid), 0));
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening pidfd, pid: [{}], error: [{}]", pid, errno_text(errno)));
+    auto en = std::make_shared<entry>(entry::kind::child);
+    en->fd = fd;
+    en->pid = pid;
+    en->child_callback = std::move(callback);
+    return add_entry(std::move(en));
+}
+
+uint64_t reactor::add_timer(std::chrono::nanoseconds interval, std::function<void()> callback, bool periodic) {
+    if (interval.count() <= 0) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Invalid timer interval: [{}]", interval.count()));
+    int fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating timerfd: [{}]", errno_text(errno)));
+    struct itimerspec spec;
+    std::memset(std::addressof(spec), 0, sizeof(spec));
+    spec.it_value.tv_sec = static_cast<time_t> (interval.count() / 1000000000);
+    spec.it_value.tv_nsec = static_cast<long> (interval.count() % 1000000000);
+    if (periodic) {
+        spec.it_interval = spec.it_value;
+    }
+    if (-1 == ::timerfd_settime(fd, 0, std::addressof(spec), nullptr)) {
+        int err = errno;
+        ::close(fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error setting timer: [{}]", errno_text(err)));
+    }
+    auto en = std::make_shared<entry>(entry::kind::timer);
+    en->fd = fd;
+    en->periodic = periodic;
+    en->timer_callback = std::move(callback);
+    return add_entry(std::move(en));
+}
+
+void reactor::remove(uint64_t id) STATICLIB_NOEXCEPT {
+    auto it = entries.find(id);
+    if (entries.end() == it) {
+        return;
+    }
+    std::shared_ptr<entry> en = std::move(it->second);
+    entries.erase(it);
+    if (entry::kind::signal == en->type) {
+        signal_ids.erase(en->signum);
+        try {
+            update_signal_mask();
+        } catch (...) {
+            // signal stays in the mask, it is ignored in dispatch
+        }
+    } else {
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, en->fd, nullptr);
+        ::close(en->fd);
+        en->fd = -1;
+    }
+}
+
+void reactor::post(std::function<void()> task) {
+    bool was_empty;
+    {
+        std::lock_guard<std::mutex> guard{tasks_mutex};
+        was_empty = tasks.empty();
+        tasks.emplace_back(std::move(task));
+    }
+    // non-empty queue is not yet taken by the loop, wakeup is already pending
+    if (was_empty) {
+        wakeup();
+    }
+}
+
+void reactor::run() {
+    while (!stop_requested.load(std::memory_order_acquire)) {
+        run_once(std::chrono::milliseconds(-1));
+    }
+    stop_requested.store(false, std::memory_order_release);
+}
+
+size_t reactor::run_once(std::chrono::milliseconds timeout) {
+    std::array<struct epoll_event, max_events> events;
+    int timeout_ms = timeout.count() < 0 ? -1 : static_cast<int> (std::min(
+            timeout.count(), static_cast<std::chrono::milliseconds::rep> (INT_MAX)));
+    int count = ::epoll_wait(epoll_fd, events.data(), max_events, timeout_ms);
+    if (-1 == count) {
+        if (EINTR == errno) {
+            return 0;
+        }
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error waiting for events: [{}]", errno_text(errno)));
+    }
+    size_t dispatched = 0;
+    for (int i = 0; i < count; i++) {
+        uint64_t id = events[i].data.u64;
+        if (wakeup_id == id) {
+            dispatched += dispatch_tasks();
+        } else if (signal_fd_id == id) {
+            dispatched += dispatch_signals();
+        } else {
+            // entry may be removed by the callback called earlier in this batch
+            auto it = entries.find(id);
+            if (entries.end() == it) {
+                continue;
+            }
+            // keeps callback alive if it removes its own registration
+            std::shared_ptr<entry> en = it->second;
+            if (entry::kind::child == en->type) {
+                dispatched += dispatch_child(id, en);
+            } else {
+                dispatched += dispatch_timer(id, en);
+            }
+        }
+    }
+    return dispatched;
+}
+
+void reactor::stop() {
+    stop_requested.store(true, std::memory_order_release);
+    wakeup();
+}
+
+size_t reactor::registrations_count() const STATICLIB_NOEXCEPT {
+    return entries.size();
+}
+
+uint64_t reactor::add_entry(std::shared_ptr<entry> en) {
+    uint64_t id = next_id++;
+    int fd = en->fd;
+    try {
+        entries.insert(std::make_pair(id, en));
+        if (-1 != fd) {
+            epoll_add(epoll_fd, fd, id);
+        }
+    } catch (...) {
+        entries.erase(id);
+        close_nothrow(fd);
+        throw;
+    }
+    return id;
+}
+
+void reactor::wakeup() STATICLIB_NOEXCEPT {
+    uint64_t one = 1;
+    ssize_t res;
+    do {
+        res = ::write(wakeup_fd, std::addressof(one), sizeof(one));
+    } while (-1 == res && EINTR == errno);
+}
+
+size_t reactor::dispatch_tasks() {
+    uint64_t val;
+    ssize_t res = ::read(wakeup_fd, std::addressof(val), sizeof(val));
+    (void) res;
+    {
+        std::lock_guard<std::mutex> guard{tasks_mutex};
+        running_tasks.swap(tasks);
+    }
+    size_t idx = 0;
+    try {
+        for (; idx < running_tasks.size(); idx++) {
+            running_tasks[idx]();
+        }
+    } catch (...) {
+        // tasks after the failed one are run on the next iteration
+        {
+            std::lock_guard<std::mutex> guard{tasks_mutex};
+            tasks.insert(tasks.begin(), std::make_move_iterator(running_tasks.begin() + idx + 1),
+                    std::make_move_iterator(running_tasks.end()));
+        }
+        running_tasks.clear();
+        wakeup();
+        throw;
+    }
+    running_tasks.clear();
+    return idx;
+}
+
+size_t reactor::dispatch_signals() {
+    size_t dispatched = 0;
+    for (;;) {
+        struct signalfd_siginfo info;
+        ssize_t res = ::read(signal_fd, std::addressof(info), sizeof(info));
+        if (static_cast<ssize_t> (sizeof(info)) != res) {
+            break;
+        }
+        auto it = signal_ids.find(static_cast<int> (info.ssi_signo));
+        if (signal_ids.end() == it) {
+            continue;
+        }
+        auto en_it = entries.find(it->second);
+        if (entries.end() == en_it) {
+            continue;
+        }
+        std::shared_ptr<entry> en = en_it->second;
+        en->signal_callback(en->signum);
+        dispatched += 1;
+    }
+    return dispatched;
+}
+
+size_t reactor::dispatch_child(uint64_t id, const std::shared_ptr<entry>& en) {
+    siginfo_t info;
+    std::memset(std::addressof(info), 0, sizeof(info));
+    int res;
+    do {
+        res = ::waitid(P_PID, static_cast<id_t> (en->pid), std::addressof(info), WEXITED | WNOHANG);
+    } while (-1 == res && EINTR == errno);
+    // not a child or already reaped
+    int code = (0 == res && en->pid == info.si_pid) ? exit_code(info) : -1;
+    remove(id);
+    en->child_callback(en->pid, code);
+    return 1;
+}
+
+size_t reactor::dispatch_timer(uint64_t id, const std::shared_ptr<entry>& en) {
+    uint64_t expirations = 0;
+    ssize_t res = ::read(en->fd, std::addressof(expirations), sizeof(expirations));
+    if (static_cast<ssize_t> (sizeof(expirations)) != res) {
+        return 0;
+    }
+    if (!en->periodic) {
+        remove(id);
+    }
+    en->timer_callback();
+    return 1;
+}
+
+void reactor::update_signal_mask() {
+    sigset_t mask;
+    sigemptyset(std::addressof(mask));
+    for (auto& pa : signal_ids) {
+        sigaddset(std::addressof(mask), pa.first);
+    }
+    if (-1 == ::signalfd(signal_fd, std::addressof(mask), 0)) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("Error updating signalfd mask: [{}]", errno_text(errno)));
+}
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   result.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 11:20 AM
+ */
+
+#include "staticlib/utils/result.hpp"
+
+namespace staticlib {
+namespace utils {
+
+const char* error_code_message(error_code code) STATICLIB_NOEXCEPT {
+    switch (code) {
+    case error_code::ok: return "Success";
+    case error_code::invalid_format: return "Invalid format";
+    case error_code::out_of_range: return "Value out of range";
+    case error_code::invalid_escape: return "Invalid escape sequence";
+    case error_code::unknown_unit: return "Unknown unit";
+    default: return "Unknown error";
+    }
+}
+
+} // namespace
+}
@@ -0,0 +1,402 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   shm_ring.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 2:45 PM
+ */
+
+#include "staticlib/utils/shm_ring.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "staticlib/support.hpp"
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const uint32_t ring_magic = 0x52494e47;
+
+const size_t min_capacity = 4096;
+
+const size_t max_capacity = 1024 * 1024 * 1024;
+
+// data starts at the page boundary after the header
+const size_t header_size = 4096;
+
+// spin iterations before the wait on futex, spinning is useless on a single CPU
+int spin_count() {
+    static int count = std::thread::hardware_concurrency() > 1 ? 256 : 0;
+    return count;
+}
+
+// positions are free-running 32-bit counters, their difference is the number
+// of used bytes; "seq" words are bumped on each wakeup so a waiter cannot
+// miss a wakeup that happened after it has checked the positions
+struct alignas(64) producer_line {
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> space_seq;
+};
+
+struct alignas(64) consumer_line {
+    std::atomic<uint32_t> tail;
+    std::atomic<uint32_t> data_seq;
+};
+
+// written rarely, only when one of the sides goes to sleep
+struct alignas(64) waiters_line {
+    std::atomic<uint32_t> reader_waiting;
+    std::atomic<uint32_t> writer_waiting;
+    std::atomic<uint32_t> closed;
+};
+
+struct ring_header {
+    uint32_t magic;
+    uint32_t capacity;
+    producer_line producer;
+    consumer_line consumer;
+    waiters_line waiters;
+};
+
+static_assert(sizeof(ring_header) <= header_size, "ring header is too large");
+
+ring_header* header(void* mapping) {
+    return static_cast<ring_header*> (mapping);
+}
+
+char* ring_data(void* mapping) {
+    return static_cast<char*> (mapping) + header_size;
+}
+
+std::string error_string(int err) {
+    return std::string(::strerror(err));
+}
+
+std::string unique_name() {
+    static std::atomic<uint32_t> counter{0};
+    auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    return "/staticlib_ring_" + sl::support::to_string(::getpid()) + "_" +
+            sl::support::to_string(counter.fetch_add(1)) + "_" + sl::support::to_string(now);
+}
+
+size_t round_capacity(size_t capacity) {
+    if (capacity > max_capacity) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Invalid ring capacity, capacity: [{}], max: [{}]", capacity, max_capacity));
+    size_t res = min_capacity;
+    while (res < capacity) {
+        res *= 2;
+    }
+    return res;
+}
+
+void* map_segment(int fd, size_t size, const std::string& name) {
+    void* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int err = errno;
+    ::close(fd);
+    if (MAP_FAILED == mem) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error mapping ring segment, name: [{}], error: [{}]", name, error_string(err)));
+    return mem;
+}
+
+uint32_t* futex_word(std::atomic<uint32_t>& val) {
+    return reinterpret_cast<uint32_t*> (std::addressof(val));
+}
+
+// wakes up the other side if it is sleeping, "waiting" flag is checked
+// after the position store, the fence pairs with the one in "wait_for"
+void notify(std::atomic<uint32_t>& waiting, std::atomic<uint32_t>& seq) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0 != waiting.load(std::memory_order_relaxed)) {
+        seq.fetch_add(1, std::memory_order_seq_cst);
+        ::syscall(SYS_futex, futex_word(seq), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+// waits until ready() returns true, returns false when deadline is passed
+template<typename Ready>
+bool wait_for(Ready ready, std::atomic<uint32_t>& waiting, std::atomic<uint32_t>& seq,
+        std::chrono::steady_clock::time_point deadline) {
+    for (int i = 0; i < spin_count(); i++) {
+        if (ready()) return true;
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif // x86
+    }
+    for (;;) {
+        uint32_t observed = seq.load(std::memory_order_seq_cst);
+        waiting.store(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+        auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) {
+            waiting.store(0, std::memory_order_relaxed);
+            return false;
+        }
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t> (left.count() / 1000000000);
+        ts.tv_nsec = static_cast<long> (left.count() % 1000000000);
+        ::syscall(SYS_futex, futex_word(seq), FUTEX_WAIT, observed, std::addressof(ts), nullptr, 0);
+    }
+}
+
+} // namespace
+
+shm_ring::shm_ring(size_t capacity) :
+mapping(nullptr),
+mapping_size(0),
+name(unique_name()),
+owner(true),
+cached_head(0),
+cached_tail(0) {
+    size_t cap = round_capacity(capacity);
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error creating ring segment, name: [{}], error: [{}]", name, error_string(errno)));
+    if (0 != ::ftruncate(fd, static_cast<off_t> (header_size + cap))) {
+        int err = errno;
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Error sizing ring segment, name: [{}], error: [{}]", name, error_string(err)));
+    }
+    try {
+        mapping = map_segment(fd, header_size + cap, name);
+    } catch (...) {
+        ::shm_unlink(name.c_str());
+        throw;
+    }
+    mapping_size = header_size + cap;
+    ring_header* hdr = header(mapping);
+    hdr->capacity = static_cast<uint32_t> (cap);
+    hdr->magic = ring_magic;
+}
+
+shm_ring::shm_ring(const std::string& handle) :
+mapping(nullptr),
+mapping_size(0),
+name(handle),
+owner(false),
+cached_head(0),
+cached_tail(0) {
+    int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (-1 == fd) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "Error opening ring segment, name: [{}], error: [{}]", name, error_string(errno)));
+    struct stat st;
+    if (0 != ::fstat(fd, std::addressof(st)) || st.st_size < static_cast<off_t> (header_size + min_capacity)) {
+        ::close(fd);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid ring segment size, name: [{}]", name));
+    }
+    mapping_size = static_cast<size_t> (st.st_size);
+    mapping = map_segment(fd, mapping_size, name);
+    ring_header* hdr = header(mapping);
+    if (ring_magic != hdr->magic || header_size + hdr->capacity != mapping_size) {
+        ::munmap(mapping, mapping_size);
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid ring segment header, name: [{}]", name));
+    }
+    cached_head = hdr->producer.head.load(std::memory_order_acquire);
+    cached_tail = hdr->consumer.tail.load(std::memory_order_acquire);
+}
+
+shm_ring::shm_ring(shm_ring&& other) STATICLIB_NOEXCEPT :
+mapping(other.mapping),
+mapping_size(other.mapping_size),
+name(std::move(other.name)),
+owner(other.owner),
+cached_head(other.cached_head),
+cached_tail(other.cached_tail) {
+    other.mapping = nullptr;
+    other.mapping_size = 0;
+    other.owner = false;
+}
+
+shm_ring& shm_ring::operator=(shm_ring&& other) STATICLIB_NOEXCEPT {
+    shm_ring tmp{std::move(*this)};
+    mapping = other.mapping;
+    mapping_size = other.mapping_size;
+    name = std::move(other.name);
+    owner = other.owner;
+    cached_head = other.cached_head;
+    cached_tail = other.cached_tail;
+    other.mapping = nullptr;
+    other.mapping_size = 0;
+    other.owner = false;
+    return *this;
+}
+
+shm_ring::~shm_ring() STATICLIB_NOEXCEPT {
+    unlink();
+    if (nullptr != mapping) {
+        ::munmap(mapping, mapping_size);
+    }
+}
+
+const std::string& shm_ring::handle() const STATICLIB_NOEXCEPT {
+    return name;
+}
+
+void shm_ring::unlink() STATICLIB_NOEXCEPT {
+    if (owner) {
+        ::shm_unlink(name.c_str());
+        owner = false;
+    }
+}
+
+size_t shm_ring::capacity() const STATICLIB_NOEXCEPT {
+    return mapping_size - header_size;
+}
+
+size_t shm_ring::available() const STATICLIB_NOEXCEPT {
+    ring_header* hdr = header(mapping);
+    uint32_t head = hdr->producer.head.load(std::memory_order_acquire);
+    uint32_t tail = hdr->consumer.tail.load(std::memory_order_acquire);
+    uint32_t used = head - tail;
+    return used <= capacity() ? used : 0;
+}
+
+size_t shm_ring::try_write(const char* data, size_t length) STATICLIB_NOEXCEPT {
+    ring_header* hdr = header(mapping);
+    // capacity in the header is checked on attach, peer may overwrite it later
+    uint32_t cap = static_cast<uint32_t> (capacity());
+    uint32_t head = hdr->producer.head.load(std::memory_order_relaxed);
+    uint32_t used = head - cached_tail;
+    if (used > cap || cap - used < length) {
+        // refresh reader position only when the cached one is not enough
+        cached_tail = hdr->consumer.tail.load(std::memory_order_acquire);
+        used = head - cached_tail;
+    }
+    if (used > cap) {
+        // positions are written by the peer, ring is corrupted
+        close();
+        return 0;
+    }
+    size_t free_space = cap - used;
+    size_t count = length < free_space ? length : free_space;
+    if (0 == count) {
+        return 0;
+    }
+    size_t offset = head & (cap - 1);
+    size_t first = cap - offset < count ? cap - offset : count;
+    char* dest = ring_data(mapping);
+    std::memcpy(dest + offset, data, first);
+    std::memcpy(dest, data + first, count - first);
+    hdr->producer.head.store(head + static_cast<uint32_t> (count), std::memory_order_release);
+    notify(hdr->waiters.reader_waiting, hdr->consumer.data_seq);
+    return count;
+}
+
+size_t shm_ring::write(const char* data, size_t length, std::chrono::milliseconds timeout) {
+    ring_header* hdr = header(mapping);
+    uint32_t cap = static_cast<uint32_t> (capacity());
+    size_t written = try_write(data, length);
+    // single deadline for all the waits, timeout limits the whole call
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (written < length) {
+        if (closed()) {
+            break;
+        }
+        bool has_space = wait_for([hdr, cap] {
+            uint32_t head = hdr->producer.head.load(std::memory_order_relaxed);
+            return head - hdr->consumer.tail.load(std::memory_order_acquire) != cap ||
+                    0 != hdr->waiters.closed.load(std::memory_order_acquire);
+        }, hdr->waiters.writer_waiting, hdr->producer.space_seq, deadline);
+        if (!has_space) {
+            break;
+        }
+        written += try_write(data + written, length - written);
+    }
+    return written;
+}
+
+size_t shm_ring::try_read(char* buf, size_t length) STATICLIB_NOEXCEPT {
+    ring_header* hdr = header(mapping);
+    uint32_t cap = static_cast<uint32_t> (capacity());
+    uint32_t tail = hdr->consumer.tail.load(std::memory_order_relaxed);
+    uint32_t used = cached_head - tail;
+    if (used > cap || used < length) {
+        cached_head = hdr->producer.head.load(std::memory_order_acquire);
+        used = cached_head - tail;
+    }
+    if (used > cap) {
+        // positions are written by the peer, ring is corrupted
+        close();
+        return 0;
+    }
+    size_t count = length < used ? length : used;
+    if (0 == count) {
+        return 0;
+    }
+    size_t offset = tail & (cap - 1);
+    size_t first = cap - offset < count ? cap - offset : count;
+    const char* src = ring_data(mapping);
+    std::memcpy(buf, src + offset, first);
+    std::memcpy(buf + first, src, count - first);
+    hdr->consumer.tail.store(tail + static_cast<uint32_t> (count), std::memory_order_release);
+    notify(hdr->waiters.writer_waiting, hdr->producer.space_seq);
+    return count;
+}
+
+size_t shm_ring::read(char* buf, size_t length, std::chrono::milliseconds timeout) {
+    size_t count = try_read(buf, length);
+    if (count > 0 || 0 == length) {
+        return count;
+    }
+    ring_header* hdr = header(mapping);
+    bool has_data = wait_for([hdr] {
+        return hdr->producer.head.load(std::memory_order_acquire) != hdr->consumer.tail.load(std::memory_order_relaxed) ||
+                0 != hdr->waiters.closed.load(std::memory_order_acquire);
+    }, hdr->waiters.reader_waiting, hdr->consumer.data_seq, std::chrono::steady_clock::now() + timeout);
+    return has_data ? try_read(buf, length) : 0;
+}
+
+void shm_ring::close() STATICLIB_NOEXCEPT {
+    ring_header* hdr = header(mapping);
+    hdr->waiters.closed.store(1, std::memory_order_release);
+    notify(hdr->waiters.reader_waiting, hdr->consumer.data_seq);
+    notify(hdr->waiters.writer_waiting, hdr->producer.space_seq);
+}
+
+bool shm_ring::closed() const STATICLIB_NOEXCEPT {
+    return 0 != header(mapping)->waiters.closed.load(std::memory_order_acquire);
+}
+
+} // namespace
+}
+
+#endif // STATICLIB_LINUX
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_interner.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 1:34 PM
+ */
+
+#include "staticlib/utils/string_interner.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "staticlib/utils/arena.hpp"
+#include "staticlib/utils/hash_utils.hpp"
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const uint32_t shard_bits = 4;
+const size_t shards_count = 1 << shard_bits;
+const size_t segments_count = 20;
+const size_t first_segment_size = 256;
+// fits into (32 - shard_bits) bits of ID
+const size_t max_entries_per_shard = first_segment_size * ((static_cast<size_t> (1) << segments_count) - 1);
+const size_t initial_table_size = 64;
+const size_t cache_line_size = 64;
+
+struct entry {
+    uint64_t hash;
+    const char* data;
+    size_t length;
+    uint32_t id;
+};
+
+struct table {
+    size_t mask;
+    std::unique_ptr<std::atomic<entry*>[]> slots;
+
+    explicit table(size_t size) :
+    mask(size - 1),
+    slots(new std::atomic<entry*>[size]()) { }
+};
+
+// segment k holds (first_segment_size << k) entries
+void segment_position(size_t idx, size_t& segment, size_t& offset) {
+    size_t t = idx / first_segment_size + 1;
+    segment = 0;
+    while (t > 1) {
+        t >>= 1;
+        segment += 1;
+    }
+    offset = idx - first_segment_size * ((static_cast<size_t> (1) << segment) - 1);
+}
+
+entry* table_find(const table* tb, uint64_t hash, const char* data, size_t length) {
+    size_t idx = static_cast<size_t> (hash) & tb->mask;
+    for (;;) {
+        entry* en = tb->slots[idx].load(std::memory_order_acquire);
+        if (nullptr == en) {
+            return nullptr;
+        }
+        if (en->hash == hash && en->length == length && 0 == std::memcmp(en->data, data, length)) {
+            return en;
+        }
+        idx = (idx + 1) & tb->mask;
+    }
+}
+
+void table_insert(table* tb, entry* en) {
+    size_t idx = static_cast<size_t> (en->hash) & tb->mask;
+    while (nullptr != tb->slots[idx].load(std::memory_order_relaxed)) {
+        idx = (idx + 1) & tb->mask;
+    }
+    tb->slots[idx].store(en, std::memory_order_release);
+}
+
+interned_string to_handle(const entry* en) {
+    interned_string res;
+    res.id = en->id;
+    res.data = en->data;
+    res.length = en->length;
+    return res;
+}
+
+struct shard {
+    std::mutex mutex;
+    arena storage;
+    std::atomic<table*> current;
+    std::vector<std::unique_ptr<table>> tables;
+    std::atomic<std::atomic<entry*>*> segments[segments_count];
+    std::vector<std::unique_ptr<std::atomic<entry*>[]>> segments_owner;
+    std::atomic<size_t> count;
+    // keep shards on separate cache lines
+    char padding[cache_line_size];
+
+    shard() :
+    current(nullptr),
+    count(0) {
+        tables.emplace_back(new table(initial_table_size));
+        current.store(tables.back().get(), std::memory_order_release);
+        for (size_t i = 0; i < segments_count; i++) {
+            segments[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    shard(const shard&) = delete;
+
+    shard& operator=(const shard&) = delete;
+
+    // must be called under lock
+    void publish(entry* en, size_t local_idx) {
+        size_t seg = 0;
+        size_t offset = 0;
+        segment_position(local_idx, seg, offset);
+        std::atomic<entry*>* segment = segments[seg].load(std::memory_order_relaxed);
+        if (nullptr == segment) {
+            segments_owner.emplace_back(new std::atomic<entry*>[first_segment_size << seg]());
+            segment = segments_owner.back().get();
+            segments[seg].store(segment, std::memory_order_release);
+        }
+        segment[offset].store(en, std::memory_order_release);
+        table* tb = current.load(std::memory_order_relaxed);
+        if ((local_idx + 1) * 2 > tb->mask + 1) {
+            // old tables are kept alive for concurrent readers
+            tables.emplace_back(new table((tb->mask + 1) * 2));
+            table* grown = tables.back().get();
+            for (size_t i = 0; i <= tb->mask; i++) {
+                entry* existing = tb->slots[i].load(std::memory_order_relaxed);
+                if (nullptr != existing) {
+                    table_insert(grown, existing);
+                }
+            }
+            table_insert(grown, en);
+            current.store(grown, std::memory_order_release);
+        } else {
+            table_insert(tb, en);
+        }
+        count.store(local_idx + 1, std::memory_order_release);
+    }
+
+    entry* get(size_t local_idx) const {
+        if (local_idx >= count.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        size_t seg = 0;
+        size_t offset = 0;
+        segment_position(local_idx, seg, offset);
+        std::atomic<entry*>* segment = segments[seg].load(std::memory_order_acquire);
+        return segment[offset].load(std::memory_order_acquire);
+    }
+};
+
+} // namespace
+
+class string_interner::impl {
+    shard shards[shards_count];
+
+public:
+    interned_string intern(const char* data, size_t length) {
+        uint64_t hash = hash64(data, length, 0);
+        size_t shard_idx = static_cast<size_t> (hash >> (64 - shard_bits));
+        shard& sh = shards[shard_idx];
+        entry* found = table_find(sh.current.load(std::memory_order_acquire), hash, data, length);
+        if (nullptr != found) {
+            return to_handle(found);
+        }
+        std::lock_guard<std::mutex> guard{sh.mutex};
+        found = table_find(sh.current.load(std::memory_order_relaxed), hash, data, length);
+        if (nullptr != found) {
+            return to_handle(found);
+        }
+        size_t local_idx = sh.count.load(std::memory_order_relaxed);
+        if (local_idx >= max_entries_per_shard) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION,
+                STATICLIB_UTILS_FORMAT("String interner IDs space exhausted, shard: [{}]", shard_idx));
+        void* mem = sh.storage.allocate(sizeof(entry) + length + 1, alignof(entry));
+        entry* en = ::new (mem) entry();
+        char* en_data = static_cast<char*> (mem) + sizeof(entry);
+        std::memcpy(en_data, data, length);
+        en_data[length] = '\0';
+        en->hash = hash;
+        en->data = en_data;
+        en->length = length;
+        en->id = static_cast<uint32_t> ((local_idx << shard_bits) | shard_idx);
+        sh.publish(en, local_idx);
+        return to_handle(en);
+    }
+
+    bool find(const char* data, size_t length, interned_string& out) const STATICLIB_NOEXCEPT {
+        uint64_t hash = hash64(data, length, 0);
+        const shard& sh = shards[hash >> (64 - shard_bits)];
+        entry* found = table_find(sh.current.load(std::memory_order_acquire), hash, data, length);
+        if (nullptr == found) {
+            return false;
+        }
+        out = to_handle(found);
+        return true;
+    }
+
+    interned_string get(uint32_t id) const {
+        const shard& sh = shards[id & (shards_count - 1)];
+        entry* en = sh.get(id >> shard_bits);
+        if (nullptr == en) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "Invalid interned string ID: [{}]", id));
+        return to_handle(en);
+    }
+
+    size_t size() const STATICLIB_NOEXCEPT {
+        size_t res = 0;
+        for (const shard& sh : shards) {
+            res += sh.count.load(std::memory_order_acquire);
+        }
+        return res;
+    }
+};
+
+string_interner::string_interner() :
+pimpl(new impl()) { }
+
+string_interner::string_interner(string_interner&& other) STATICLIB_NOEXCEPT :
+pimpl(std::move(other.pimpl)) { }
+
+string_interner& string_interner::operator=(string_interner&& other) STATICLIB_NOEXCEPT {
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+string_interner::~string_interner() STATICLIB_NOEXCEPT { }
+
+interned_string string_interner::intern(const char* data, size_t length) {
+    return pimpl->intern(data, length);
+}
+
+interned_string string_interner::intern(const std::string& str) {
+    return pimpl->intern(str.data(), str.length());
+}
+
+bool string_interner::find(const char* data, size_t length, interned_string& out) const STATICLIB_NOEXCEPT {
+    return pimpl->find(data, length, out);
+}
+
+bool string_interner::find(const std::string& str, interned_string& out) const STATICLIB_NOEXCEPT {
+    return pimpl->find(str.data(), str.length(), out);
+}
+
+interned_string string_interner::get(uint32_t id) const {
+    return pimpl->get(id);
+}
+
+size_t string_interner::size() const STATICLIB_NOEXCEPT {
+    return pimpl->size();
+}
+
+} // namespace
+}
@@ -31,9 +31,19 @@
 #include <exception>
 #include <sstream>
 
+#include "staticlib/utils/instrumentation.hpp"
+
 namespace staticlib {
 namespace utils {
 
+namespace { // anonymous
+
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(split_stats, "split");
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(trim_stats, "trim");
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(replace_all_stats, "replace_all");
+
+} // namespace
+
 char* alloc_copy(const std::string& str) STATICLIB_NOEXCEPT {
     auto len = str.length();
     char* msg = static_cast<char*> (malloc(len + 1));
@@ -48,7 +58,16 @@ char* alloc_copy(const std::string& str) STATICLIB_NOEXCEPT {
     return msg;
 }
 
+char* alloc_copy(const std::string& str, arena& ar) {
+    auto len = str.length();
+    char* msg = static_cast<char*> (ar.allocate(len + 1, 1));
+    msg[len] = '\0';
+    memcpy(msg, str.c_str(), len);
+    return msg;
+}
+
 std::vector<std::string> split(const std::string& str, char delim) {
+    STATICLIB_UTILS_INSTRUMENT(split_stats, str.length());
     std::stringstream ss{str};
     std::vector<std::string> res{};
     std::string item{};    
@@ -60,17 +79,50 @@ std::vector<std::string> split(const std::string& str, char delim) {
     return res;
 }
 
-// http://stackoverflow.com/a/8095276/314015
-bool starts_with(const std::string& value, const std::string& start) {
-    return 0 == value.compare(0, start.length(), start);
+arena_string_vector split(const std::string& str, char delim, arena& ar) {
+    STATICLIB_UTILS_INSTRUMENT(split_stats, str.length());
+    // count parts first to allocate vector storage only once
+    size_t count = 0;
+    size_t start = 0;
+    while (start < str.length()) {
+        size_t pos = str.find(delim, start);
+        if (std::string::npos == pos) {
+            pos = str.length();
+        }
+        if (pos > start) {
+            count += 1;
+        }
+        start = pos + 1;
+    }
+    arena_string_vector res{arena_allocator<arena_string>(ar)};
+    res.reserve(count);
+    start = 0;
+    while (start < str.length()) {
+        size_t pos = str.find(delim, start);
+        if (std::string::npos == pos) {
+            pos = str.length();
+        }
+        if (pos > start) {
+            res.emplace_back(str.data() + start, pos - start, arena_allocator<char>(ar));
+        }
+        start = pos + 1;
+    }
+    return res;
 }
 
-// http://stackoverflow.com/a/874160/314015
-bool ends_with(std::string const& value, std::string const& ending) {
-    if (value.length() >= ending.length()) {
-        return (0 == value.compare(value.length() - ending.length(), ending.length(), ending));
-    } else {
-        return false;
+void split(const std::string& str, char delim, std::vector<inline_string>& out) {
+    STATICLIB_UTILS_INSTRUMENT(split_stats, str.length());
+    out.clear();
+    size_t start = 0;
+    while (start < str.length()) {
+        size_t pos = str.find(delim, start);
+        if (std::string::npos == pos) {
+            pos = str.length();
+        }
+        if (pos > start) {
+            out.emplace_back(str.data() + start, pos - start);
+        }
+        start = pos + 1;
     }
 }
 
@@ -95,8 +147,26 @@ std::string strip_parent_dir(const std::string& file_path) {
     return std::string(file_path, pos + 1);
 }
 
+void strip_parent_dir(const std::string& file_path, inline_string& out) {
+    auto is_slash = [](char ch) {
+        return '/' == ch || '\\' == ch;
+    };
+    // same as above, but trailing slashes are skipped without copying the path
+    size_t end = file_path.length();
+    while (end > 0 && is_slash(file_path[end - 1])) {
+        end -= 1;
+    }
+    size_t start = end;
+    while (start > 0 && !is_slash(file_path[start - 1])) {
+        start -= 1;
+    }
+    // whole path is written if there are no separators before the filename
+    out.assign(file_path.data() + start, file_path.length() - start);
+}
+
 // http://stackoverflow.com/a/17976541
 std::string trim(const std::string& s) {
+    STATICLIB_UTILS_INSTRUMENT(trim_stats, s.length());
     auto wsfront = std::find_if_not(s.begin(), s.end(), [](int c) {
         return std::isspace(c);
     });
@@ -105,20 +175,30 @@ std::string trim(const std::string& s) {
     }).base());
 }
 
-// http://stackoverflow.com/a/27813
-bool iequals(const std::string& str1, const std::string& str2) {
-    if (str1.size() != str2.size()) {
-        return false;
-    }
-    for (std::string::const_iterator c1 = str1.begin(), c2 = str2.begin(); c1 != str1.end(); ++c1, ++c2) {
-        if (std::tolower(*c1) != std::tolower(*c2)) {
-            return false;
-        }
-    }
-    return true;
+arena_string trim(const std::string& s, arena& ar) {
+    STATICLIB_UTILS_INSTRUMENT(trim_stats, s.length());
+    auto wsfront = std::find_if_not(s.begin(), s.end(), [](int c) {
+        return std::isspace(c);
+    });
+    auto wsback = std::find_if_not(s.rbegin(), std::string::const_reverse_iterator(wsfront), [](int c) {
+        return std::isspace(c);
+    }).base();
+    return arena_string(wsfront, wsback, arena_allocator<char>(ar));
+}
+
+void trim(const std::string& s, inline_string& out) {
+    STATICLIB_UTILS_INSTRUMENT(trim_stats, s.length());
+    auto wsfront = std::find_if_not(s.begin(), s.end(), [](int c) {
+        return std::isspace(c);
+    });
+    auto wsback = std::find_if_not(s.rbegin(), std::string::const_reverse_iterator(wsfront), [](int c) {
+        return std::isspace(c);
+    }).base();
+    out.assign(s.data() + (wsfront - s.begin()), static_cast<size_t> (wsback - wsfront));
 }
 
 std::string& replace_all(std::string& str, const std::string& snippet, const std::string& replacement) {
+    STATICLIB_UTILS_INSTRUMENT(replace_all_stats, str.length());
     if (snippet.empty()) {
         return str;
     }
@@ -129,11 +209,10 @@ std::string& replace_all(std::string& str, const std::string& snippet, const std
     return str;
 }
 
-const std::string& empty_string() {
-    static std::string empty{""};
-    return empty;
+} // namespace
 }
 
-} // namespace
-} 
+#ifndef STATICLIB_UTILS_INLINE
+#include "staticlib/utils/string_utils_inline.hpp"
+#endif // STATICLIB_UTILS_INLINE
 
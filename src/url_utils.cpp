@@ -25,26 +25,55 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <utility>
+
+#include "staticlib/utils/instrumentation.hpp"
 
 namespace staticlib {
 namespace utils {
 
+namespace { // anonymous
+
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(url_decode_stats, "url_decode");
+STATICLIB_UTILS_INSTRUMENTED_FUNCTION(url_encode_stats, "url_encode");
+
+int hex_digit(char ch) {
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+} // namespace
+
 std::string url_decode(const std::string& str) {
-    char decode_buf[3];
     std::string result;
-    result.reserve(str.size());
+    url_decode(str.data(), str.size(), result);
+    return result;
+}
 
-    for (std::string::size_type pos = 0; pos < str.size(); ++pos) {
-        switch (str[pos]) {
+void url_decode(const char* data, size_t length, std::string& result) {
+    STATICLIB_UTILS_INSTRUMENT(url_decode_stats, length);
+    char decode_buf[3];
+    result.reserve(result.size() + length);
+
+    for (size_t pos = 0; pos < length; ++pos) {
+        switch (data[pos]) {
         case '+':
             // convert to space character
             result += ' ';
             break;
         case '%':
             // decode hexadecimal value
-            if (pos + 2 < str.size()) {
-                decode_buf[0] = str[++pos];
-                decode_buf[1] = str[++pos];
+            if (pos + 2 < length) {
+                decode_buf[0] = data[++pos];
+                decode_buf[1] = data[++pos];
                 decode_buf[2] = '\0';
 
                 char decoded_char = static_cast<char> (std::strtol(decode_buf, 0, 16));
@@ -64,14 +93,42 @@ std::string url_decode(const std::string& str) {
             break;
         default:
             // character does not need to be escaped
-            result += str[pos];
+            result += data[pos];
         }
     };
+}
 
-    return result;
+result<std::string> try_url_decode(const std::string& str) {
+    STATICLIB_UTILS_INSTRUMENT(url_decode_stats, str.length());
+    std::string decoded;
+    decoded.reserve(str.length());
+    for (size_t pos = 0; pos < str.length(); ++pos) {
+        switch (str[pos]) {
+        case '+':
+            decoded += ' ';
+            break;
+        case '%': {
+            if (pos + 2 >= str.length()) {
+                return error_code::invalid_escape;
+            }
+            int high = hex_digit(str[pos + 1]);
+            int low = hex_digit(str[pos + 2]);
+            if (high < 0 || low < 0) {
+                return error_code::invalid_escape;
+            }
+            decoded += static_cast<char> ((high << 4) | low);
+            pos += 2;
+            break;
+        }
+        default:
+            decoded += str[pos];
+        }
+    }
+    return result<std::string>(std::move(decoded));
 }
 
 std::string url_encode(const std::string& str) {
+    STATICLIB_UTILS_INSTRUMENT(url_encode_stats, str.length());
     char encode_buf[4];
     std::string result;
     encode_buf[0] = '%';
@@ -0,0 +1,919 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utf_utils.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 2:35 PM
+ */
+
+#include "staticlib/utils/utf_utils.hpp"
+
+#include <cstdint>
+
+#include "staticlib/utils/cpu_features.hpp"
+
+#ifdef STATICLIB_UTILS_X86_SIMD
+#include <immintrin.h>
+#endif // STATICLIB_UTILS_X86_SIMD
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const uint32_t replacement_char = 0xFFFD;
+
+// scalar code runs at least this many input units before SIMD kernel is retried
+const size_t scalar_run = 32;
+
+// number of input units transcoded through the stack buffer at once
+const size_t chunk_units = 1024;
+
+#ifdef STATICLIB_UTILS_X86_SIMD
+
+// ASCII fast paths, each kernel stops at the first block that contains non-ASCII
+// units and returns the number of input units converted
+
+__attribute__((target("ssse3")))
+size_t ascii_utf8_to_16_ssse3(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        if (0 != _mm_movemask_epi8(in)) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i * 2), _mm_unpacklo_epi8(in, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i * 2 + 16), _mm_unpackhi_epi8(in, zero));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t ascii_utf8_to_16_avx2(const unsigned char* src, size_t len, unsigned char* dst) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        if (0 != _mm256_movemask_epi8(in)) break;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i * 2),
+                _mm256_cvtepu8_epi16(_mm256_castsi256_si128(in)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i * 2 + 32),
+                _mm256_cvtepu8_epi16(_mm256_extracti128_si256(in, 1)));
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t ascii_utf8_to_32_ssse3(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        if (0 != _mm_movemask_epi8(in)) break;
+        __m128i lo = _mm_unpacklo_epi8(in, zero);
+        __m128i hi = _mm_unpackhi_epi8(in, zero);
+        unsigned char* out = dst + i * 4;
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (out), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (out + 16), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (out + 32), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (out + 48), _mm_unpackhi_epi16(hi, zero));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t ascii_utf8_to_32_avx2(const unsigned char* src, size_t len, unsigned char* dst) {
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        if (0 != _mm256_movemask_epi8(in)) break;
+        for (size_t j = 0; j < 32; j += 8) {
+            __m128i part = _mm_loadl_epi64(reinterpret_cast<const __m128i*> (src + i + j));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + (i + j) * 4), _mm256_cvtepu8_epi32(part));
+        }
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t ascii_utf16_to_8_ssse3(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m128i mask = _mm_set1_epi16(static_cast<short> (0xff80));
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i * 2));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i * 2 + 16));
+        __m128i high = _mm_and_si128(_mm_or_si128(a, b), mask);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi16(high, zero))) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t ascii_utf16_to_8_avx2(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m256i mask = _mm256_set1_epi16(static_cast<short> (0xff80));
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i * 2));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i * 2 + 32));
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask)) break;
+        // packus works within 128-bit lanes, restore the order of 64-bit quarters
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i), packed);
+    }
+    return i;
+}
+
+__attribute__((target("ssse3")))
+size_t ascii_utf32_to_8_ssse3(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m128i mask = _mm_set1_epi32(static_cast<int> (0xffffff80));
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*> (src + i * 4);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        __m128i d = _mm_loadu_si128(in + 3);
+        __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), mask);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi32(high, zero))) break;
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + i), packed);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t ascii_utf32_to_8_avx2(const unsigned char* src, size_t len, unsigned char* dst) {
+    const __m256i mask = _mm256_set1_epi32(static_cast<int> (0xffffff80));
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        const __m256i* in = reinterpret_cast<const __m256i*> (src + i * 4);
+        __m256i a = _mm256_loadu_si256(in);
+        __m256i b = _mm256_loadu_si256(in + 1);
+        __m256i c = _mm256_loadu_si256(in + 2);
+        __m256i d = _mm256_loadu_si256(in + 3);
+        if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), mask)) break;
+        __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*> (dst + i), _mm256_permutevar8x32_epi32(packed, order));
+    }
+    return i;
+}
+
+// validation, John Keiser, Daniel Lemire: https://arxiv.org/abs/2010.03090
+// each pair of consecutive bytes is classified with three 16-entry lookups (high
+// and low nibbles of the first byte and high nibble of the second byte), the pair
+// is invalid if the same error bit is set in all three results
+
+const uint8_t too_short = 1 << 0; // 11______ 0_______ or 11______ 11______
+const uint8_t too_long = 1 << 1; // 0_______ 10______
+const uint8_t overlong_3 = 1 << 2; // 11100000 100_____
+const uint8_t too_large = 1 << 3; // 11110100 1001____ and higher
+const uint8_t surrogate = 1 << 4; // 11101101 101_____
+const uint8_t overlong_2 = 1 << 5; // 1100000_ 10______
+const uint8_t too_large_1000 = 1 << 6; // 11110101 1000____ and higher
+const uint8_t overlong_4 = 1 << 6; // 11110000 1000____
+const uint8_t two_conts = 1 << 7; // 10______ 10______
+const uint8_t carry = too_short | too_long | two_conts;
+
+struct validation_luts {
+    uint8_t byte_1_high[16];
+    uint8_t byte_1_low[16];
+    uint8_t byte_2_high[16];
+    // last three bytes are the max values that do not start a sequence longer than the rest of the block
+    uint8_t incomplete_max[32];
+};
+
+const validation_luts validation = {
+    {
+        // 0_______
+        too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+        // 10______
+        two_conts, two_conts, two_conts, two_conts,
+        // 1100____
+        too_short | overlong_2,
+        // 1101____
+        too_short,
+        // 1110____
+        too_short | overlong_3 | surrogate,
+        // 1111____
+        too_short | too_large | too_large_1000 | overlong_4
+    },
+    {
+        // ____0000
+        carry | overlong_3 | overlong_2 | overlong_4,
+        // ____0001
+        carry | overlong_2,
+        // ____001_
+        carry, carry,
+        // ____0100
+        carry | too_large,
+        // ____0101 - ____1100
+        carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+        // ____1101
+        carry | too_large | too_large_1000 | surrogate,
+        // ____111_
+        carry | too_large | too_large_1000, carry | too_large | too_large_1000
+    },
+    {
+        // 0_______
+        too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+        // 1000____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        // 1001____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        // 101_____
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        // 11______
+        too_short, too_short, too_short, too_short
+    },
+    {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+    }
+};
+
+__attribute__((target("ssse3")))
+inline __m128i utf8_errors_ssse3(__m128i in, __m128i prev_in) {
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i b1h = _mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_1_high));
+    const __m128i b1l = _mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_1_low));
+    const __m128i b2h = _mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_2_high));
+    __m128i prev1 = _mm_alignr_epi8(in, prev_in, 15);
+    __m128i special = _mm_and_si128(
+            _mm_and_si128(_mm_shuffle_epi8(b1h, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                    _mm_shuffle_epi8(b1l, _mm_and_si128(prev1, nibble))),
+            _mm_shuffle_epi8(b2h, _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+    // third and fourth bytes of 3 and 4 bytes sequences must be continuations
+    __m128i prev2 = _mm_alignr_epi8(in, prev_in, 14);
+    __m128i prev3 = _mm_alignr_epi8(in, prev_in, 13);
+    __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char> (0xe0 - 0x80)));
+    __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char> (0xf0 - 0x80)));
+    __m128i must_be_cont = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char> (0x80)));
+    return _mm_xor_si128(must_be_cont, special);
+}
+
+// returns the offset, all sequences before which are valid
+__attribute__((target("ssse3")))
+size_t utf8_validate_ssse3(const unsigned char* src, size_t len) {
+    const __m128i incomplete_max = _mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.incomplete_max + 16));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i prev_in = zero;
+    __m128i prev_incomplete = zero;
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        __m128i err;
+        if (0 == _mm_movemask_epi8(in)) {
+            err = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            err = utf8_errors_ssse3(in, prev_in);
+            prev_incomplete = _mm_subs_epu8(in, incomplete_max);
+        }
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(err, zero))) break;
+        prev_in = in;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline __m256i utf8_errors_avx2(__m256i in, __m256i prev_in) {
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i b1h = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_1_high)));
+    const __m256i b1l = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_1_low)));
+    const __m256i b2h = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*> (validation.byte_2_high)));
+    // alignr works within 128-bit lanes, so the preceding bytes are taken from the
+    // [prev_in.hi, in.lo] combination
+    __m256i shifted = _mm256_permute2x128_si256(prev_in, in, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(in, shifted, 15);
+    __m256i special = _mm256_and_si256(
+            _mm256_and_si256(_mm256_shuffle_epi8(b1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                    _mm256_shuffle_epi8(b1l, _mm256_and_si256(prev1, nibble))),
+            _mm256_shuffle_epi8(b2h, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+    __m256i prev2 = _mm256_alignr_epi8(in, shifted, 14);
+    __m256i prev3 = _mm256_alignr_epi8(in, shifted, 13);
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char> (0xe0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char> (0xf0 - 0x80)));
+    __m256i must_be_cont = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char> (0x80)));
+    return _mm256_xor_si256(must_be_cont, special);
+}
+
+__attribute__((target("avx2")))
+size_t utf8_validate_avx2(const unsigned char* src, size_t len) {
+    const __m256i incomplete_max = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (validation.incomplete_max));
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i prev_in = zero;
+    __m256i prev_incomplete = zero;
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        // ASCII check for two registers at once
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        __m256i in2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i + 32));
+        __m256i err;
+        if (0 == _mm256_movemask_epi8(_mm256_or_si256(in, in2))) {
+            err = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            err = _mm256_or_si256(utf8_errors_avx2(in, prev_in), utf8_errors_avx2(in2, in));
+            prev_incomplete = _mm256_subs_epu8(in2, incomplete_max);
+        }
+        if (!_mm256_testz_si256(err, err)) return i;
+        prev_in = in2;
+    }
+    for (; i + 32 <= len; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*> (src + i));
+        __m256i err;
+        if (0 == _mm256_movemask_epi8(in)) {
+            err = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            err = utf8_errors_avx2(in, prev_in);
+            prev_incomplete = _mm256_subs_epu8(in, incomplete_max);
+        }
+        if (!_mm256_testz_si256(err, err)) break;
+        prev_in = in;
+    }
+    return i;
+}
+
+// shuffle controls that move the 16-bit lanes selected by the 8-bit mask
+// to the front of the register, unused lanes are zeroed
+struct compact_luts {
+    uint8_t shuffle[256][16];
+    // popcount is a library call without the target support
+    uint8_t count[256];
+
+    compact_luts() {
+        for (size_t mask = 0; mask < 256; mask++) {
+            size_t pos = 0;
+            for (size_t lane = 0; lane < 8; lane++) {
+                if (0 != (mask & (1u << lane))) {
+                    shuffle[mask][pos * 2] = static_cast<uint8_t> (lane * 2);
+                    shuffle[mask][pos * 2 + 1] = static_cast<uint8_t> (lane * 2 + 1);
+                    pos += 1;
+                }
+            }
+            count[mask] = static_cast<uint8_t> (pos);
+            for (; pos < 8; pos++) {
+                shuffle[mask][pos * 2] = 0x80;
+                shuffle[mask][pos * 2 + 1] = 0x80;
+            }
+        }
+    }
+};
+
+const compact_luts& compact() {
+    static compact_luts cl{};
+    return cl;
+}
+
+// code points of the sequences ending at each of 8 bytes, `b`, `p1` and `p2` are
+// the bytes, preceding bytes and bytes two positions before, widened to 16 bits
+__attribute__((target("ssse3")))
+inline __m128i utf8_code_points_ssse3(__m128i b, __m128i p1, __m128i p2) {
+    const __m128i low_6 = _mm_set1_epi16(0x3f);
+    __m128i cont = _mm_and_si128(b, low_6);
+    __m128i cp2 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(p1, _mm_set1_epi16(0x1f)), 6), cont);
+    __m128i cp3 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(p2, _mm_set1_epi16(0x0f)), 12),
+            _mm_or_si128(_mm_slli_epi16(_mm_and_si128(p1, low_6), 6), cont));
+    __m128i is_ascii = _mm_cmplt_epi16(b, _mm_set1_epi16(0x80));
+    __m128i is_two = _mm_cmpgt_epi16(p1, _mm_set1_epi16(0xbf));
+    __m128i multi = _mm_or_si128(_mm_and_si128(is_two, cp2), _mm_andnot_si128(is_two, cp3));
+    return _mm_or_si128(_mm_and_si128(is_ascii, b), _mm_andnot_si128(is_ascii, multi));
+}
+
+// stores up to 8 code points, UTF-32 output is widened from 16-bit lanes
+__attribute__((target("ssse3")))
+inline void utf8_store_units_ssse3(__m128i units, unsigned char* dst, size_t unit_size) {
+    if (2 == unit_size) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst), units);
+    } else {
+        const __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst), _mm_unpacklo_epi16(units, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*> (dst + 16), _mm_unpackhi_epi16(units, zero));
+    }
+}
+
+// 1, 2 and 3 bytes sequences, Robert Clausecker, Daniel Lemire: https://arxiv.org/abs/2212.05098
+// each 16 bytes block is checked with the validation above, code points are computed
+// at the last byte of every sequence and compacted with the shuffle, block is
+// consumed up to the end of its last complete sequence; stops at the block with
+// 4 bytes sequences or invalid input, input must start at the sequence boundary,
+// returns the number of input bytes converted, `written` is set to the number
+// of output units, no more than the number of input bytes
+__attribute__((target("ssse3")))
+size_t utf8_to_16_32_ssse3(const unsigned char* src, size_t len, unsigned char* dst, size_t unit_size,
+        size_t& written) {
+    const compact_luts& cl = compact();
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i four_bytes_lead = _mm_set1_epi8(static_cast<char> (0xf0));
+    // continuations are below 0xc0 as signed bytes
+    const __m128i cont_max = _mm_set1_epi8(static_cast<char> (0xc0));
+    size_t i = 0;
+    size_t units = 0;
+    while (i + 16 <= len) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*> (src + i));
+        if (0 == _mm_movemask_epi8(in)) {
+            utf8_store_units_ssse3(_mm_unpacklo_epi8(in, zero), dst + units * unit_size, unit_size);
+            utf8_store_units_ssse3(_mm_unpackhi_epi8(in, zero), dst + (units + 8) * unit_size, unit_size);
+            i += 16;
+            units += 16;
+            continue;
+        }
+        if (0 != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(in, four_bytes_lead), in))) break;
+        __m128i err = utf8_errors_ssse3(in, zero);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(err, zero))) break;
+        // sequence ends where the next byte is not a continuation, last byte is left
+        // for the next block as its next byte is not loaded
+        __m128i next_cont = _mm_cmplt_epi8(_mm_srli_si128(in, 1), cont_max);
+        unsigned int ends = static_cast<unsigned int> (~_mm_movemask_epi8(next_cont)) & 0x7fff;
+        __m128i p1 = _mm_slli_si128(in, 1);
+        __m128i p2 = _mm_slli_si128(in, 2);
+        __m128i cp_lo = utf8_code_points_ssse3(_mm_unpacklo_epi8(in, zero),
+                _mm_unpacklo_epi8(p1, zero), _mm_unpacklo_epi8(p2, zero));
+        __m128i cp_hi = utf8_code_points_ssse3(_mm_unpackhi_epi8(in, zero),
+                _mm_unpackhi_epi8(p1, zero), _mm_unpackhi_epi8(p2, zero));
+        unsigned int ends_lo = ends & 0xff;
+        unsigned int ends_hi = ends >> 8;
+        __m128i units_lo = _mm_shuffle_epi8(cp_lo,
+                _mm_loadu_si128(reinterpret_cast<const __m128i*> (cl.shuffle[ends_lo])));
+        __m128i units_hi = _mm_shuffle_epi8(cp_hi,
+                _mm_loadu_si128(reinterpret_cast<const __m128i*> (cl.shuffle[ends_hi])));
+        utf8_store_units_ssse3(units_lo, dst + units * unit_size, unit_size);
+        units += cl.count[ends_lo];
+        utf8_store_units_ssse3(units_hi, dst + units * unit_size, unit_size);
+        units += cl.count[ends_hi];
+        // valid block without 4 bytes sequences has an end within its first 3 bytes
+        i += static_cast<size_t> (32 - __builtin_clz(ends));
+    }
+    written = units;
+    return i;
+}
+
+#endif // STATICLIB_UTILS_X86_SIMD
+
+size_t ascii_from_utf8_simd(const unsigned char* src, size_t len, unsigned char* dst, size_t unit_size) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return 2 == unit_size ? ascii_utf8_to_16_avx2(src, len, dst) : ascii_utf8_to_32_avx2(src, len, dst);
+    } else if (cpu_has_ssse3()) {
+        return 2 == unit_size ? ascii_utf8_to_16_ssse3(src, len, dst) : ascii_utf8_to_32_ssse3(src, len, dst);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) unit_size;
+    return 0;
+}
+
+// returns the number of input bytes converted, `written` is set to the number of output units
+size_t multibyte_from_utf8_simd(const unsigned char* src, size_t len, unsigned char* dst, size_t unit_size,
+        size_t& written) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_ssse3()) {
+        return utf8_to_16_32_ssse3(src, len, dst, unit_size, written);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) unit_size;
+    written = 0;
+    return 0;
+}
+
+size_t ascii_to_utf8_simd(const unsigned char* src, size_t len, unsigned char* dst, size_t unit_size) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return 2 == unit_size ? ascii_utf16_to_8_avx2(src, len, dst) : ascii_utf32_to_8_avx2(src, len, dst);
+    } else if (cpu_has_ssse3()) {
+        return 2 == unit_size ? ascii_utf16_to_8_ssse3(src, len, dst) : ascii_utf32_to_8_ssse3(src, len, dst);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    (void) dst;
+    (void) unit_size;
+    return 0;
+}
+
+size_t utf8_validate_simd(const unsigned char* src, size_t len) {
+#ifdef STATICLIB_UTILS_X86_SIMD
+    if (cpu_has_avx2()) {
+        return utf8_validate_avx2(src, len);
+    } else if (cpu_has_ssse3()) {
+        return utf8_validate_ssse3(src, len);
+    }
+#endif // STATICLIB_UTILS_X86_SIMD
+    (void) src;
+    (void) len;
+    return 0;
+}
+
+bool is_continuation(unsigned char ch) {
+    return 0x80 == (ch & 0xc0);
+}
+
+// returns length of the valid sequence at the start of the input or 0,
+// overlong forms, surrogates and values above U+10FFFF are rejected
+size_t decode_utf8_char(const unsigned char* src, size_t avail, uint32_t& cp) {
+    unsigned char c0 = src[0];
+    if (c0 < 0x80) {
+        cp = c0;
+        return 1;
+    }
+    if (c0 < 0xc2) {
+        return 0;
+    }
+    if (c0 < 0xe0) {
+        if (avail < 2 || !is_continuation(src[1])) return 0;
+        cp = (static_cast<uint32_t> (c0 & 0x1f) << 6) | (src[1] & 0x3f);
+        return 2;
+    }
+    if (c0 < 0xf0) {
+        unsigned char lower = 0xe0 == c0 ? 0xa0 : 0x80;
+        unsigned char upper = 0xed == c0 ? 0x9f : 0xbf;
+        if (avail < 3 || src[1] < lower || src[1] > upper || !is_continuation(src[2])) return 0;
+        cp = (static_cast<uint32_t> (c0 & 0x0f) << 12) | (static_cast<uint32_t> (src[1] & 0x3f) << 6) |
+                (src[2] & 0x3f);
+        return 3;
+    }
+    if (c0 < 0xf5) {
+        unsigned char lower = 0xf0 == c0 ? 0x90 : 0x80;
+        unsigned char upper = 0xf4 == c0 ? 0x8f : 0xbf;
+        if (avail < 4 || src[1] < lower || src[1] > upper ||
+                !is_continuation(src[2]) || !is_continuation(src[3])) return 0;
+        cp = (static_cast<uint32_t> (c0 & 0x07) << 18) | (static_cast<uint32_t> (src[1] & 0x3f) << 12) |
+                (static_cast<uint32_t> (src[2] & 0x3f) << 6) | (src[3] & 0x3f);
+        return 4;
+    }
+    return 0;
+}
+
+// code point must be valid
+unsigned char* encode_utf8_char(uint32_t cp, unsigned char* dst) {
+    if (cp < 0x80) {
+        *dst++ = static_cast<unsigned char> (cp);
+    } else if (cp < 0x800) {
+        *dst++ = static_cast<unsigned char> (0xc0 | (cp >> 6));
+        *dst++ = static_cast<unsigned char> (0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        *dst++ = static_cast<unsigned char> (0xe0 | (cp >> 12));
+        *dst++ = static_cast<unsigned char> (0x80 | ((cp >> 6) & 0x3f));
+        *dst++ = static_cast<unsigned char> (0x80 | (cp & 0x3f));
+    } else {
+        *dst++ = static_cast<unsigned char> (0xf0 | (cp >> 18));
+        *dst++ = static_cast<unsigned char> (0x80 | ((cp >> 12) & 0x3f));
+        *dst++ = static_cast<unsigned char> (0x80 | ((cp >> 6) & 0x3f));
+        *dst++ = static_cast<unsigned char> (0x80 | (cp & 0x3f));
+    }
+    return dst;
+}
+
+// start of the sequence that may contain the byte before the specified offset
+size_t sequence_start(const unsigned char* src, size_t pos) {
+    for (size_t back = 1; back <= 3 && back <= pos; back++) {
+        if (!is_continuation(src[pos - back])) {
+            return pos - back;
+        }
+    }
+    return pos;
+}
+
+// returns offset of the first invalid sequence or len
+size_t validate_utf8(const unsigned char* src, size_t len) {
+    // SIMD kernel stops at the block with error or at the tail
+    size_t i = sequence_start(src, utf8_validate_simd(src, len));
+    uint32_t cp = 0;
+    while (i < len) {
+        if (src[i] < 0x80) {
+            i += 1;
+            continue;
+        }
+        size_t seq_len = decode_utf8_char(src + i, len - i, cp);
+        if (0 == seq_len) {
+            return i;
+        }
+        i += seq_len;
+    }
+    return len;
+}
+
+// expected length of the sequence that starts with the specified byte, 0 if invalid
+size_t sequence_length(unsigned char lead) {
+    if (lead < 0x80) return 1;
+    if (lead < 0xc2) return 0;
+    if (lead < 0xe0) return 2;
+    if (lead < 0xf0) return 3;
+    if (lead < 0xf5) return 4;
+    return 0;
+}
+
+// number of trailing bytes that are a prefix of a multibyte sequence
+size_t incomplete_tail(const unsigned char* src, size_t len) {
+    for (size_t back = 1; back <= 3 && back <= len; back++) {
+        unsigned char ch = src[len - back];
+        if (!is_continuation(ch)) {
+            return sequence_length(ch) > back ? back : 0;
+        }
+    }
+    return 0;
+}
+
+// decodes UTF-8 into UTF-16 or UTF-32 (depending on CharT size),
+// returns offset of the first invalid sequence or len, dst is advanced
+// past written units, at most `len` units are written
+template<typename CharT>
+size_t decode_utf8(const unsigned char* src, size_t len, CharT*& dst) {
+    size_t i = 0;
+    while (i < len) {
+        size_t converted = ascii_from_utf8_simd(src + i, len - i, reinterpret_cast<unsigned char*> (dst), sizeof(CharT));
+        i += converted;
+        dst += converted;
+        size_t written = 0;
+        i += multibyte_from_utf8_simd(src + i, len - i, reinterpret_cast<unsigned char*> (dst), sizeof(CharT), written);
+        dst += written;
+        size_t run_end = len - i > scalar_run ? i + scalar_run : len;
+        while (i < run_end) {
+            if (src[i] < 0x80) {
+                *dst++ = static_cast<CharT> (src[i]);
+                i += 1;
+                continue;
+            }
+            uint32_t cp = 0;
+            size_t seq_len = decode_utf8_char(src + i, len - i, cp);
+            if (0 == seq_len) {
+                return i;
+            }
+            if (2 == sizeof(CharT) && cp >= 0x10000) {
+                cp -= 0x10000;
+                *dst++ = static_cast<CharT> (0xd800 | (cp >> 10));
+                *dst++ = static_cast<CharT> (0xdc00 | (cp & 0x3ff));
+            } else {
+                *dst++ = static_cast<CharT> (cp);
+            }
+            i += seq_len;
+        }
+    }
+    return len;
+}
+
+// encodes UTF-16 or UTF-32 (depending on CharT size) into UTF-8,
+// returns offset of the first invalid unit or len, dst is advanced
+// past written bytes, at most `3 * len` (UTF-16) or `4 * len` (UTF-32)
+// bytes are written
+template<typename CharT>
+size_t encode_utf8(const CharT* src, size_t len, unsigned char*& dst) {
+    size_t i = 0;
+    while (i < len) {
+        size_t converted = ascii_to_utf8_simd(reinterpret_cast<const unsigned char*> (src + i), len - i, dst, sizeof(CharT));
+        i += converted;
+        dst += converted;
+        size_t run_end = len - i > scalar_run ? i + scalar_run : len;
+        while (i < run_end) {
+            uint32_t cp = static_cast<uint32_t> (src[i]);
+            if (2 == sizeof(CharT)) {
+                cp &= 0xffff;
+            }
+            if (cp < 0x80) {
+                *dst++ = static_cast<unsigned char> (cp);
+                i += 1;
+                continue;
+            }
+            if (cp >= 0xd800 && cp <= 0xdfff) {
+                if (4 == sizeof(CharT) || cp > 0xdbff || i + 1 >= len) {
+                    return i;
+                }
+                uint32_t low = static_cast<uint32_t> (src[i + 1]) & 0xffff;
+                if (0xdc00 != (low & 0xfc00)) {
+                    return i;
+                }
+                cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                i += 1;
+            } else if (cp > 0x10ffff) {
+                return i;
+            }
+            dst = encode_utf8_char(cp, dst);
+            i += 1;
+        }
+    }
+    return len;
+}
+
+// transcodes the input through the stack buffer appending to `out`, returns offset
+// of the first invalid sequence or len, invalid sequences are replaced with U+FFFD
+// instead if `replace` is set
+template<typename CharT>
+size_t decode_chunked(const unsigned char* src, size_t len, std::basic_string<CharT>& out, bool replace) {
+    CharT buf[chunk_units];
+    size_t i = 0;
+    while (i < len) {
+        size_t chunk_end = len - i > chunk_units ? i + chunk_units : len;
+        CharT* dst = buf;
+        size_t pos = i + decode_utf8(src + i, chunk_end - i, dst);
+        out.append(buf, static_cast<size_t> (dst - buf));
+        if (pos < chunk_end) {
+            if (chunk_end < len && chunk_end - pos < 4) {
+                // sequence is split by the chunk boundary
+                i = pos;
+                continue;
+            }
+            if (!replace) {
+                return pos;
+            }
+            out.push_back(static_cast<CharT> (replacement_char));
+            pos += 1;
+        }
+        i = pos;
+    }
+    return len;
+}
+
+template<typename CharT>
+size_t encode_chunked(const CharT* src, size_t len, std::string& out, bool replace) {
+    unsigned char buf[chunk_units * 4];
+    size_t i = 0;
+    while (i < len) {
+        size_t chunk_end = len - i > chunk_units ? i + chunk_units : len;
+        unsigned char* dst = buf;
+        size_t pos = i + encode_utf8(src + i, chunk_end - i, dst);
+        out.append(reinterpret_cast<const char*> (buf), static_cast<size_t> (dst - buf));
+        if (pos < chunk_end) {
+            if (chunk_end < len && chunk_end - pos < 2) {
+                // surrogate pair is split by the chunk boundary
+                i = pos;
+                continue;
+            }
+            if (!replace) {
+                return pos;
+            }
+            dst = encode_utf8_char(replacement_char, buf);
+            out.append(reinterpret_cast<const char*> (buf), static_cast<size_t> (dst - buf));
+            pos += 1;
+        }
+        i = pos;
+    }
+    return len;
+}
+
+template<typename CharT>
+utf_result decode_append(const char* data, size_t length, std::basic_string<CharT>& out) {
+    size_t prev = out.size();
+    out.reserve(prev + length);
+    size_t pos = decode_chunked(reinterpret_cast<const unsigned char*> (data), length, out, false);
+    if (pos < length) {
+        out.resize(prev);
+        return utf_result{false, pos};
+    }
+    return utf_result{true, length};
+}
+
+template<typename CharT>
+utf_result encode_append(const CharT* data, size_t length, std::string& out) {
+    size_t prev = out.size();
+    out.reserve(prev + length);
+    size_t pos = encode_chunked(data, length, out, false);
+    if (pos < length) {
+        out.resize(prev);
+        return utf_result{false, pos};
+    }
+    return utf_result{true, length};
+}
+
+} // namespace
+
+utf_result utf8_validate(const char* data, size_t length) STATICLIB_NOEXCEPT {
+    size_t pos = validate_utf8(reinterpret_cast<const unsigned char*> (data), length);
+    return utf_result{pos == length, pos};
+}
+
+utf_result utf8_validate(const std::string& str) STATICLIB_NOEXCEPT {
+    return utf8_validate(str.data(), str.length());
+}
+
+utf8_validator::utf8_validator() STATICLIB_NOEXCEPT :
+pending(),
+pending_length(0),
+pending_needed(0),
+offset(0),
+error_offset(0),
+failed(false) { }
+
+bool utf8_validator::update(const char* data, size_t length) STATICLIB_NOEXCEPT {
+    if (failed) {
+        return false;
+    }
+    const unsigned char* src = reinterpret_cast<const unsigned char*> (data);
+    size_t i = 0;
+    if (pending_length > 0) {
+        // complete the sequence split on previous chunk boundary
+        size_t pending_offset = offset - pending_length;
+        while (pending_length < pending_needed && i < length) {
+            pending[pending_length++] = src[i++];
+        }
+        if (pending_length < pending_needed) {
+            offset += length;
+            return true;
+        }
+        uint32_t cp = 0;
+        if (0 == decode_utf8_char(pending, pending_length, cp)) {
+            failed = true;
+            error_offset = pending_offset;
+            return false;
+        }
+        pending_length = 0;
+        pending_needed = 0;
+    }
+    size_t tail = incomplete_tail(src + i, length - i);
+    size_t checked = length - tail;
+    size_t pos = validate_utf8(src + i, checked - i) + i;
+    if (pos < checked) {
+        failed = true;
+        error_offset = offset + pos;
+        return false;
+    }
+    for (size_t j = checked; j < length; j++) {
+        pending[pending_length++] = src[j];
+    }
+    if (tail > 0) {
+        pending_needed = sequence_length(pending[0]);
+    }
+    offset += length;
+    return true;
+}
+
+utf_result utf8_validator::finish() const STATICLIB_NOEXCEPT {
+    if (failed) {
+        return utf_result{false, error_offset};
+    }
+    if (pending_length > 0) {
+        return utf_result{false, offset - pending_length};
+    }
+    return utf_result{true, offset};
+}
+
+void utf8_validator::reset() STATICLIB_NOEXCEPT {
+    pending_length = 0;
+    pending_needed = 0;
+    offset = 0;
+    error_offset = 0;
+    failed = false;
+}
+
+utf_result utf8_to_utf16(const char* data, size_t length, std::u16string& out) {
+    return decode_append(data, length, out);
+}
+
+utf_result utf16_to_utf8(const char16_t* data, size_t length, std::string& out) {
+    return encode_append(data, length, out);
+}
+
+utf_result utf8_to_utf32(const char* data, size_t length, std::u32string& out) {
+    return decode_append(data, length, out);
+}
+
+utf_result utf32_to_utf8(const char32_t* data, size_t length, std::string& out) {
+    return encode_append(data, length, out);
+}
+
+std::wstring widen(const std::string& st) {
+    std::wstring res;
+    res.reserve(st.length());
+    decode_chunked(reinterpret_cast<const unsigned char*> (st.data()), st.length(), res, true);
+    return res;
+}
+
+std::string narrow(std::wstring wstr) {
+    return narrow(wstr.c_str(), wstr.length());
+}
+
+std::string narrow(const wchar_t* wbuf, size_t length) {
+    std::string res;
+    res.reserve(length);
+    encode_chunked(wbuf, length, res, true);
+    return res;
+}
+
+} // namespace
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utils_exception.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 10:15 AM
+ */
+
+#include "staticlib/utils/utils_exception.hpp"
+
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace staticlib {
+namespace utils {
+
+namespace { // anonymous
+
+const int not_formatted = 0;
+const int formatting = 1;
+const int formatted_ready = 2;
+
+const char* file_basename(const char* path) {
+    const char* res = path;
+    for (const char* ch = path; '\0' != *ch; ch++) {
+        if ('/' == *ch || '\\' == *ch) {
+            res = ch + 1;
+        }
+    }
+    return res;
+}
+
+void append_location(std::string& msg, const trace_location& location) {
+    if (nullptr == location.file) {
+        return;
+    }
+    msg.append("\n    at ");
+    msg.append(nullptr != location.func ? location.func : "");
+    msg.push_back('(');
+    msg.append(file_basename(location.file));
+    msg.push_back(':');
+    format_buffer line;
+    format_arg(line, location.line);
+    msg.append(line.c_str(), line.length());
+    msg.push_back(')');
+}
+
+std::string message_with_location(const format_buffer& message, const trace_location& location) {
+    std::string res;
+    // location suffix is usually shorter than that
+    res.reserve(message.length() + 128);
+    res.append(message.c_str(), message.length());
+    append_location(res, location);
+    return res;
+}
+
+} // namespace
+
+utils_exception::utils_exception() STATICLIB_NOEXCEPT :
+sl::support::exception(),
+location(),
+lazy_message(nullptr),
+argument_length(0),
+has_argument(false),
+argument_truncated(false),
+format_state(not_formatted) { }
+
+utils_exception::utils_exception(const std::string& msg) :
+sl::support::exception(msg),
+location(),
+lazy_message(nullptr),
+argument_length(0),
+has_argument(false),
+argument_truncated(false),
+format_state(not_formatted) { }
+
+utils_exception::utils_exception(trace_location location, const char* message,
+        const char* data, size_t length) STATICLIB_NOEXCEPT :
+sl::support::exception(),
+location(location),
+lazy_message(nullptr != message ? message : ""),
+argument_length(length < max_argument_length ? length : max_argument_length),
+has_argument(nullptr != data),
+argument_truncated(length > max_argument_length),
+format_state(not_formatted) {
+    if (has_argument) {
+        std::memcpy(argument, data, argument_length);
+    }
+}
+
+utils_exception::utils_exception(trace_location location, const format_buffer& message) :
+sl::support::exception(message_with_location(message, location)),
+location(),
+lazy_message(nullptr),
+argument_length(0),
+has_argument(false),
+argument_truncated(false),
+format_state(not_formatted) { }
+
+utils_exception::utils_exception(const utils_exception& other) :
+sl::support::exception(other),
+location(other.location),
+lazy_message(other.lazy_message),
+argument_length(other.argument_length),
+has_argument(other.has_argument),
+argument_truncated(other.argument_truncated),
+format_state(not_formatted) {
+    std::memcpy(argument, other.argument, argument_length);
+}
+
+utils_exception& utils_exception::operator=(const utils_exception& other) {
+    if (this != std::addressof(other)) {
+        sl::support::exception::operator=(other);
+        location = other.location;
+        lazy_message = other.lazy_message;
+        argument_length = other.argument_length;
+        has_argument = other.has_argument;
+        argument_truncated = other.argument_truncated;
+        std::memcpy(argument, other.argument, argument_length);
+        formatted.clear();
+        format_state.store(not_formatted, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+const char* utils_exception::what() const STATICLIB_NOEXCEPT {
+    if (nullptr == lazy_message) {
+        return sl::support::exception::what();
+    }
+    int state = format_state.load(std::memory_order_acquire);
+    if (formatted_ready == state) {
+        return formatted.c_str();
+    }
+    int expected = not_formatted;
+    if (format_state.compare_exchange_strong(expected, formatting, std::memory_order_acquire)) {
+        try {
+            std::string msg = lazy_message;
+            if (has_argument) {
+                msg.push_back('[');
+                msg.append(argument, argument_length);
+                if (argument_truncated) {
+                    msg.append("...");
+                }
+                msg.push_back(']');
+            }
+            append_location(msg, location);
+            formatted.swap(msg);
+        } catch (...) {
+            // out of memory, message without argument and location
+            format_state.store(not_formatted, std::memory_order_release);
+            return lazy_message;
+        }
+        format_state.store(formatted_ready, std::memory_order_release);
+        return formatted.c_str();
+    }
+    // concurrent call from other thread
+    while (formatted_ready != format_state.load(std::memory_order_acquire)) {
+        if (not_formatted == format_state.load(std::memory_order_acquire)) {
+            return lazy_message;
+        }
+        std::this_thread::yield();
+    }
+    return formatted.c_str();
+}
+
+} // namespace
+}
@@ -115,38 +115,6 @@ public:
 
 } // namespace
 
-std::wstring widen(const std::string& st) {
-    if (st.empty()) return std::wstring();
-    auto size_needed = MultiByteToWideChar(CP_UTF8, 0, st.c_str(), static_cast<int> (st.length()), nullptr, 0);
-    if (0 == size_needed) throw utils_exception(TRACEMSG("Error on string widen calculation," +
-            " string: [" + st + "], error: [" + errcode_to_string(GetLastError()) + "]"));
-    std::wstring res{};
-    res.resize(size_needed);
-    auto buf = std::addressof(res.front());
-    int chars_copied = MultiByteToWideChar(CP_UTF8, 0, st.c_str(), static_cast<int> (st.size()), buf, size_needed);
-    if (chars_copied != size_needed) throw utils_exception(TRACEMSG("Error on string widen execution," +
-            " string: [" + st + "], error: [" + errcode_to_string(GetLastError()) + "]"));
-    return res;
-}
-
-std::string narrow(std::wstring wstr) {
-    return narrow(wstr.c_str(), wstr.length());
-}
-
-std::string narrow(const wchar_t* wbuf, size_t length) {
-    if (0 == length) return std::string();
-    int size_needed = WideCharToMultiByte(CP_UTF8, 0, wbuf, static_cast<int> (length), nullptr, 0, nullptr, nullptr);
-    if (0 == size_needed) throw utils_exception(TRACEMSG("Error on string narrow calculation," +
-            " string length: [" + sl::support::to_string(length) + "], error code: [" + sl::support::to_string(GetLastError()) + "]"));
-    std::string res{};
-    res.resize(size_needed);
-    auto buf = std::addressof(res.front());
-    int bytes_copied = WideCharToMultiByte(CP_UTF8, 0, wbuf, static_cast<int> (length), buf, size_needed, nullptr, nullptr);
-    if (bytes_copied != size_needed) throw utils_exception(TRACEMSG("Error on string narrow execution," +
-            " string length: [" + sl::support::to_string(length) + "], error code: [" + sl::support::to_string(GetLastError()) + "]"));
-    return res;
-}
-
 std::string errcode_to_string(uint32_t code) STATICLIB_NOEXCEPT {
     if (0 == code) return std::string {};
     wchar_t* buf_p = nullptr;
@@ -173,29 +141,29 @@ std::string errcode_to_string(uint32_t code) STATICLIB_NOEXCEPT {
 bool current_process_elevated() {
     HANDLE hatoken = nullptr;
     auto err_open = ::OpenProcessToken(::GetCurrentProcess(), TOKEN_QUERY, std::addressof(hatoken));    
-    if (0 == err_open) throw utils_exception(TRACEMSG("'OpenProcessToken'" +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+    if (0 == err_open) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'OpenProcessToken' error: [{}]", errcode_to_string(::GetLastError())));
     auto token = std::unique_ptr<void, handle_deleter>(hatoken, handle_deleter());
     TOKEN_ELEVATION elev;
     DWORD len = sizeof(TOKEN_ELEVATION);
     auto err_info = ::GetTokenInformation(token.get(), TokenElevation, std::addressof(elev),
             sizeof(elev), std::addressof(len));
-    if (0 == err_info) throw utils_exception(TRACEMSG("'GetTokenInformation'" +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+    if (0 == err_info) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'GetTokenInformation' error: [{}]", errcode_to_string(::GetLastError())));
     return 0 != elev.TokenIsElevated;
 }
 
 std::string current_process_username() {
     DWORD session_id = 0;
     auto err_sid = ::ProcessIdToSessionId(::GetCurrentProcessId(), std::addressof(session_id));
-    if (0 == err_sid) throw utils_exception(TRACEMSG("'ProcessIdToSessionId'" +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+    if (0 == err_sid) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'ProcessIdToSessionId' error: [{}]", errcode_to_string(::GetLastError())));
     DWORD len = 0;
     wchar_t* out_ptr = nullptr;
     auto err_wts = ::WTSQuerySessionInformationW(WTS_CURRENT_SERVER_HANDLE, session_id, WTSUserName,
             std::addressof(out_ptr), std::addressof(len));
-    if (0 == err_wts) throw utils_exception(TRACEMSG("'WTSQuerySessionInformationW'" +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+    if (0 == err_wts) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'WTSQuerySessionInformationW' error: [{}]", errcode_to_string(::GetLastError())));
     auto out = std::unique_ptr<wchar_t, wts_buffer_deleter>(out_ptr, wts_buffer_deleter());
     return narrow(out.get(), len/sizeof(wchar_t) - 1);
 }
@@ -210,8 +178,8 @@ void ensure_has_logon_as_service(const std::string& username) {
     auto err_look_check = ::LookupAccountNameW(nullptr, uname.data(), nullptr, std::addressof(sidlen),
             nullptr, std::addressof(domlen), std::addressof(siduse));
     if (0 == err_look_check && ERROR_INSUFFICIENT_BUFFER != GetLastError()) {
-        throw utils_exception(TRACEMSG("'LookupAccountNameW' check," +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+        throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+                "'LookupAccountNameW' check, error: [{}]", errcode_to_string(::GetLastError())));
     }
    
     // lookup
@@ -222,8 +190,8 @@ void ensure_has_logon_as_service(const std::string& username) {
     domname.resize(domlen);
     auto err_look = ::LookupAccountNameW(nullptr, uname.data(), sid, std::addressof(sidlen),
             std::addressof(domname.front()), std::addressof(domlen), std::addressof(siduse));
-    if (0 == err_look) throw utils_exception(TRACEMSG("'LookupAccountNameW'," +
-            " error: [" + errcode_to_string(::GetLastError()) + "]"));
+    if (0 == err_look) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'LookupAccountNameW', error: [{}]", errcode_to_string(::GetLastError())));
    
     // open policy
     LSA_UNICODE_STRING domname_u;    
@@ -235,8 +203,8 @@ void ensure_has_logon_as_service(const std::string& username) {
     LSA_HANDLE lh_ptr;
     auto err_open = LsaOpenPolicy(std::addressof(domname_u), std::addressof(attrs), 
             POLICY_ALL_ACCESS, std::addressof(lh_ptr));
-    if (0 != err_open) throw utils_exception(TRACEMSG("'LsaOpenPolicy'" +
-            " error: [" + errcode_to_string(::LsaNtStatusToWinError(err_open)) + "]"));
+    if (0 != err_open) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'LsaOpenPolicy' error: [{}]", errcode_to_string(::LsaNtStatusToWinError(err_open))));
     auto lh = std::unique_ptr<void, lsa_handle_deleter>(lh_ptr, lsa_handle_deleter());
 
     // add right
@@ -246,40 +214,10 @@ void ensure_has_logon_as_service(const std::string& username) {
     right_u.Length = static_cast<USHORT>(right.length() * sizeof(wchar_t));
     right_u.MaximumLength = static_cast<USHORT>((right.length() + 1) * sizeof(wchar_t));
     auto err_add = ::LsaAddAccountRights(lh.get(), sid, std::addressof(right_u), 1);
-    if (0 != err_add) throw utils_exception(TRACEMSG("'LsaAddAccountRights'" +
-            " error: [" + errcode_to_string(::LsaNtStatusToWinError(err_add)) + "]"));
-}
-
-// named_mutex impl
-
-named_mutex::named_mutex(const std::string& name) :
-mutex(::CreateMutexW(nullptr, FALSE, widen(name).c_str())),
-error(::GetLastError()) { }
-
-named_mutex::named_mutex(named_mutex&& other) :
-mutex(other.mutex),
-error(other.error) {
-    other.mutex = nullptr;
-}
-
-named_mutex& named_mutex::operator=(named_mutex&& other) {
-    mutex = other.mutex;
-    other.mutex = nullptr;
-    error = other.error;
-    return *this;
+    if (0 != err_add) throw utils_exception(STATICLIB_UTILS_TRACE_LOCATION, STATICLIB_UTILS_FORMAT(
+            "'LsaAddAccountRights' error: [{}]", errcode_to_string(::LsaNtStatusToWinError(err_add))));
 }
 
-named_mutex::~named_mutex() STATICLIB_NOEXCEPT {
-    if (nullptr != mutex) {
-        ::CloseHandle(mutex);
-    }
-}
-
-bool named_mutex::already_taken() const {
-    return (ERROR_ALREADY_EXISTS == error);
-}
-
-
 } // namespace
 }
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   arena_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:05 AM
+ */
+
+#include "staticlib/utils/arena.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+void test_allocate() {
+    sl::utils::arena ar{64};
+    slassert(0 == ar.chunks_count());
+    void* p1 = ar.allocate(10);
+    slassert(nullptr != p1);
+    slassert(1 == ar.chunks_count());
+    slassert(0 == reinterpret_cast<uintptr_t> (p1) % sl::utils::arena::default_alignment);
+    void* p2 = ar.allocate(3, 1);
+    slassert(static_cast<char*> (p2) >= static_cast<char*> (p1) + 10);
+    std::memset(p1, 'a', 10);
+    std::memset(p2, 'b', 3);
+    slassert('a' == static_cast<char*> (p1)[9]);
+    slassert(13 == ar.bytes_used());
+}
+
+void test_growth() {
+    sl::utils::arena ar{16};
+    for (size_t i = 0; i < 100; i++) {
+        char* ptr = static_cast<char*> (ar.allocate(8, 8));
+        std::memset(ptr, 'x', 8);
+    }
+    slassert(ar.chunks_count() > 1);
+    slassert(800 == ar.bytes_used());
+    // oversized allocation
+    char* big = static_cast<char*> (ar.allocate(2 * sl::utils::arena::max_chunk_size));
+    std::memset(big, 'y', 2 * sl::utils::arena::max_chunk_size);
+}
+
+void test_reset() {
+    sl::utils::arena ar{32};
+    for (size_t i = 0; i < 10; i++) {
+        ar.allocate(30);
+    }
+    slassert(ar.chunks_count() > 1);
+    ar.reset();
+    slassert(1 == ar.chunks_count());
+    slassert(0 == ar.bytes_used());
+    ar.allocate(30);
+    slassert(1 == ar.chunks_count());
+}
+
+void test_move() {
+    sl::utils::arena ar1{32};
+    ar1.allocate(10);
+    sl::utils::arena ar2 = std::move(ar1);
+    slassert(0 == ar1.chunks_count());
+    slassert(1 == ar2.chunks_count());
+    slassert(10 == ar2.bytes_used());
+    ar1 = std::move(ar2);
+    slassert(1 == ar1.chunks_count());
+    slassert(0 == ar2.chunks_count());
+}
+
+void test_allocator() {
+    sl::utils::arena ar{};
+    std::vector<int, sl::utils::arena_allocator<int>> vec{sl::utils::arena_allocator<int>(ar)};
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    slassert(1000 == vec.size());
+    slassert(999 == vec.back());
+    sl::utils::arena_string st{"foo bar baz, long enough to not fit SSO", sl::utils::arena_allocator<char>(ar)};
+    st += " and some more";
+    slassert(0 == std::strcmp(st.c_str(), "foo bar baz, long enough to not fit SSO and some more"));
+    slassert(vec.get_allocator() == st.get_allocator());
+}
+
+int main() {
+    try {
+        test_allocate();
+        test_growth();
+        test_reset();
+        test_move();
+        test_allocator();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   codec_utils_test.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 11:20 AM
+ */
+
+#include "staticlib/utils/codec_utils.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+std::string random_bytes(std::mt19937& engine, size_t len) {
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::string res;
+    for (size_t i = 0; i < len; i++) {
+        res.push_back(static_cast<char> (dist(engine)));
+    }
+    return res;
+}
+
+// straightforward reference implementation
+std::string reference_base64(const std::string& data, bool url, bool padded) {
+    const std::string alphabet = std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789") +
+            (url ? "-_" : "+/");
+    std::string res;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (char ch : data) {
+        acc = (acc << 8) | static_cast<unsigned char> (ch);
+        bits += 8;
+        while (bits >= 6) {
+            bits -= 6;
+            res.push_back(alphabet[(acc >> bits) & 0x3f]);
+        }
+    }
+    if (bits > 0) {
+        res.push_back(alphabet[(acc << (6 - bits)) & 0x3f]);
+    }
+    while (padded && 0 != res.length() % 4) {
+        res.push_back('=');
+    }
+    return res;
+}
+
+bool throws_on_decode(const std::string& str, sl::utils::base64_variant variant, sl::utils::decode_mode mode) {
+    try {
+        sl::utils::base64_decode(str, variant, mode);
+        return false;
+    } catch (const sl::utils::utils_exception&) {
+        return true;
+    }
+}
+
+bool throws_on_hex_decode(const std::string& str, sl::utils::decode_mode mode) {
+    try {
+        sl::utils::hex_decode(str, mode);
+        return false;
+    } catch (const sl::utils::utils_exception&) {
+        return true;
+    }
+}
+
+} // namespace
+
+void test_hex() {
+    slassert("" == sl::utils::hex_encode(""));
+    slassert("666f6f" == sl::utils::hex_encode("foo"));
+    slassert("00FF7F" == sl::utils::hex_encode(std::string("\x00\xff\x7f", 3), true));
+    slassert("foo" == sl::utils::hex_decode("666f6f"));
+    slassert("foo" == sl::utils::hex_decode("666F6F"));
+    std::string out = "prefix";
+    sl::utils::hex_encode("ab", 2, out);
+    slassert("prefix6162" == out);
+    sl::utils::hex_decode("6364", 4, out);
+    slassert("prefix6162cd" == out);
+}
+
+void test_hex_random() {
+    std::mt19937 engine{42};
+    for (size_t len = 0; len < 200; len++) {
+        std::string data = random_bytes(engine, len);
+        std::string enc = sl::utils::hex_encode(data);
+        slassert(len * 2 == enc.length());
+        slassert(data == sl::utils::hex_decode(enc));
+        std::string upper = sl::utils::hex_encode(data, true);
+        slassert(data == sl::utils::hex_decode(upper));
+        // invalid character at every position
+        if (len > 0) {
+            for (size_t pos = 0; pos < enc.length(); pos += 7) {
+                std::string bad = enc;
+                bad[pos] = 'g';
+                slassert(throws_on_hex_decode(bad, sl::utils::decode_mode::strict));
+                bad[pos] = '\xc0';
+                slassert(throws_on_hex_decode(bad, sl::utils::decode_mode::lenient));
+            }
+        }
+    }
+}
+
+void test_hex_modes() {
+    slassert(throws_on_hex_decode("abc", sl::utils::decode_mode::strict));
+    slassert(throws_on_hex_decode("abc", sl::utils::decode_mode::lenient));
+    slassert(throws_on_hex_decode("66 6f", sl::utils::decode_mode::strict));
+    slassert("fo" == sl::utils::hex_decode(" 66\n6f\t", sl::utils::decode_mode::lenient));
+    // output is not modified on error
+    std::string long_input = sl::utils::hex_encode(std::string(64, 'a'));
+    std::vector<std::string> invalid = {"66g6", "666", long_input + "g0", long_input + "6"};
+    for (auto& in : invalid) {
+        std::string out = "pref";
+        bool catched = false;
+        try {
+            sl::utils::hex_decode(in.data(), in.length(), out, sl::utils::decode_mode::strict);
+        } catch (const sl::utils::utils_exception&) {
+            catched = true;
+        }
+        slassert(catched);
+        slassert("pref" == out);
+    }
+}
+
+// RFC 4648 section 10
+void test_base64_vectors() {
+    slassert("" == sl::utils::base64_encode(""));
+    slassert("Zg==" == sl::utils::base64_encode("f"));
+    slassert("Zm8=" == sl::utils::base64_encode("fo"));
+    slassert("Zm9v" == sl::utils::base64_encode("foo"));
+    slassert("Zm9vYg==" == sl::utils::base64_encode("foob"));
+    slassert("Zm9vYmE=" == sl::utils::base64_encode("fooba"));
+    slassert("Zm9vYmFy" == sl::utils::base64_encode("foobar"));
+    slassert("fooba" == sl::utils::base64_decode("Zm9vYmE="));
+    slassert("Zm9vYmE" == sl::utils::base64_encode("fooba", sl::utils::base64_variant::url_unpadded));
+    slassert("fooba" == sl::utils::base64_decode("Zm9vYmE", sl::utils::base64_variant::url_unpadded));
+    std::string bin{"\xfb\xff\xfe", 3};
+    slassert("+//+" == sl::utils::base64_encode(bin));
+    slassert("-__-" == sl::utils::base64_encode(bin, sl::utils::base64_variant::url));
+    slassert(bin == sl::utils::base64_decode("-__-", sl::utils::base64_variant::url));
+}
+
+void test_base64_random() {
+    std::mt19937 engine{42};
+    for (size_t len = 0; len < 300; len++) {
+        std::string data = random_bytes(engine, len);
+        for (int v = 0; v < 3; v++) {
+            auto variant = static_cast<sl::utils::base64_variant> (v);
+            bool url = sl::utils::base64_variant::standard != variant;
+            bool padded = sl::utils::base64_variant::url_unpadded != variant;
+            std::string enc = sl::utils::base64_encode(data, variant);
+            slassert(reference_base64(data, url, padded) == enc);
+            slassert(data == sl::utils::base64_decode(enc, variant));
+            slassert(data == sl::utils::base64_decode(enc, variant, sl::utils::decode_mode::lenient));
+            // invalid character at different positions
+            for (size_t pos = 0; pos < enc.length(); pos += 5) {
+                std::string bad = enc;
+                bad[pos] = '*';
+                slassert(throws_on_decode(bad, variant, sl::utils::decode_mode::strict));
+                slassert(throws_on_decode(bad, variant, sl::utils::decode_mode::lenient));
+            }
+        }
+    }
+}
+
+void test_base64_all_bytes() {
+    // every byte value inside a SIMD-sized block is either decoded or rejected consistently
+    std::string block = sl::utils::base64_encode(std::string(48, 'x'));
+    for (int ch = 0; ch < 256; ch++) {
+        for (size_t pos = 0; pos < block.length(); pos += 13) {
+            std::string in = block;
+            in[pos] = static_cast<char> (ch);
+            bool valid_std = (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+                    (ch >= '0' && ch <= '9') || '+' == ch || '/' == ch;
+            bool valid_url = (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+                    (ch >= '0' && ch <= '9') || '-' == ch || '_' == ch;
+            slassert(valid_std != throws_on_decode(in, sl::utils::base64_variant::standard,
+                    sl::utils::decode_mode::strict));
+            slassert(valid_url != throws_on_decode(in, sl::utils::base64_variant::url,
+                    sl::utils::decode_mode::strict));
+        }
+    }
+}
+
+void test_base64_modes() {
+    using sl::utils::base64_variant;
+    using sl::utils::decode_mode;
+    // padding
+    slassert(throws_on_decode("Zg", base64_variant::standard, decode_mode::strict));
+    slassert("f" == sl::utils::base64_decode("Zg", base64_variant::standard, decode_mode::lenient));
+    slassert(throws_on_decode("Zg==", base64_variant::url_unpadded, decode_mode::strict));
+    slassert(throws_on_decode("Zg=", base64_variant::standard, decode_mode::lenient));
+    slassert(throws_on_decode("Zg==Zg==", base64_variant::standard, decode_mode::lenient));
+    slassert(throws_on_decode("Z", base64_variant::standard, decode_mode::lenient));
+    slassert(throws_on_decode("Zm9v=", base64_variant::standard, decode_mode::lenient));
+    // non-canonical trailing bits
+    slassert(throws_on_decode("Zh==", base64_variant::standard, decode_mode::strict));
+    slassert("f" == sl::utils::base64_decode("Zh==", base64_variant::standard, decode_mode::lenient));
+    // whitespace and mixed alphabets
+    slassert(throws_on_decode("Zm9v\nYmFy", base64_variant::standard, decode_mode::strict));
+    slassert("foobar" == sl::utils::base64_decode("Zm9v\r\nYmFy ", base64_variant::standard, decode_mode::lenient));
+    slassert(throws_on_decode("+/-_", base64_variant::standard, decode_mode::strict));
+    slassert(std::string("\xfb\xff\xbf\xfb\xff\xbf", 6) == sl::utils::base64_decode("+/-_-/+_",
+            base64_variant::standard, decode_mode::lenient));
+    // output is not modified on error
+    std::string out = "prefix";
+    try {
+        sl::utils::base64_decode("Zm9v*", 5, out);
+    } catch (const sl::utils::utils_exception&) {
+        // expected
+    }
+    slassert("prefix" == out);
+}
+
+int main() {
+    try {
+        test_hex();
+        test_hex_random();
+        test_hex_modes();
+        test_base64_vectors();
+        test_base64_random();
+        test_base64_all_bytes();
+        test_base64_modes();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   format_test.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 11:20 AM
+ */
+
+#include "staticlib/utils/format.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/utils/utils_exception.hpp"
+
+void test_placeholders() {
+    auto noargs = STATICLIB_UTILS_FORMAT("foo");
+    slassert("foo" == noargs.str());
+    slassert(noargs.is_inline());
+    auto buf = STATICLIB_UTILS_FORMAT("{}:[{}], {}", "foo", std::string("bar"), 'c');
+    slassert("foo:[bar], c" == buf.str());
+    slassert(std::strlen(buf.c_str()) == buf.length());
+    // single braces are written as is
+    slassert("{ } {bar}" == STATICLIB_UTILS_FORMAT("{ } {{}}", "bar").str());
+    slassert("" == STATICLIB_UTILS_FORMAT("{}", "").str());
+}
+
+void test_ints() {
+    slassert("0" == STATICLIB_UTILS_FORMAT("{}", 0).str());
+    slassert("-42" == STATICLIB_UTILS_FORMAT("{}", static_cast<int16_t> (-42)).str());
+    slassert("4294967295" == STATICLIB_UTILS_FORMAT("{}", UINT32_MAX).str());
+    slassert("-9223372036854775808" == STATICLIB_UTILS_FORMAT("{}", LLONG_MIN).str());
+    slassert("18446744073709551615" == STATICLIB_UTILS_FORMAT("{}", ULLONG_MAX).str());
+    size_t sz = 42;
+    slassert("[42]" == STATICLIB_UTILS_FORMAT("[{}]", sz).str());
+}
+
+void test_other_types() {
+    slassert("true false" == STATICLIB_UTILS_FORMAT("{} {}", true, false).str());
+    slassert("1.5" == STATICLIB_UTILS_FORMAT("{}", 1.5).str());
+    const char* nptr = nullptr;
+    slassert("null" == STATICLIB_UTILS_FORMAT("{}", nptr).str());
+}
+
+void test_errno_text() {
+    auto buf = STATICLIB_UTILS_FORMAT("error: [{}]", sl::utils::errno_text(ENOENT));
+    slassert("error: [" + std::string(::strerror(ENOENT)) + "]" == buf.str());
+}
+
+void test_heap_spill() {
+    std::string long_str(sl::utils::format_buffer::inline_capacity * 3, 'a');
+    auto buf = STATICLIB_UTILS_FORMAT("[{}]:{}", long_str, 42);
+    slassert(!buf.is_inline());
+    slassert("[" + long_str + "]:42" == buf.str());
+    // copies and moves keep contents
+    sl::utils::format_buffer copied = buf;
+    slassert(buf.str() == copied.str());
+    sl::utils::format_buffer moved = std::move(copied);
+    slassert(buf.str() == moved.str());
+    auto small = STATICLIB_UTILS_FORMAT("{}", 42);
+    sl::utils::format_buffer small_moved = std::move(small);
+    slassert(small_moved.is_inline());
+    slassert("42" == small_moved.str());
+    moved = small_moved;
+    slassert("42" == moved.str());
+}
+
+void test_exception() {
+    sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION,
+            STATICLIB_UTILS_FORMAT("foo: [{}], bar: [{}]", "baz", 42));
+    std::string msg = e.what();
+    slassert(0 == msg.find("foo: [baz], bar: [42]\n    at test_exception(format_test.cpp:"));
+}
+
+int main() {
+    try {
+        test_placeholders();
+        test_ints();
+        test_other_types();
+        test_errno_text();
+        test_heap_spill();
+        test_exception();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   hash_utils_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:02 PM
+ */
+
+#include "staticlib/utils/hash_utils.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/utils/string_utils.hpp"
+
+namespace { // anonymous
+
+int popcount64(uint64_t val) {
+    int res = 0;
+    while (0 != val) {
+        val &= val - 1;
+        res += 1;
+    }
+    return res;
+}
+
+std::string random_bytes(std::mt19937& engine, size_t len) {
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::string res;
+    res.resize(len);
+    for (size_t i = 0; i < len; i++) {
+        res[i] = static_cast<char> (dist(engine));
+    }
+    return res;
+}
+
+} // namespace
+
+void test_basic() {
+    std::string foo{"foo"};
+    slassert(sl::utils::hash64(foo) == sl::utils::hash64(foo.data(), foo.length(), 0));
+    slassert(sl::utils::hash64("foo") != sl::utils::hash64("bar"));
+    // literal with the seed selects the string overload
+    slassert(sl::utils::hash64("foo", 42) == sl::utils::hash64(foo.data(), foo.length(), 42));
+    slassert(sl::utils::hash64(foo, 42) == sl::utils::hash64(foo, 42));
+    slassert(sl::utils::hash64(foo) != sl::utils::hash64(foo, 42));
+    slassert(sl::utils::hash64(foo, 42) != sl::utils::hash64(foo, 43));
+    slassert(sl::utils::ihash64("Foo", 42) == sl::utils::hash64(foo, 42));
+    slassert(sl::utils::ihash64("Foo", 42) != sl::utils::ihash64("Foo", 43));
+    slassert(sl::utils::hash64("", 0, 0) != sl::utils::hash64("", 0, 1));
+    slassert(sl::utils::hash64(std::string("\0", 1)) != sl::utils::hash64(std::string("\0\0", 2)));
+}
+
+void test_unaligned() {
+    std::string src = std::string(8, 'x') + "some key that is long enough to span several blocks of data, 1234567890";
+    for (size_t off = 0; off < 8; off++) {
+        std::string shifted = std::string(off, ' ') + src;
+        slassert(sl::utils::hash64(src) == sl::utils::hash64(shifted.data() + off, src.length(), 0));
+    }
+}
+
+void test_stream() {
+    std::mt19937 engine{42};
+    for (size_t len = 0; len < 300; len++) {
+        std::string data = random_bytes(engine, len);
+        uint64_t expected = sl::utils::hash64(data, 7);
+        for (size_t split = 0; split <= len; split += (len > 64 ? 13 : 1)) {
+            sl::utils::hash64_stream st{7};
+            st.update(data.data(), split);
+            slassert(st.digest() == sl::utils::hash64(data.data(), split, 7));
+            st.update(data.data() + split, len - split);
+            slassert(expected == st.digest());
+        }
+        // byte by byte
+        sl::utils::hash64_stream st{7};
+        for (size_t i = 0; i < len; i++) {
+            st.update(data.data() + i, 1);
+        }
+        slassert(expected == st.digest());
+        st.reset(7);
+        st.update(data);
+        slassert(expected == st.digest());
+    }
+}
+
+void test_case_insensitive() {
+    slassert(sl::utils::ihash64("Content-Type") == sl::utils::ihash64("content-type"));
+    slassert(sl::utils::ihash64("Content-Type") == sl::utils::hash64("content-type"));
+    slassert(sl::utils::ihash64("Content-Type") != sl::utils::ihash64("Content-Length"));
+    std::string upper(1000, 'A');
+    std::string lower(1000, 'a');
+    slassert(sl::utils::iequals(upper, lower));
+    slassert(sl::utils::ihash64(upper) == sl::utils::ihash64(lower));
+    slassert(sl::utils::ihash64(upper) == sl::utils::hash64(lower));
+    slassert(sl::utils::ihash64("@[`{") != sl::utils::ihash64("`{@["));
+}
+
+// SMHasher-style avalanche: flipping any input bit should flip each output bit with ~0.5 probability
+void test_avalanche() {
+    std::mt19937 engine{1};
+    const size_t lens[] = {4, 16, 33, 100};
+    const size_t trials = 200;
+    for (size_t len : lens) {
+        std::vector<uint32_t> flips(len * 8 * 64, 0);
+        for (size_t t = 0; t < trials; t++) {
+            std::string key = random_bytes(engine, len);
+            uint64_t base = sl::utils::hash64(key);
+            for (size_t bit = 0; bit < len * 8; bit++) {
+                key[bit / 8] = static_cast<char> (key[bit / 8] ^ (1 << (bit % 8)));
+                uint64_t diff = base ^ sl::utils::hash64(key);
+                key[bit / 8] = static_cast<char> (key[bit / 8] ^ (1 << (bit % 8)));
+                for (size_t out = 0; out < 64; out++) {
+                    flips[bit * 64 + out] += static_cast<uint32_t> ((diff >> out) & 1);
+                }
+            }
+        }
+        for (uint32_t fl : flips) {
+            double ratio = static_cast<double> (fl) / trials;
+            slassert(ratio > 0.3 && ratio < 0.7);
+        }
+    }
+}
+
+// SMHasher-style differential/sparse keys: no collisions expected in 64 bits
+void test_collisions() {
+    std::unordered_set<uint64_t> seen;
+    // sequential integers as text
+    for (size_t i = 0; i < 100000; i++) {
+        slassert(seen.insert(sl::utils::hash64(std::to_string(i))).second);
+    }
+    // sparse keys: 2 bits set in 32-byte zero key
+    seen.clear();
+    std::string key(32, '\0');
+    for (size_t b1 = 0; b1 < 256; b1++) {
+        for (size_t b2 = b1 + 1; b2 < 256; b2++) {
+            key[b1 / 8] = static_cast<char> (key[b1 / 8] ^ (1 << (b1 % 8)));
+            key[b2 / 8] = static_cast<char> (key[b2 / 8] ^ (1 << (b2 % 8)));
+            slassert(seen.insert(sl::utils::hash64(key)).second);
+            key[b1 / 8] = static_cast<char> (key[b1 / 8] ^ (1 << (b1 % 8)));
+            key[b2 / 8] = static_cast<char> (key[b2 / 8] ^ (1 << (b2 % 8)));
+        }
+    }
+    // zero-filled keys of different lengths
+    seen.clear();
+    for (size_t len = 0; len < 1000; len++) {
+        slassert(seen.insert(sl::utils::hash64(std::string(len, '\0'))).second);
+    }
+}
+
+// low bits distribution is used directly by hash tables
+void test_bucket_distribution() {
+    const size_t buckets = 256;
+    const size_t keys = buckets * 100;
+    std::vector<size_t> counts(buckets, 0);
+    for (size_t i = 0; i < keys; i++) {
+        counts[sl::utils::hash64("key_" + std::to_string(i)) % buckets] += 1;
+    }
+    for (size_t cn : counts) {
+        slassert(cn > 50 && cn < 150);
+    }
+    int bits = popcount64(sl::utils::hash64("foo"));
+    slassert(bits > 10 && bits < 54);
+}
+
+int main() {
+    try {
+        test_basic();
+        test_unaligned();
+        test_stream();
+        test_case_insensitive();
+        test_avalanche();
+        test_collisions();
+        test_bucket_distribution();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
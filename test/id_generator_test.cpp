@@ -0,0 +1,195 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   id_generator_test.cpp
+ * Author: alex
+ *
+ * Created on October 27, 2026, 2:40 PM
+ */
+
+#include "staticlib/utils/id_generator.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/config/assert.hpp"
+
+#ifdef STATICLIB_LINUX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // STATICLIB_LINUX
+
+namespace { // anonymous
+
+bool has_rfc_variant(const sl::utils::uuid& id) {
+    return 0x80 == (id.bytes[8] & 0xc0);
+}
+
+uint64_t timestamp_millis(const sl::utils::uuid& id) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < 6; i++) {
+        res = (res << 8) | id.bytes[i];
+    }
+    return res;
+}
+
+} // namespace
+
+void test_format() {
+    auto id = sl::utils::uuid::from_halves(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+    slassert("01234567-89ab-cdef-fedc-ba9876543210" == id.to_string());
+    char buf[sl::utils::uuid::string_length + 1];
+    buf[sl::utils::uuid::string_length] = '!';
+    id.format(buf);
+    slassert('!' == buf[sl::utils::uuid::string_length]);
+    slassert("01234567-89ab-cdef-fedc-ba9876543210" == std::string(buf, sl::utils::uuid::string_length));
+    slassert(0xc == id.version());
+    auto other = sl::utils::uuid::from_halves(0x0123456789abcdefULL, 0xfedcba9876543211ULL);
+    slassert(id != other);
+    slassert(id < other);
+    slassert(id == sl::utils::uuid::from_halves(0x0123456789abcdefULL, 0xfedcba9876543210ULL));
+}
+
+void test_v4() {
+    sl::utils::id_generator gen;
+    std::set<std::string> ids;
+    for (size_t i = 0; i < 10000; i++) {
+        auto id = gen.generate_v4();
+        slassert(4 == id.version());
+        slassert(has_rfc_variant(id));
+        ids.insert(id.to_string());
+    }
+    slassert(10000 == ids.size());
+    sl::utils::id_generator seeded1{42};
+    sl::utils::id_generator seeded2{42};
+    slassert(seeded1.generate_v4() == seeded2.generate_v4());
+}
+
+void test_v7() {
+    sl::utils::id_generator gen;
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    uint64_t millis = static_cast<uint64_t> (std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+    auto prev = gen.generate_v7();
+    slassert(7 == prev.version());
+    slassert(has_rfc_variant(prev));
+    slassert(timestamp_millis(prev) >= millis && timestamp_millis(prev) < millis + 10000);
+    for (size_t i = 0; i < 100000; i++) {
+        auto id = gen.generate_v7();
+        slassert(7 == id.version());
+        slassert(has_rfc_variant(id));
+        slassert(prev < id);
+        prev = id;
+    }
+}
+
+void test_sequential() {
+    sl::utils::id_generator gen;
+    auto prev = gen.generate_sequential();
+    slassert(8 == prev.version());
+    slassert(has_rfc_variant(prev));
+    for (size_t i = 0; i < 1000; i++) {
+        auto id = gen.generate_sequential();
+        slassert(8 == id.version());
+        slassert(has_rfc_variant(id));
+        slassert(id != prev);
+        slassert(0 == std::memcmp(id.bytes, prev.bytes, 8));
+        prev = id;
+    }
+    sl::utils::id_generator other;
+    slassert(0 != std::memcmp(other.generate_sequential().bytes, prev.bytes, 8));
+}
+
+void test_threads() {
+    std::mutex mtx;
+    std::set<std::string> ids;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([&mtx, &ids] {
+            std::vector<std::string> local;
+            auto prev = sl::utils::generate_uuid_v7();
+            local.push_back(prev.to_string());
+            for (size_t j = 0; j < 1000; j++) {
+                auto id = sl::utils::generate_uuid_v7();
+                slassert(prev < id);
+                prev = id;
+                local.push_back(id.to_string());
+                local.push_back(sl::utils::generate_uuid_v4().to_string());
+                local.push_back(sl::utils::generate_uuid_sequential().to_string());
+            }
+            std::lock_guard<std::mutex> guard{mtx};
+            ids.insert(local.begin(), local.end());
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(4 * 3001 == ids.size());
+}
+
+void test_fork() {
+#ifdef STATICLIB_LINUX
+    // initialize thread-local generator in the parent
+    sl::utils::generate_uuid_v4();
+    int fds[2];
+    slassert(0 == ::pipe(fds));
+    pid_t pid = ::fork();
+    slassert(pid >= 0);
+    if (0 == pid) {
+        ::close(fds[0]);
+        char buf[2 * sl::utils::uuid::string_length];
+        sl::utils::generate_uuid_v4().format(buf);
+        sl::utils::generate_uuid_sequential().format(buf + sl::utils::uuid::string_length);
+        ssize_t written = ::write(fds[1], buf, sizeof(buf));
+        ::_exit(written == static_cast<ssize_t> (sizeof(buf)) ? 0 : 1);
+    }
+    ::close(fds[1]);
+    char buf[2 * sl::utils::uuid::string_length];
+    ssize_t read = ::read(fds[0], buf, sizeof(buf));
+    ::close(fds[0]);
+    int status = -1;
+    slassert(pid == ::waitpid(pid, std::addressof(status), 0));
+    slassert(0 == WEXITSTATUS(status));
+    slassert(static_cast<ssize_t> (sizeof(buf)) == read);
+    std::string child_v4(buf, sl::utils::uuid::string_length);
+    std::string child_seq(buf + sl::utils::uuid::string_length, sl::utils::uuid::string_length);
+    slassert(child_v4 != sl::utils::generate_uuid_v4().to_string());
+    slassert(child_seq != sl::utils::generate_uuid_sequential().to_string());
+#endif // STATICLIB_LINUX
+}
+
+int main() {
+    try {
+        test_format();
+        test_v4();
+        test_v7();
+        test_sequential();
+        test_threads();
+        test_fork();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   instrumentation_test.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 11:30 AM
+ */
+
+#include "staticlib/utils/instrumentation.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/utils/url_utils.hpp"
+
+namespace { // anonymous
+
+const sl::utils::instrumented_function test_fun{"instrumentation_test"};
+
+const sl::utils::function_stats& find_stats(const std::vector<sl::utils::function_stats>& vec,
+        const std::string& name) {
+    for (auto& st : vec) {
+        if (name == st.name) {
+            return st;
+        }
+    }
+    throw std::runtime_error("stats not found: [" + name + "]");
+}
+
+} // namespace
+
+void test_registration() {
+    sl::utils::instrumented_function same{"instrumentation_test"};
+    slassert(test_fun.index() == same.index());
+    sl::utils::instrumented_function other{"instrumentation_test_other"};
+    slassert(test_fun.index() != other.index());
+}
+
+void test_record() {
+    sl::utils::reset_stats();
+    sl::utils::record_call(test_fun, 10, 1);
+    sl::utils::record_call(test_fun, 20, 1000);
+    {
+        sl::utils::instrumentation_scope scope{test_fun, 12};
+    }
+    auto stats = sl::utils::dump_stats();
+    auto& st = find_stats(stats, "instrumentation_test");
+    if (sl::utils::instrumentation_enabled()) {
+        slassert(3 == st.calls);
+        slassert(42 == st.bytes);
+        slassert(st.total_ns >= 1001);
+        slassert(st.latency_histogram[0] >= 1);
+        slassert(1 == st.latency_histogram[9]);
+    } else {
+        slassert(0 == st.calls);
+        slassert(0 == st.bytes);
+    }
+}
+
+void test_threads() {
+    sl::utils::reset_stats();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([] {
+            for (size_t j = 0; j < 1000; j++) {
+                sl::utils::record_call(test_fun, 1, 100);
+            }
+        });
+    }
+    // live threads are counted too
+    sl::utils::dump_stats();
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto stats = sl::utils::dump_stats();
+    auto& st = find_stats(stats, "instrumentation_test");
+    if (sl::utils::instrumentation_enabled()) {
+        slassert(4000 == st.calls);
+        slassert(4000 == st.bytes);
+        slassert(4000 == st.latency_histogram[6]);
+    } else {
+        slassert(0 == st.calls);
+    }
+    sl::utils::reset_stats();
+    auto stats_reset = sl::utils::dump_stats();
+    auto& st_reset = find_stats(stats_reset, "instrumentation_test");
+    slassert(0 == st_reset.calls);
+}
+
+void test_library_functions() {
+    sl::utils::reset_stats();
+    sl::utils::url_decode("a%20b");
+    auto stats = sl::utils::dump_stats();
+    if (sl::utils::instrumentation_enabled()) {
+        auto& st = find_stats(stats, "url_decode");
+        slassert(1 == st.calls);
+        slassert(5 == st.bytes);
+    }
+}
+
+void test_format() {
+    sl::utils::reset_stats();
+    sl::utils::record_call(test_fun, 1, 100);
+    auto formatted = sl::utils::format_stats(sl::utils::dump_stats());
+    slassert(0 == formatted.find("function"));
+    if (sl::utils::instrumentation_enabled()) {
+        slassert(std::string::npos != formatted.find("instrumentation_test "));
+    }
+}
+
+int main() {
+    try {
+        test_registration();
+        test_record();
+        test_threads();
+        test_library_functions();
+        test_format();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   kv_scanner_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:40 PM
+ */
+
+#include "staticlib/utils/kv_scanner.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+void test_query() {
+    std::string query{"a=1&b=hello%20world&&c=x+y&d"};
+    sl::utils::kv_scanner sc{query};
+    sl::utils::kv_pair kv;
+    slassert(sc.next(kv));
+    slassert("a" == kv.raw_key());
+    slassert("1" == kv.raw_value());
+    slassert(!kv.value_encoded);
+    slassert(kv.key_equals("a"));
+    slassert(sc.next(kv));
+    slassert("b" == kv.raw_key());
+    slassert("hello%20world" == kv.raw_value());
+    slassert(kv.value_encoded);
+    slassert("hello world" == kv.decoded_value());
+    slassert(sc.next(kv));
+    slassert("c" == kv.decoded_key());
+    slassert("x y" == kv.decoded_value());
+    slassert(sc.next(kv));
+    slassert("d" == kv.raw_key());
+    slassert(0 == kv.value_length);
+    slassert("" == kv.decoded_value());
+    slassert(!sc.next(kv));
+    slassert(!sc.next(kv));
+}
+
+void test_config_line() {
+    std::string line{"k=v;k2=v2=v3;;%6Bey=val;"};
+    sl::utils::kv_scanner sc{line, ';', '='};
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    sl::utils::kv_pair kv;
+    while (sc.next(kv)) {
+        keys.push_back(kv.decoded_key());
+        values.push_back(kv.decoded_value());
+    }
+    slassert(3 == keys.size());
+    slassert("k" == keys[0]);
+    slassert("v" == values[0]);
+    slassert("k2" == keys[1]);
+    slassert("v2=v3" == values[1]);
+    slassert("key" == keys[2]);
+    slassert("val" == values[2]);
+}
+
+void test_empty() {
+    sl::utils::kv_pair kv;
+    sl::utils::kv_scanner sc1{"", 0};
+    slassert(!sc1.next(kv));
+    std::string seps{"&&&"};
+    sl::utils::kv_scanner sc2{seps};
+    slassert(!sc2.next(kv));
+    std::string eq{"="};
+    sl::utils::kv_scanner sc3{eq};
+    slassert(sc3.next(kv));
+    slassert(0 == kv.key_length);
+    slassert(0 == kv.value_length);
+    slassert(!sc3.next(kv));
+}
+
+void test_decode_append() {
+    std::string query{"a=%41%42"};
+    sl::utils::kv_scanner sc{query};
+    sl::utils::kv_pair kv;
+    slassert(sc.next(kv));
+    std::string out{"prefix:"};
+    kv.decode_value(out);
+    slassert("prefix:AB" == out);
+}
+
+int main() {
+    try {
+        test_query();
+        test_config_line();
+        test_empty();
+        test_decode_append();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   latency_histogram_test.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 4:05 PM
+ */
+
+#include "staticlib/utils/latency_histogram.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/config/assert.hpp"
+
+#ifdef STATICLIB_LINUX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // STATICLIB_LINUX
+
+void test_exact() {
+    sl::utils::latency_histogram hist{1000000, 7, 1};
+    slassert(0 == hist.count());
+    slassert(0 == hist.value_at_percentile(50));
+    for (uint64_t i = 1; i <= 100; i++) {
+        hist.record(i);
+    }
+    slassert(100 == hist.count());
+    slassert(1 == hist.min());
+    slassert(100 == hist.max());
+    slassert(50 == hist.value_at_percentile(50));
+    slassert(99 == hist.value_at_percentile(99));
+    slassert(100 == hist.value_at_percentile(100));
+    slassert(1 == hist.value_at_percentile(0));
+    slassert(50.5 == hist.mean());
+}
+
+void test_precision() {
+    sl::utils::latency_histogram hist{};
+    std::mt19937_64 engine{42};
+    for (size_t i = 0; i < 100000; i++) {
+        uint64_t val = engine() % hist.max_value();
+        val >>= engine() % 40;
+        sl::utils::latency_histogram single{hist.max_value(), hist.precision_bits(), 1};
+        single.record(val);
+        uint64_t lowest = single.min();
+        uint64_t highest = single.max();
+        slassert(lowest <= val && val <= highest);
+        // relative error below 1/2^precision_bits
+        slassert((highest - lowest) * 128 <= val);
+    }
+}
+
+void test_clamp() {
+    sl::utils::latency_histogram hist{1000, 3, 1};
+    hist.record(5000);
+    slassert(1000 == hist.max());
+    slassert(1000 == hist.value_at_percentile(100));
+    slassert(1000 == hist.mean());
+}
+
+void test_threads() {
+    sl::utils::latency_histogram hist{1000000, 7, 4};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; i++) {
+        threads.emplace_back([&hist] {
+            for (uint64_t j = 0; j < 10000; j++) {
+                hist.record(j % 1000);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(80000 == hist.count());
+    slassert(0 == hist.min());
+    slassert(999 == hist.max());
+}
+
+void test_merge() {
+    sl::utils::latency_histogram first{1000000, 7, 2};
+    sl::utils::latency_histogram second{1000000, 7, 3};
+    first.record(10, 3);
+    second.record(20, 1);
+    second.record(500000, 1);
+    first.merge(second);
+    slassert(5 == first.count());
+    slassert(10 == first.min());
+    slassert(20 == first.value_at_percentile(80));
+    slassert(first.max() >= 500000);
+    sl::utils::latency_histogram other{1000, 7, 1};
+    bool catched = false;
+    try {
+        first.merge(other);
+    } catch (const sl::utils::utils_exception&) {
+        catched = true;
+    }
+    slassert(catched);
+    first.reset();
+    slassert(0 == first.count());
+}
+
+void test_serialize() {
+    sl::utils::latency_histogram hist{};
+    std::mt19937_64 engine{42};
+    for (size_t i = 0; i < 10000; i++) {
+        hist.record(engine() % 10000000);
+    }
+    std::string ser = hist.serialize();
+    slassert(ser.length() < hist.buckets_count() * sizeof(uint64_t) / 4);
+    auto restored = sl::utils::latency_histogram::deserialize(ser.data(), ser.length());
+    slassert(hist.count() == restored.count());
+    slassert(hist.mean() == restored.mean());
+    slassert(hist.min() == restored.min());
+    slassert(hist.max() == restored.max());
+    for (double pc : {1.0, 50.0, 90.0, 99.0, 99.9}) {
+        slassert(hist.value_at_percentile(pc) == restored.value_at_percentile(pc));
+    }
+    slassert(ser == restored.serialize());
+    // corrupted inputs
+    for (size_t len = 0; len < ser.length(); len++) {
+        bool catched = false;
+        try {
+            sl::utils::latency_histogram::deserialize(ser.data(), len);
+        } catch (const sl::utils::utils_exception&) {
+            catched = true;
+        }
+        slassert(catched);
+    }
+    std::string trailing = ser + "x";
+    bool catched = false;
+    try {
+        sl::utils::latency_histogram::deserialize(trailing.data(), trailing.length());
+    } catch (const sl::utils::utils_exception&) {
+        catched = true;
+    }
+    slassert(catched);
+}
+
+void test_child_process() {
+#ifdef STATICLIB_LINUX
+    int fds[2];
+    slassert(0 == ::pipe(fds));
+    pid_t pid = ::fork();
+    slassert(pid >= 0);
+    if (0 == pid) {
+        ::close(fds[0]);
+        sl::utils::latency_histogram hist{};
+        for (uint64_t i = 1; i <= 1000; i++) {
+            hist.record(i * 1000);
+        }
+        std::string ser = hist.serialize();
+        ssize_t written = ::write(fds[1], ser.data(), ser.length());
+        ::_exit(written == static_cast<ssize_t> (ser.length()) ? 0 : 1);
+    }
+    ::close(fds[1]);
+    std::string ser;
+    char buf[4096];
+    ssize_t read;
+    while ((read = ::read(fds[0], buf, sizeof(buf))) > 0) {
+        ser.append(buf, static_cast<size_t> (read));
+    }
+    ::close(fds[0]);
+    int status = -1;
+    slassert(pid == ::waitpid(pid, std::addressof(status), 0));
+    slassert(0 == WEXITSTATUS(status));
+    sl::utils::latency_histogram parent{};
+    parent.record(42);
+    parent.merge(sl::utils::latency_histogram::deserialize(ser.data(), ser.length()));
+    slassert(1001 == parent.count());
+    slassert(42 == parent.min());
+    uint64_t median = parent.value_at_percentile(50);
+    slassert(median >= 499000 && median <= 505000);
+#endif // STATICLIB_LINUX
+}
+
+int main() {
+    try {
+        test_exact();
+        test_precision();
+        test_clamp();
+        test_threads();
+        test_merge();
+        test_serialize();
+        test_child_process();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
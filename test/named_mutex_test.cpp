@@ -0,0 +1,197 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   named_mutex_test.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 11:30 AM
+ */
+
+#include "staticlib/utils/named_mutex.hpp"
+
+#if defined(STATICLIB_WINDOWS) || defined(STATICLIB_LINUX)
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#ifdef STATICLIB_LINUX
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // STATICLIB_LINUX
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+std::string unique_name(const std::string& base) {
+    auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    return "staticlib_utils_test_" + base + "_" + sl::support::to_string(now);
+}
+
+// segments are left in place by the implementation
+void remove_segment(const std::string& name) {
+#ifdef STATICLIB_LINUX
+    ::shm_unlink(("/staticlib_named_mutex_" + name).c_str());
+#else // !STATICLIB_LINUX
+    (void) name;
+#endif // STATICLIB_LINUX
+}
+
+} // namespace
+
+void test_already_taken() {
+    auto foo = unique_name("foo");
+    auto bar = unique_name("bar");
+    {
+        auto mx1 = sl::utils::named_mutex(foo);
+        slassert(!mx1.already_taken());
+        auto mx2 = sl::utils::named_mutex(bar);
+        slassert(!mx2.already_taken());
+        auto mx3 = sl::utils::named_mutex(foo);
+        slassert(mx3.already_taken());
+    }
+    auto mx4 = sl::utils::named_mutex(foo);
+    slassert(!mx4.already_taken());
+    auto mx5 = sl::utils::named_mutex(foo);
+    slassert(mx5.already_taken());
+    auto mx6 = std::move(mx5);
+    slassert(mx6.already_taken());
+    remove_segment(foo);
+    remove_segment(bar);
+}
+
+void test_lock() {
+    auto name = unique_name("lock");
+    auto mx = sl::utils::named_mutex(name);
+    mx.lock();
+    slassert(!mx.previous_owner_died());
+    bool acquired = true;
+    bool acquired_timed = true;
+    auto waited = std::chrono::milliseconds(0);
+    std::thread th([&] {
+        auto other = sl::utils::named_mutex(name);
+        acquired = other.try_lock();
+        auto start = std::chrono::steady_clock::now();
+        acquired_timed = other.lock_for(std::chrono::milliseconds(50));
+        waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    });
+    th.join();
+    slassert(!acquired);
+    slassert(!acquired_timed);
+    slassert(waited.count() >= 40);
+    mx.unlock();
+    std::thread th2([&] {
+        auto other = sl::utils::named_mutex(name);
+        acquired = other.try_lock();
+        other.unlock();
+        acquired_timed = other.lock_for(std::chrono::milliseconds(50));
+        other.unlock();
+    });
+    th2.join();
+    slassert(acquired);
+    slassert(acquired_timed);
+    slassert(mx.try_lock());
+    mx.unlock();
+    remove_segment(name);
+}
+
+#ifdef STATICLIB_LINUX
+void test_owner_died() {
+    auto name = unique_name("died");
+    int ready[2];
+    slassert(0 == ::pipe(ready));
+    pid_t pid = ::fork();
+    slassert(-1 != pid);
+    if (0 == pid) {
+        auto mx = sl::utils::named_mutex(name);
+        mx.lock();
+        char ch = mx.already_taken() ? 'T' : 'F';
+        auto written = ::write(ready[1], std::addressof(ch), 1);
+        (void) written;
+        for (;;) {
+            ::pause();
+        }
+    }
+    char ch = 0;
+    slassert(1 == ::read(ready[0], std::addressof(ch), 1));
+    slassert('F' == ch);
+    auto mx = sl::utils::named_mutex(name);
+    slassert(mx.already_taken());
+    slassert(!mx.try_lock());
+    ::kill(pid, SIGKILL);
+    ::waitpid(pid, nullptr, 0);
+    ::close(ready[0]);
+    ::close(ready[1]);
+    mx.lock();
+    slassert(mx.previous_owner_died());
+    mx.unlock();
+    mx.lock();
+    slassert(!mx.previous_owner_died());
+    mx.unlock();
+    auto mx2 = sl::utils::named_mutex(name);
+    slassert(!mx2.already_taken());
+    remove_segment(name);
+}
+#endif // STATICLIB_LINUX
+
+#ifdef STATICLIB_LINUX
+void test_uninitialized_segment() {
+    // creator crashed after creating the segment, before and after sizing it
+    for (size_t size : {0, 4096}) {
+        auto name = unique_name("uninit");
+        int fd = ::shm_open(("/staticlib_named_mutex_" + name).c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        slassert(-1 != fd);
+        slassert(0 == ::ftruncate(fd, static_cast<off_t> (size)));
+        ::close(fd);
+        auto mx = sl::utils::named_mutex(name);
+        slassert(!mx.already_taken());
+        slassert(mx.try_lock());
+        mx.unlock();
+        auto mx2 = sl::utils::named_mutex(name);
+        slassert(mx2.already_taken());
+        remove_segment(name);
+    }
+}
+#endif // STATICLIB_LINUX
+
+int main() {
+    try {
+        test_already_taken();
+        test_lock();
+#ifdef STATICLIB_LINUX
+        test_owner_died();
+        test_uninitialized_segment();
+#endif // STATICLIB_LINUX
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // STATICLIB_WINDOWS || STATICLIB_LINUX
+
+int main() {
+    return 0;
+}
+
+#endif // STATICLIB_WINDOWS || STATICLIB_LINUX
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   output_aggregator_test.cpp
+ * Author: alex
+ *
+ * Created on October 23, 2026, 2:05 PM
+ */
+
+#include "staticlib/utils/output_aggregator.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <algorithm>
+#include <csignal>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+const size_t stream_size = 4 * 1024 * 1024;
+
+char stream_byte(size_t pos) {
+    return static_cast<char> ((pos * 31 + (pos >> 10)) & 0xff);
+}
+
+int open_target(const std::string& path, int flags) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | flags, S_IRUSR | S_IWUSR);
+    slassert(-1 != fd);
+    return fd;
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream stream{path, std::ios::binary};
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+void write_stream(int fd) {
+    std::vector<char> buf(5000);
+    size_t pos = 0;
+    while (pos < stream_size) {
+        size_t len = std::min(buf.size(), stream_size - pos);
+        for (size_t i = 0; i < len; i++) {
+            buf[i] = stream_byte(pos + i);
+        }
+        size_t written = 0;
+        while (written < len) {
+            ssize_t res = ::write(fd, buf.data() + written, len - written);
+            slassert(res > 0);
+            written += static_cast<size_t> (res);
+        }
+        pos += len;
+    }
+    ::close(fd);
+}
+
+void check_stream(const std::string& data) {
+    slassert(stream_size == data.length());
+    for (size_t i = 0; i < data.length(); i++) {
+        if (stream_byte(i) != data[i]) {
+            slassert(false);
+        }
+    }
+}
+
+} // namespace
+
+void test_stream(int flags) {
+    int target = open_target("aggregator_stream_out.txt", flags);
+    {
+        sl::utils::output_aggregator agg{target};
+        int fd = agg.add_source("");
+        std::thread writer([fd] {
+            write_stream(fd);
+        });
+        agg.wait_drained();
+        writer.join();
+        auto st = agg.stats();
+        slassert(stream_size == st.bytes);
+        slassert(st.chunks > 0);
+        slassert(0 == st.errors);
+        slassert(0 == st.active_sources);
+    }
+    ::close(target);
+    check_stream(read_file("aggregator_stream_out.txt"));
+}
+
+void test_splice() {
+    test_stream(0);
+}
+
+void test_append_fallback() {
+    // splice into O_APPEND file fails with EINVAL, read/write is used instead
+    test_stream(O_APPEND);
+}
+
+void test_exec_prefixes() {
+    int target = open_target("aggregator_exec_out.txt", 0);
+    {
+        sl::utils::output_aggregator agg{target};
+        for (size_t i = 0; i < 8; i++) {
+            std::string id = std::to_string(i);
+            sl::utils::spawn_options opts;
+            opts.env_mode = sl::utils::spawn_env_mode::replace;
+            opts.env.emplace_back("CHILD_ID", id);
+            agg.exec_async("/bin/sh", {"-c", "echo \"child $CHILD_ID\""}, "[" + id + "] ", opts);
+        }
+        agg.wait_drained();
+        auto st = agg.stats();
+        slassert(8 == st.chunks);
+        slassert(8 * std::string("child 0\n").length() == st.bytes);
+        slassert(0 == st.errors);
+    }
+    ::close(target);
+    std::string out = read_file("aggregator_exec_out.txt");
+    for (size_t i = 0; i < 8; i++) {
+        std::string id = std::to_string(i);
+        slassert(std::string::npos != out.find("[" + id + "] child " + id + "\n"));
+    }
+}
+
+void test_exec_error() {
+    int target = open_target("aggregator_error_out.txt", 0);
+    sl::utils::output_aggregator agg{target};
+    bool thrown = false;
+    try {
+        agg.exec_async("/nonexistent/executable", {}, "[missing] ");
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    // source of the failed spawn is closed
+    agg.wait_drained();
+    slassert(0 == agg.stats().bytes);
+    ::close(target);
+}
+
+void test_stop_with_active_sources() {
+    int target = open_target("aggregator_stop_out.txt", 0);
+    int fd = -1;
+    {
+        sl::utils::output_aggregator agg{target};
+        fd = agg.add_source("[open] ");
+        slassert(1 == agg.stats().active_sources);
+    }
+    // read end is closed by the destructor
+    std::signal(SIGPIPE, SIG_IGN);
+    slassert(-1 == ::write(fd, "a", 1));
+    ::close(fd);
+    ::close(target);
+}
+
+int main() {
+    try {
+        test_splice();
+        test_append_fallback();
+        test_exec_prefixes();
+        test_exec_error();
+        test_stop_with_active_sources();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // STATICLIB_LINUX
+
+int main() {
+    return 0;
+}
+
+#endif // STATICLIB_LINUX
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_float_test.cpp
+ * Author: alex
+ *
+ * Created on October 25, 2026, 3:02 PM
+ */
+
+#include "staticlib/utils/parse_float.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+template<typename T, typename B>
+B to_bits(T val) {
+    B res;
+    std::memcpy(&res, &val, sizeof(res));
+    return res;
+}
+
+bool same_double(double expected, const std::string& str) {
+    auto res = sl::utils::parse_double(str);
+    return res.ok() && to_bits<double, uint64_t>(expected) == to_bits<double, uint64_t>(res.value());
+}
+
+bool same_float(float expected, const std::string& str) {
+    auto res = sl::utils::parse_float(str);
+    return res.ok() && to_bits<float, uint32_t>(expected) == to_bits<float, uint32_t>(res.value());
+}
+
+// glibc strtod is correctly rounded and "C" locale is used in tests
+bool same_as_strtod(const std::string& str) {
+    double dval = std::strtod(str.c_str(), nullptr);
+    bool dsame = std::isinf(dval) ?
+            sl::utils::error_code::out_of_range == sl::utils::parse_double(str).error() :
+            same_double(dval, str);
+    float fval = std::strtof(str.c_str(), nullptr);
+    bool fsame = std::isinf(fval) ?
+            sl::utils::error_code::out_of_range == sl::utils::parse_float(str).error() :
+            same_float(fval, str);
+    return dsame && fsame;
+}
+
+} // namespace
+
+void test_simple() {
+    slassert(same_double(42.0, "42"));
+    slassert(same_double(-42.5, "-42.5"));
+    slassert(same_double(42.5, "+42.5"));
+    slassert(same_double(0.5, ".5"));
+    slassert(same_double(1.0, "1."));
+    slassert(same_double(1.5e10, "1.5e10"));
+    slassert(same_double(1.5e-10, "1.5E-10"));
+    slassert(same_double(150.0, "1.5e+2"));
+    slassert(same_double(0.0, "0"));
+    slassert(same_double(-0.0, "-0"));
+    slassert(same_double(0.0, "0e999999999"));
+    slassert(same_double(0.1, "0.1"));
+    slassert(same_double(0.1, "0.1000000000000000000000000000000000000001"));
+    slassert(same_float(0.1f, "0.1"));
+    slassert(same_float(-3.4028234663852886e38f, "-3.4028234663852886e38"));
+    std::string range = "12.25xyz";
+    auto res = sl::utils::parse_double(range.data(), range.data() + 5);
+    slassert(res.ok());
+    slassert(12.25 == res.value());
+}
+
+void test_special() {
+    slassert(std::isinf(sl::utils::parse_double("inf").value()));
+    slassert(std::isinf(sl::utils::parse_double("-Infinity").value()));
+    slassert(sl::utils::parse_double("-Infinity").value() < 0);
+    slassert(std::isnan(sl::utils::parse_double("NaN").value()));
+    slassert(std::isinf(sl::utils::parse_float("+INF").value()));
+    slassert(std::isnan(sl::utils::parse_float("nan").value()));
+}
+
+void test_invalid() {
+    const char* invalid[] = {"", "-", "+", ".", "e5", "1e", "1e+", "1.2.3", " 1", "1 ", "0x10",
+        "1,5", "infinit", "nan(1)", "--1", "1e5.5"};
+    for (const char* st : invalid) {
+        auto res = sl::utils::parse_double(st);
+        slassert(!res.ok());
+        slassert(sl::utils::error_code::invalid_format == res.error());
+        slassert(sl::utils::error_code::invalid_format == sl::utils::parse_float(st).error());
+    }
+    slassert(sl::utils::error_code::invalid_format == sl::utils::parse_double(nullptr, nullptr).error());
+}
+
+void test_range() {
+    slassert(sl::utils::error_code::out_of_range == sl::utils::parse_double("1e309").error());
+    slassert(sl::utils::error_code::out_of_range == sl::utils::parse_double("-1.8e308").error());
+    slassert(sl::utils::error_code::out_of_range == sl::utils::parse_float("3.5e38").error());
+    slassert(sl::utils::error_code::out_of_range == sl::utils::parse_double(std::string(400, '9')).error());
+    slassert(same_double(1.7976931348623157e308, "1.7976931348623157e308"));
+    slassert(same_double(0.0, "1e-400"));
+    slassert(same_double(-0.0, "-1e-400"));
+    slassert(same_float(0.0f, "1e-46"));
+    slassert(same_as_strtod("4.9406564584124654e-324"));
+    slassert(same_as_strtod("2.4703282292062327e-324"));
+    slassert(same_as_strtod("2.4703282292062328e-324"));
+    slassert(same_as_strtod("1.401298464324817e-45"));
+    slassert(same_as_strtod("7.006492321624085e-46"));
+}
+
+void test_hard_cases() {
+    const char* hard[] = {
+        // smallest normal and largest subnormal
+        "2.2250738585072011e-308",
+        "2.2250738585072012e-308",
+        "2.2250738585072014e-308",
+        // halfway cases, round half to even
+        "9007199254740993",
+        "9007199254740995",
+        "9007199254740993.0000000000000000001",
+        "16777217",
+        "16777219",
+        "1.00000005960464477539062499",
+        "1.000000059604644775390625",
+        "1.00000005960464477539062501",
+        "8.988465674311579538646525953945123668089884894711532863671504057886633790275048156635423866120376801056005693993569667882939488440720831124642371531973706218888394671243274263815110980062304705972654147604250288441907534117123144073695655527041361858167525534229314911997362296923985815241999999999e307",
+        "7.4109846876186981626485318930233205854758970392148714663837852375101326090531312779794975454245398856969484704316857659638998506553390969459816219401617281718945106978546710679176872575177347315553307795408549809608457500958111373034747658096871009590975442271004757307809711118935784838675653998783503015228055934046593739791790738723868299395818481660169122019456499931289798411362062484498678713572180352209017023903285791732520220528974020802906854021606612375549983402671300035812486479041385743401875520901590172592547146296175134159774938718574737870961645638908718119841271673056017045493004705269590165763776884908267986972573366521765567941072508764337560846003984904972149117463085539556354188641513168478436313080237596295773983001708984375e-324",
+        "1448997445238699",
+        "2.2250738585072011360574097967091319759348195463516456480234261098e-308",
+        "1.0e23",
+        "9.5e-5",
+        "7.3177701707893310e+15",
+        "3.0540412e5",
+        "179769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497791.9999999999999999999999999999999999999999999999999999999999999999999999",
+        "0.000000000000000000000000000000000000011754942807573642917278829910357665133228589927589904276829631184250030649651730385585324256680905818939208984375"
+    };
+    for (const char* st : hard) {
+        slassert(same_as_strtod(st));
+    }
+    std::string long_digits = "0." + std::string(1000, '0') + "1e1000";
+    slassert(same_as_strtod(long_digits));
+    std::string many_digits = "1." + std::string(900, '0') + "1";
+    slassert(same_as_strtod(many_digits));
+    slassert(same_double(1.0, many_digits));
+}
+
+void test_round_trip() {
+    std::mt19937_64 engine{42};
+    char buf[64];
+    for (size_t i = 0; i < 200000; i++) {
+        uint64_t bits = engine();
+        double dval;
+        std::memcpy(&dval, &bits, sizeof(dval));
+        if (std::isfinite(dval)) {
+            std::snprintf(buf, sizeof(buf), "%.17g", dval);
+            slassert(same_double(dval, buf));
+        }
+        uint32_t fbits = static_cast<uint32_t> (bits >> 32);
+        float fval;
+        std::memcpy(&fval, &fbits, sizeof(fval));
+        if (std::isfinite(fval)) {
+            std::snprintf(buf, sizeof(buf), "%.9g", fval);
+            slassert(same_float(fval, buf));
+        }
+    }
+}
+
+void test_random_decimals() {
+    std::mt19937_64 engine{4242};
+    for (size_t i = 0; i < 200000; i++) {
+        std::string st;
+        if (engine() % 2) {
+            st.push_back('-');
+        }
+        size_t int_digits = engine() % 25;
+        size_t frac_digits = engine() % 25;
+        for (size_t j = 0; j < int_digits; j++) {
+            st.push_back(static_cast<char> ('0' + engine() % 10));
+        }
+        st.push_back('.');
+        for (size_t j = 0; j < frac_digits; j++) {
+            st.push_back(static_cast<char> ('0' + engine() % 10));
+        }
+        if (0 == int_digits + frac_digits) {
+            st.push_back('7');
+        }
+        int exp = static_cast<int> (engine() % 700) - 350;
+        st += "e" + std::to_string(exp);
+        slassert(same_as_strtod(st));
+    }
+}
+
+int main() {
+    try {
+        test_simple();
+        test_special();
+        test_invalid();
+        test_range();
+        test_hard_cases();
+        test_round_trip();
+        test_random_decimals();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
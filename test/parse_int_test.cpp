@@ -166,6 +166,72 @@ void test_parse_uint64() {
     slassert(catched_invalid);
 }
 
+void test_try_parse() {
+    auto ok = sl::utils::try_parse_int32("-42");
+    slassert(ok.ok());
+    slassert(static_cast<bool> (ok));
+    slassert(-42 == ok.value());
+    slassert(sl::utils::error_code::ok == ok.error());
+    auto invalid = sl::utils::try_parse_int32("42A");
+    slassert(!invalid);
+    slassert(sl::utils::error_code::invalid_format == invalid.error());
+    slassert(42 == invalid.value_or(42));
+    auto overflow = sl::utils::try_parse_uint16("65536");
+    slassert(sl::utils::error_code::out_of_range == overflow.error());
+    slassert(sl::utils::error_code::out_of_range == sl::utils::try_parse_uint32("-1").error());
+    slassert(sl::utils::error_code::invalid_format == sl::utils::try_parse_int64("0x").error());
+    slassert(18446744073709551615u == sl::utils::try_parse_uint64("18446744073709551615").value());
+    bool catched = false;
+    try {
+        invalid.value();
+    } catch (const sl::utils::utils_exception& e) {
+        catched = true;
+        slassert(0 == std::string(e.what()).find("Invalid format"));
+    }
+    slassert(catched);
+}
+
+void test_try_parse_decimal() {
+    std::string digits = "12345 18446744073709551615 18446744073709551616";
+    const char* data = digits.data();
+    auto first = sl::utils::try_parse_uint64_decimal(data, data + 5);
+    slassert(first.ok());
+    slassert(12345 == first.value());
+    slassert(18446744073709551615u == sl::utils::try_parse_uint64_decimal(data + 6, data + 26).value());
+    slassert(sl::utils::error_code::out_of_range == sl::utils::try_parse_uint64_decimal(data + 27, data + 47).error());
+    slassert(0 == sl::utils::try_parse_uint64_decimal(data + 4, data + 4).value_or(0));
+    slassert(sl::utils::error_code::invalid_format == sl::utils::try_parse_uint64_decimal(data + 4, data + 4).error());
+    slassert(sl::utils::error_code::invalid_format == sl::utils::try_parse_uint64_decimal(data, data + 6).error());
+    std::string signed_str = "-1";
+    slassert(sl::utils::error_code::invalid_format == sl::utils::try_parse_uint64_decimal(
+            signed_str.data(), signed_str.data() + signed_str.length()).error());
+    std::string zeros = "000";
+    slassert(0 == sl::utils::try_parse_uint64_decimal(zeros.data(), zeros.data() + zeros.length()).value());
+    // prefixes are accepted only by the strtoull-based variant
+    std::string hex = "0x10";
+    slassert(16 == sl::utils::try_parse_uint64(hex).value());
+    slassert(sl::utils::error_code::invalid_format == sl::utils::try_parse_uint64_decimal(
+            hex.data(), hex.data() + hex.length()).error());
+    std::string octal = "010";
+    slassert(8 == sl::utils::try_parse_uint64(octal).value());
+    slassert(10 == sl::utils::try_parse_uint64_decimal(octal.data(), octal.data() + octal.length()).value());
+}
+
+void test_error_message() {
+    try {
+        sl::utils::parse_int16("foo");
+        slassert(false);
+    } catch (const sl::utils::utils_exception& e) {
+        slassert(0 == std::string(e.what()).find("Cannot parse int16_t from string:[foo]\n    at "));
+    }
+    try {
+        sl::utils::parse_int32("4294967296");
+        slassert(false);
+    } catch (const sl::utils::utils_exception& e) {
+        slassert(0 == std::string(e.what()).find("Value overflow for int32_t from string:[4294967296]"));
+    }
+}
+
 int main() {
     try {
         test_parse_int16();
@@ -173,7 +239,10 @@ int main() {
         test_parse_int32();
         test_parse_uint32();
         test_parse_int64();
-        test_parse_uint64();        
+        test_parse_uint64();
+        test_try_parse();
+        test_try_parse_decimal();
+        test_error_message();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parse_units_test.cpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 1:15 PM
+ */
+
+#include "staticlib/utils/parse_units.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+using namespace sl::utils::literals;
+
+namespace { // anonymous
+
+int64_t ns(const std::string& str) {
+    return sl::utils::parse_duration(str).value().count();
+}
+
+sl::utils::error_code duration_error(const std::string& str) {
+    return sl::utils::parse_duration(str).error();
+}
+
+sl::utils::error_code bytes_error(const std::string& str) {
+    return sl::utils::parse_bytes(str).error();
+}
+
+} // namespace
+
+void test_duration() {
+    slassert(500000000 == ns("500ms"));
+    slassert(30000000000 == ns("30s"));
+    slassert(1500000000 == ns("1.5s"));
+    slassert(5400000000000 == ns("1h30m"));
+    slassert(5400000000000 == ns("90min"));
+    slassert(86400000000000 == ns("1d"));
+    slassert(1 == ns("1ns"));
+    slassert(2000 == ns("2us"));
+    slassert(2000 == ns("2\xc2\xb5s"));
+    slassert(3723004005006 == ns("1h2m3s4ms5us6ns"));
+    slassert(-1500000000 == ns("-1.5s"));
+    slassert(1000000000 == ns("+1s"));
+    slassert(0 == ns("0"));
+    slassert(0 == ns("-0"));
+    slassert(0 == ns("0.1ns"));
+    slassert(500000000 == ns(".5s"));
+    slassert(1000000000 == ns("1.s"));
+    // 2^63 - 1
+    slassert(9223372036854775807 == ns("9223372036854775807ns"));
+    slassert(std::numeric_limits<int64_t>::min() == ns("-9223372036854775808ns"));
+}
+
+void test_duration_errors() {
+    slassert(sl::utils::error_code::invalid_format == duration_error(""));
+    slassert(sl::utils::error_code::invalid_format == duration_error("-"));
+    slassert(sl::utils::error_code::invalid_format == duration_error("s"));
+    slassert(sl::utils::error_code::invalid_format == duration_error(".s"));
+    slassert(sl::utils::error_code::invalid_format == duration_error("1.2.3s"));
+    slassert(sl::utils::error_code::invalid_format == duration_error("--1s"));
+    slassert(sl::utils::error_code::unknown_unit == duration_error("1 s"));
+    slassert(sl::utils::error_code::invalid_format == duration_error("1"));
+    slassert(sl::utils::error_code::unknown_unit == duration_error("1sec"));
+    slassert(sl::utils::error_code::invalid_format == duration_error("1h30"));
+    slassert(sl::utils::error_code::out_of_range == duration_error("9223372036854775808ns"));
+    slassert(sl::utils::error_code::out_of_range == duration_error("-9223372036854775809ns"));
+    slassert(sl::utils::error_code::out_of_range == duration_error("106752d"));
+    slassert(sl::utils::error_code::out_of_range == duration_error("99999999999999999999ns"));
+    slassert(sl::utils::error_code::out_of_range == duration_error("9223372036854775807ns1ns"));
+    slassert(sl::utils::error_code::invalid_format == duration_error(std::string(200, '1') + "s"));
+}
+
+void test_bytes() {
+    slassert(4096 == sl::utils::parse_bytes("4096").value());
+    slassert(4096 == sl::utils::parse_bytes("4096B").value());
+    slassert(4294967296ULL == sl::utils::parse_bytes("4GiB").value());
+    slassert(4294967296ULL == sl::utils::parse_bytes("4Gi").value());
+    slassert(4000000000ULL == sl::utils::parse_bytes("4GB").value());
+    slassert(1500 == sl::utils::parse_bytes("1.5k").value());
+    slassert(1500 == sl::utils::parse_bytes("1.5K").value());
+    slassert(1536 == sl::utils::parse_bytes("1.5KiB").value());
+    slassert(512 == sl::utils::parse_bytes(".5KiB").value());
+    slassert(2 == sl::utils::parse_bytes("2.000B").value());
+    slassert(1152921504606846976ULL == sl::utils::parse_bytes("1EiB").value());
+    slassert(18446744073709551615ULL == sl::utils::parse_bytes("18446744073709551615").value());
+    slassert(17293822569102704640ULL == sl::utils::parse_bytes("15EiB").value());
+    slassert(8646911284551352320ULL == sl::utils::parse_bytes("7.5EiB").value());
+    slassert(1 == sl::utils::parse_bytes("0.0009765625KiB").value());
+    std::string range = "64MiB,128MiB";
+    slassert(67108864 == sl::utils::parse_bytes(range.data(), range.data() + 5).value());
+}
+
+void test_bytes_errors() {
+    slassert(sl::utils::error_code::invalid_format == bytes_error(""));
+    slassert(sl::utils::error_code::invalid_format == bytes_error("."));
+    slassert(sl::utils::error_code::invalid_format == bytes_error("-1"));
+    slassert(sl::utils::error_code::invalid_format == bytes_error("1.5"));
+    slassert(sl::utils::error_code::invalid_format == bytes_error("0.0003k"));
+    slassert(sl::utils::error_code::invalid_format == bytes_error("1k1"));
+    slassert(sl::utils::error_code::unknown_unit == bytes_error("1kb"));
+    slassert(sl::utils::error_code::unknown_unit == bytes_error("4 GiB"));
+    slassert(sl::utils::error_code::unknown_unit == bytes_error("1X"));
+    slassert(sl::utils::error_code::out_of_range == bytes_error("18446744073709551616"));
+    slassert(sl::utils::error_code::out_of_range == bytes_error("16EiB"));
+    slassert(sl::utils::error_code::out_of_range == bytes_error("18446744073709551615.5k"));
+}
+
+void test_literals() {
+    static_assert(4294967296ULL == "4GiB"_bytes, "bytes literal");
+    static_assert(1500 == "1.5k"_bytes, "bytes literal");
+    static_assert(500000000 == "500ms"_duration.count(), "duration literal");
+    static_assert(-5400000000000 == "-1h30m"_duration.count(), "duration literal");
+    constexpr std::chrono::nanoseconds timeout = "1m30s"_duration;
+    slassert(std::chrono::seconds(90) == timeout);
+    bool catched = false;
+    try {
+        auto invalid = "4XB"_bytes;
+        (void) invalid;
+    } catch (const sl::utils::utils_exception& e) {
+        catched = true;
+        slassert(0 == std::string(e.what()).find("Invalid literal:[4XB]"));
+    }
+    slassert(catched);
+}
+
+int main() {
+    try {
+        test_duration();
+        test_duration_errors();
+        test_bytes();
+        test_bytes_errors();
+        test_literals();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -7,11 +7,25 @@
 
 #include "staticlib/utils/process_utils.hpp"
 
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
+#ifdef STATICLIB_LINUX
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // STATICLIB_LINUX
+
 #include "staticlib/config/assert.hpp"
 
 #include "staticlib/config.hpp"
@@ -36,6 +50,135 @@ void test_exec_and_wait() {
 #endif // STATICLIB_WINDOWS
 }
 
+void test_exec_error() {
+#ifndef STATICLIB_WINDOWS
+    bool catched = false;
+    try {
+        sl::utils::exec_async("/nonexistent/executable", {"-h"}, "nonexistent_out.txt");
+    } catch (const sl::utils::utils_exception& e) {
+        catched = true;
+        std::string msg = e.what();
+        slassert(std::string::npos != msg.find("stage: [execve]"));
+        slassert(std::string::npos != msg.find(::strerror(ENOENT)));
+    }
+    slassert(catched);
+    bool catched_wait = false;
+    try {
+        sl::utils::exec_and_wait("/nonexistent/executable", {}, "nonexistent_out.txt");
+    } catch (const sl::utils::utils_exception&) {
+        catched_wait = true;
+    }
+    slassert(catched_wait);
+#endif // !STATICLIB_WINDOWS
+}
+
+#ifndef STATICLIB_WINDOWS
+std::string read_file(const std::string& path) {
+    std::ifstream stream{path};
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+#endif // !STATICLIB_WINDOWS
+
+void test_exec_env_replace() {
+#ifndef STATICLIB_WINDOWS
+    sl::utils::spawn_options opts;
+    opts.env_mode = sl::utils::spawn_env_mode::replace;
+    opts.env.emplace_back("SL_FIRST", "1");
+    opts.env.emplace_back("SL_SECOND", "a=b c");
+    int code = sl::utils::exec_and_wait("/usr/bin/env", {}, "env_replace_out.txt", opts);
+    slassert(0 == code);
+    slassert("SL_FIRST=1\nSL_SECOND=a=b c\n" == read_file("env_replace_out.txt"));
+    // empty environment
+    opts.env.clear();
+    code = sl::utils::exec_and_wait("/usr/bin/env", {}, "env_replace_out.txt", opts);
+    slassert(0 == code);
+    slassert("" == read_file("env_replace_out.txt"));
+#endif // !STATICLIB_WINDOWS
+}
+
+void test_exec_env_overlay() {
+#ifndef STATICLIB_WINDOWS
+    ::setenv("SL_OVERLAY_KEPT", "kept", 1);
+    ::setenv("SL_OVERLAY_REPLACED", "parent", 1);
+    sl::utils::spawn_options opts;
+    opts.env_mode = sl::utils::spawn_env_mode::overlay;
+    opts.env.emplace_back("SL_OVERLAY_REPLACED", "child");
+    opts.env.emplace_back("SL_OVERLAY_ADDED", "added");
+    int code = sl::utils::exec_and_wait("/bin/sh", {"-c",
+            "echo \"$SL_OVERLAY_KEPT $SL_OVERLAY_REPLACED $SL_OVERLAY_ADDED\"; env | grep -c SL_OVERLAY_REPLACED"},
+            "env_overlay_out.txt", opts);
+    slassert(0 == code);
+    slassert("kept child added\n1\n" == read_file("env_overlay_out.txt"));
+    // parent is not modified
+    slassert(std::string("parent") == ::getenv("SL_OVERLAY_REPLACED"));
+    slassert(nullptr == ::getenv("SL_OVERLAY_ADDED"));
+#endif // !STATICLIB_WINDOWS
+}
+
+void test_exec_cwd() {
+#ifndef STATICLIB_WINDOWS
+    sl::utils::spawn_options opts;
+    opts.cwd = "/";
+    int code = sl::utils::exec_and_wait("/bin/sh", {"-c", "pwd"}, "cwd_out.txt", opts);
+    slassert(0 == code);
+    slassert("/\n" == read_file("cwd_out.txt"));
+    // parent is not modified, out path is relative to parent cwd
+    slassert(std::string::npos == read_file("cwd_out.txt").find("cwd_out"));
+    bool catched = false;
+    try {
+        opts.cwd = "/nonexistent/directory";
+        sl::utils::exec_and_wait("/bin/sh", {"-c", "pwd"}, "cwd_out.txt", opts);
+    } catch (const sl::utils::utils_exception& e) {
+        catched = true;
+        slassert(std::string::npos != std::string(e.what()).find("/nonexistent/directory"));
+    }
+    slassert(catched);
+#endif // !STATICLIB_WINDOWS
+}
+
+void test_exec_invalid_env() {
+    sl::utils::spawn_options opts;
+    opts.env_mode = sl::utils::spawn_env_mode::replace;
+    opts.env.emplace_back("SL_INVALID=NAME", "1");
+    bool catched = false;
+    try {
+        sl::utils::exec_and_wait("/usr/bin/env", {}, "env_invalid_out.txt", opts);
+    } catch (const sl::utils::utils_exception&) {
+        catched = true;
+    }
+    slassert(catched);
+}
+
+void test_exec_concurrent() {
+#ifndef STATICLIB_WINDOWS
+    const size_t threads_count = 4;
+    std::vector<std::thread> threads;
+    std::vector<int> codes(threads_count, -1);
+    for (size_t i = 0; i < threads_count; i++) {
+        threads.emplace_back([i, &codes] {
+            sl::utils::spawn_options opts;
+            opts.env_mode = sl::utils::spawn_env_mode::replace;
+            opts.env.emplace_back("SL_THREAD", std::to_string(i));
+            opts.cwd = 0 == i % 2 ? "/" : "/tmp";
+            std::string out = "concurrent_out_" + std::to_string(i) + ".txt";
+            for (size_t j = 0; j < 8; j++) {
+                codes[i] = sl::utils::exec_and_wait("/bin/sh", {"-c", "echo \"$SL_THREAD $(pwd)\""}, out, opts);
+                if (0 != codes[i] || read_file(out) != opts.env[0].second + " " + opts.cwd + "\n") {
+                    codes[i] = -1;
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (int code : codes) {
+        slassert(0 == code);
+    }
+#endif // !STATICLIB_WINDOWS
+}
+
 void test_executable_path() {
     auto st = sl::utils::current_executable_path();
     slassert(st.length() > 0);
@@ -43,13 +186,124 @@ void test_executable_path() {
 //    std::cout << "[" << st << "]" << std::endl;
 }
 
+void test_current_process_stats() {
+#ifdef STATICLIB_LINUX
+    auto st = sl::utils::current_process_stats();
+    slassert(st.rss_bytes > 0);
+    slassert(st.virtual_bytes >= st.rss_bytes);
+    slassert(st.threads_count >= 1);
+    slassert(st.user_time.count() >= 0);
+    slassert(st.system_time.count() >= 0);
+    // descriptors
+    std::vector<int> fds;
+    for (size_t i = 0; i < 5; i++) {
+        int fd = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+        slassert(-1 != fd);
+        fds.push_back(fd);
+    }
+    auto st_fds = sl::utils::current_process_stats();
+    slassert(st.open_fds_count + 5 == st_fds.open_fds_count);
+    for (int fd : fds) {
+        ::close(fd);
+    }
+    // threads
+    std::mutex mutex;
+    std::unique_lock<std::mutex> guard{mutex};
+    std::thread th([&mutex] {
+        std::lock_guard<std::mutex> th_guard{mutex};
+    });
+    auto st_threads = sl::utils::current_process_stats();
+    guard.unlock();
+    th.join();
+    slassert(st.threads_count + 1 == st_threads.threads_count);
+    // CPU time
+    volatile uint64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+        sink += 1;
+    }
+    auto st_cpu = sl::utils::current_process_stats();
+    slassert(st_cpu.user_time + st_cpu.system_time > st.user_time + st.system_time);
+#endif // STATICLIB_LINUX
+}
+
+void test_child_process_stats() {
+#ifdef STATICLIB_LINUX
+    pid_t pid = ::fork();
+    slassert(-1 != pid);
+    if (0 == pid) {
+        ::pause();
+        ::_exit(0);
+    }
+    {
+        sl::utils::process_stats_reader reader{pid};
+        slassert(pid == reader.process_id());
+        auto st = reader.read();
+        slassert(st.rss_bytes > 0);
+        slassert(1 == st.threads_count);
+        // stats of the forked child are read with its own files
+        auto self = sl::utils::current_process_stats();
+        slassert(self.open_fds_count > 0);
+        ::kill(pid, SIGKILL);
+        int status;
+        slassert(pid == ::waitpid(pid, std::addressof(status), 0));
+        bool catched = false;
+        try {
+            reader.read();
+        } catch (const sl::utils::utils_exception& e) {
+            catched = true;
+            slassert(std::string::npos != std::string(e.what()).find("pid: [" + std::to_string(pid) + "]"));
+        }
+        slassert(catched);
+    }
+    bool catched_open = false;
+    try {
+        sl::utils::process_stats_reader reader{pid};
+    } catch (const sl::utils::utils_exception&) {
+        catched_open = true;
+    }
+    slassert(catched_open);
+#endif // STATICLIB_LINUX
+}
+
+void test_forked_process_stats() {
+#ifdef STATICLIB_LINUX
+    // parent files are reopened in the forked child
+    auto parent = sl::utils::current_process_stats();
+    slassert(parent.threads_count >= 1);
+    pid_t pid = ::fork();
+    slassert(-1 != pid);
+    if (0 == pid) {
+        try {
+            auto st = sl::utils::current_process_stats();
+            ::_exit(1 == st.threads_count ? 0 : 1);
+        } catch (...) {
+            ::_exit(2);
+        }
+    }
+    int status;
+    slassert(pid == ::waitpid(pid, std::addressof(status), 0));
+    slassert(WIFEXITED(status));
+    slassert(0 == WEXITSTATUS(status));
+#endif // STATICLIB_LINUX
+}
+
 int main() {
     try {
         test_shell_exec();
         //    async logic is not clear in mass test run
         //    test_exec_async();
         test_exec_and_wait();
+        test_exec_error();
+        test_exec_env_replace();
+        test_exec_env_overlay();
+        test_exec_cwd();
+        test_exec_invalid_env();
+        test_exec_concurrent();
         test_executable_path();
+        test_current_process_stats();
+        test_child_process_stats();
+        test_forked_process_stats();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -47,6 +47,18 @@ void test_gen_fill() {
     }
 }
 
+void test_gen_fill_inline() {
+    sl::utils::random_string_generator gen{};
+    sl::utils::inline_string str;
+    str.resize(42, ' ');
+    gen.generate(str);
+    slassert(42 == str.length());
+    slassert(str.is_inline());
+    for (char ch : str) {
+        slassert(' ' != ch);
+    }
+}
+
 void test_charset() {
     sl::utils::random_string_generator gen{"a"};
     std::string str = gen.generate(42);
@@ -71,6 +83,7 @@ int main() {
     try {
         test_gen();
         test_gen_fill();
+        test_gen_fill_inline();
         test_charset();
         test_empty();
     } catch (const std::exception& e) {
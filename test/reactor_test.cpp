@@ -0,0 +1,223 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   reactor_test.cpp
+ * Author: alex
+ *
+ * Created on October 24, 2026, 2:30 PM
+ */
+
+#include "staticlib/utils/reactor.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/utils/process_utils.hpp"
+
+void test_post() {
+    sl::utils::reactor re;
+    std::atomic<size_t> count{0};
+    std::thread th([&re, &count] {
+        for (size_t i = 0; i < 100; i++) {
+            re.post([&count] {
+                count += 1;
+            });
+        }
+        re.post([&re] {
+            re.stop();
+        });
+    });
+    re.run();
+    th.join();
+    slassert(100 == count);
+    // stop before run
+    re.stop();
+    re.run();
+}
+
+void test_timers() {
+    sl::utils::reactor re;
+    size_t periodic = 0;
+    size_t one_shot = 0;
+    size_t cancelled = 0;
+    uint64_t cancelled_id = re.add_timer(std::chrono::milliseconds(30), [&cancelled] {
+        cancelled += 1;
+    });
+    re.add_timer(std::chrono::milliseconds(5), [&] {
+        periodic += 1;
+        if (1 == periodic) {
+            re.remove(cancelled_id);
+        }
+        if (5 == periodic) {
+            re.stop();
+        }
+    });
+    re.add_timer(std::chrono::milliseconds(1), [&one_shot] {
+        one_shot += 1;
+    }, false);
+    slassert(3 == re.registrations_count());
+    re.run();
+    slassert(5 == periodic);
+    slassert(1 == one_shot);
+    slassert(0 == cancelled);
+    slassert(1 == re.registrations_count());
+    // invalid interval
+    bool thrown = false;
+    try {
+        re.add_timer(std::chrono::nanoseconds(0), [] {});
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_signals() {
+    sl::utils::reactor re;
+    std::vector<int> received;
+    re.add_signal(SIGUSR1, [&received](int signum) {
+        received.push_back(signum);
+    });
+    re.add_signal(SIGUSR2, [&received, &re](int signum) {
+        received.push_back(signum);
+        re.stop();
+    });
+    bool thrown = false;
+    try {
+        re.add_signal(SIGUSR1, [](int) {});
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    ::kill(::getpid(), SIGUSR1);
+    ::kill(::getpid(), SIGUSR2);
+    re.run();
+    slassert(2 == received.size());
+    slassert(SIGUSR1 == received[0]);
+    slassert(SIGUSR2 == received[1]);
+}
+
+void test_children() {
+    sl::utils::reactor re;
+    pid_t exited = ::fork();
+    slassert(-1 != exited);
+    if (0 == exited) {
+        ::_exit(7);
+    }
+    pid_t killed = ::fork();
+    slassert(-1 != killed);
+    if (0 == killed) {
+        ::pause();
+        ::_exit(0);
+    }
+    // exit status is collected by the reactor, not by the SIGCHLD handler
+    sl::utils::spawn_options opts;
+    opts.auto_reap = false;
+    int spawned = sl::utils::exec_async("/bin/sh", {"-c", "exit 3"}, "/dev/null", opts);
+    std::vector<std::pair<int, int>> codes;
+    auto cb = [&codes, &re](int pid, int code) {
+        codes.emplace_back(pid, code);
+        if (3 == codes.size()) {
+            re.stop();
+        }
+    };
+    re.add_child(exited, cb);
+    re.add_child(killed, cb);
+    re.add_child(spawned, cb);
+    // timer and child exits on the same loop
+    re.add_timer(std::chrono::milliseconds(10), [killed] {
+        ::kill(killed, SIGKILL);
+    }, false);
+    re.run();
+    slassert(0 == re.registrations_count());
+    slassert(3 == codes.size());
+    for (auto& pa : codes) {
+        if (exited == pa.first) {
+            slassert(7 == pa.second);
+        } else if (killed == pa.first) {
+            slassert(128 + SIGKILL == pa.second);
+        } else {
+            slassert(spawned == pa.first);
+            slassert(3 == pa.second);
+        }
+    }
+    // reaped processes cannot be watched
+    bool thrown = false;
+    try {
+        re.add_child(exited, cb);
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_callback_exception() {
+    sl::utils::reactor re;
+    size_t count = 0;
+    re.post([] {
+        throw sl::utils::utils_exception("task failure");
+    });
+    re.post([&count, &re] {
+        count += 1;
+        re.stop();
+    });
+    bool thrown = false;
+    try {
+        re.run();
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    slassert(0 == count);
+    // remaining task is run on the next iteration
+    re.run();
+    slassert(1 == count);
+}
+
+int main() {
+    try {
+        test_post();
+        test_timers();
+        test_signals();
+        test_children();
+        test_callback_exception();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // STATICLIB_LINUX
+
+int main() {
+    return 0;
+}
+
+#endif // STATICLIB_LINUX
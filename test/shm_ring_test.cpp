@@ -0,0 +1,297 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   shm_ring_test.cpp
+ * Author: alex
+ *
+ * Created on October 21, 2026, 3:40 PM
+ */
+
+#include "staticlib/utils/shm_ring.hpp"
+
+#ifdef STATICLIB_LINUX
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+const size_t stream_size = 4 * 1024 * 1024;
+
+char stream_byte(size_t pos) {
+    return static_cast<char> ((pos * 31 + (pos >> 10)) & 0xff);
+}
+
+// reads the whole stream and checks its contents
+void read_stream(sl::utils::shm_ring& ring) {
+    std::vector<char> buf(3000);
+    size_t pos = 0;
+    while (pos < stream_size) {
+        size_t count = ring.read(buf.data(), buf.size(), std::chrono::milliseconds(5000));
+        slassert(count > 0);
+        for (size_t i = 0; i < count; i++) {
+            slassert(stream_byte(pos + i) == buf[i]);
+        }
+        pos += count;
+    }
+    slassert(stream_size == pos);
+}
+
+void write_stream(sl::utils::shm_ring& ring) {
+    std::vector<char> buf(1777);
+    size_t pos = 0;
+    while (pos < stream_size) {
+        size_t count = std::min(buf.size(), stream_size - pos);
+        for (size_t i = 0; i < count; i++) {
+            buf[i] = stream_byte(pos + i);
+        }
+        slassert(count == ring.write(buf.data(), count, std::chrono::milliseconds(5000)));
+        pos += count;
+    }
+}
+
+} // namespace
+
+void test_basic() {
+    sl::utils::shm_ring ring{100};
+    slassert(4096 == ring.capacity());
+    slassert(0 == ring.available());
+    sl::utils::shm_ring reader{ring.handle()};
+    slassert(4096 == reader.capacity());
+    slassert(5 == ring.try_write("hello", 5));
+    slassert(5 == reader.available());
+    std::string buf(10, '\0');
+    slassert(5 == reader.try_read(std::addressof(buf.front()), buf.length()));
+    slassert("hello" == buf.substr(0, 5));
+    slassert(0 == reader.try_read(std::addressof(buf.front()), buf.length()));
+    slassert(!reader.closed());
+    ring.close();
+    slassert(reader.closed());
+    slassert(0 == reader.read(std::addressof(buf.front()), buf.length(), std::chrono::milliseconds(1000)));
+}
+
+void test_full() {
+    sl::utils::shm_ring ring{4096};
+    std::string data(5000, 'x');
+    slassert(4096 == ring.try_write(data.data(), data.length()));
+    slassert(0 == ring.try_write(data.data(), data.length()));
+    slassert(0 == ring.write(data.data(), 1, std::chrono::milliseconds(20)));
+    std::string buf(100, '\0');
+    slassert(100 == ring.try_read(std::addressof(buf.front()), buf.length()));
+    slassert(100 == ring.try_write(data.data(), data.length()));
+}
+
+void test_wraparound() {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<size_t> dist(1, 3000);
+    sl::utils::shm_ring ring{4096};
+    std::vector<char> buf(4096);
+    size_t written = 0;
+    size_t read = 0;
+    while (read < stream_size) {
+        size_t count = std::min(dist(engine), stream_size - written);
+        for (size_t i = 0; i < count; i++) {
+            buf[i] = stream_byte(written + i);
+        }
+        written += ring.try_write(buf.data(), count);
+        size_t got = ring.try_read(buf.data(), dist(engine));
+        for (size_t i = 0; i < got; i++) {
+            slassert(stream_byte(read + i) == buf[i]);
+        }
+        read += got;
+    }
+}
+
+void test_read_timeout() {
+    sl::utils::shm_ring ring{};
+    std::string buf(10, '\0');
+    auto start = std::chrono::steady_clock::now();
+    slassert(0 == ring.read(std::addressof(buf.front()), buf.length(), std::chrono::milliseconds(50)));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    slassert(elapsed >= std::chrono::milliseconds(40));
+}
+
+void test_write_timeout() {
+    sl::utils::shm_ring ring{4096};
+    std::string data(1000, 'x');
+    slassert(4000 == ring.try_write(std::string(4000, 'a').data(), 4000));
+    // partial write is reported
+    auto start = std::chrono::steady_clock::now();
+    slassert(96 == ring.write(data.data(), data.length(), std::chrono::milliseconds(50)));
+    slassert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(40));
+    slassert(4096 == ring.available());
+    // timeout limits the whole call when reader frees the space in small portions
+    sl::utils::shm_ring reader{ring.handle()};
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> consumed{0};
+    std::thread th([&reader, &stop, &consumed] {
+        char buf[16];
+        while (!stop.load()) {
+            consumed += reader.try_read(buf, sizeof(buf));
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+    std::string large(1024 * 1024, 'y');
+    start = std::chrono::steady_clock::now();
+    size_t written = ring.write(large.data(), large.length(), std::chrono::milliseconds(100));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    stop.store(true);
+    th.join();
+    slassert(written < large.length());
+    slassert(elapsed < std::chrono::milliseconds(1000));
+    slassert(4096 + written == consumed.load() + ring.available());
+    // partial write on close, does not wait
+    ring.close();
+    size_t free_space = 4096 - ring.available();
+    start = std::chrono::steady_clock::now();
+    slassert(free_space == ring.write(large.data(), large.length(), std::chrono::milliseconds(5000)));
+    slassert(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(1000));
+}
+
+// emulates the buggy peer that overwrites positions in the segment header
+void set_position(const std::string& handle, size_t offset, uint32_t value) {
+    int fd = ::shm_open(handle.c_str(), O_RDWR, 0);
+    slassert(-1 != fd);
+    void* mem = ::mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    slassert(MAP_FAILED != mem);
+    std::memcpy(static_cast<char*> (mem) + offset, std::addressof(value), sizeof(value));
+    ::munmap(mem, 4096);
+}
+
+void test_corrupted_positions() {
+    // head is at the start of the second cache line, tail of the third one
+    const size_t head_offset = 64;
+    const size_t tail_offset = 128;
+    std::vector<char> buf(1024 * 1024);
+    {
+        sl::utils::shm_ring ring{4096};
+        sl::utils::shm_ring reader{ring.handle()};
+        slassert(10 == ring.try_write("0123456789", 10));
+        set_position(ring.handle(), head_offset, 1000000);
+        slassert(0 == reader.try_read(buf.data(), buf.size()));
+        slassert(reader.closed());
+        slassert(0 == reader.read(buf.data(), buf.size(), std::chrono::milliseconds(5000)));
+        slassert(0 == ring.available());
+    }
+    {
+        sl::utils::shm_ring ring{4096};
+        slassert(10 == ring.try_write("0123456789", 10));
+        // tail ahead of head
+        set_position(ring.handle(), tail_offset, 20);
+        slassert(0 == ring.try_write(buf.data(), buf.size()));
+        slassert(ring.closed());
+        slassert(0 == ring.write(buf.data(), buf.size(), std::chrono::milliseconds(5000)));
+    }
+}
+
+void test_threads() {
+    sl::utils::shm_ring ring{8192};
+    sl::utils::shm_ring reader{ring.handle()};
+    std::thread th([&ring] {
+        write_stream(ring);
+    });
+    read_stream(reader);
+    th.join();
+}
+
+void test_process() {
+    sl::utils::shm_ring ring{};
+    std::string handle = ring.handle();
+    pid_t pid = ::fork();
+    slassert(-1 != pid);
+    if (0 == pid) {
+        int code = 0;
+        try {
+            sl::utils::shm_ring child{handle};
+            write_stream(child);
+            child.close();
+        } catch (const std::exception& e) {
+            std::cout << e.what() << std::endl;
+            code = 1;
+        }
+        ::_exit(code);
+    }
+    read_stream(ring);
+    std::string buf(10, '\0');
+    slassert(0 == ring.read(std::addressof(buf.front()), buf.length(), std::chrono::milliseconds(5000)));
+    slassert(ring.closed());
+    int status = -1;
+    ::waitpid(pid, std::addressof(status), 0);
+    slassert(0 == status);
+}
+
+void test_invalid_handle() {
+    bool thrown = false;
+    try {
+        sl::utils::shm_ring ring{std::string("/staticlib_ring_fail")};
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    sl::utils::shm_ring ring{};
+    std::string handle = ring.handle();
+    ring.unlink();
+    thrown = false;
+    try {
+        sl::utils::shm_ring reader{handle};
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_basic();
+        test_full();
+        test_wraparound();
+        test_read_timeout();
+        test_write_timeout();
+        test_corrupted_positions();
+        test_threads();
+        test_process();
+        test_invalid_handle();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // STATICLIB_LINUX
+
+int main() {
+    return 0;
+}
+
+#endif // STATICLIB_LINUX
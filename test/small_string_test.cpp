@@ -0,0 +1,173 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * File:   small_string_test.cpp
+ * Author: alex
+ *
+ * Created on October 26, 2026, 11:05 AM
+ */
+
+#include "staticlib/utils/small_string.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+void test_inline() {
+    sl::utils::small_string<8> empty;
+    slassert(empty.empty());
+    slassert(0 == empty.length());
+    slassert('\0' == empty.c_str()[0]);
+    slassert(empty.is_inline());
+    sl::utils::small_string<8> st{"foo"};
+    slassert(3 == st.size());
+    slassert("foo" == st);
+    slassert(st.is_inline());
+    st.append("barbaz", 5);
+    slassert("foobarba" == st);
+    slassert(st.is_inline());
+    slassert(8 == st.capacity());
+}
+
+void test_spill() {
+    sl::utils::small_string<8> st{"foo"};
+    st.append(std::string("barbaz42"));
+    slassert(!st.is_inline());
+    slassert("foobarbaz42" == st);
+    slassert(st.capacity() >= st.length());
+    st.push_back('!');
+    slassert("foobarbaz42!" == st);
+    // memory is kept after clear
+    st.clear();
+    slassert(st.empty());
+    slassert(!st.is_inline());
+    slassert("" == st);
+}
+
+void test_resize() {
+    sl::utils::small_string<4> st;
+    st.resize(3, 'a');
+    slassert("aaa" == st);
+    st.resize(6, 'b');
+    slassert("aaabbb" == st);
+    st.resize(2);
+    slassert("aa" == st);
+    st.reserve(100);
+    slassert(st.capacity() >= 100);
+    slassert("aa" == st);
+}
+
+void test_copy_move() {
+    sl::utils::small_string<4> small{"foo"};
+    sl::utils::small_string<4> large{"foobarbaz"};
+    sl::utils::small_string<4> small_copy = small;
+    slassert(small == small_copy);
+    sl::utils::small_string<4> large_copy = large;
+    slassert(large == large_copy);
+    slassert(large_copy.data() != large.data());
+    const char* large_data = large.data();
+    sl::utils::small_string<4> large_moved = std::move(large);
+    slassert(large_data == large_moved.data());
+    slassert(large.empty());
+    slassert(large.is_inline());
+    sl::utils::small_string<4> small_moved = std::move(small);
+    slassert("foo" == small_moved);
+    slassert(small_moved.is_inline());
+    small_moved = large_moved;
+    slassert("foobarbaz" == small_moved);
+    large_moved = small_copy;
+    slassert("foo" == large_moved);
+    std::vector<sl::utils::small_string<4>> vec;
+    for (size_t i = 0; i < 16; i++) {
+        vec.emplace_back(i % 2 == 0 ? "foo" : "foobarbaz");
+    }
+    for (size_t i = 0; i < vec.size(); i++) {
+        slassert((i % 2 == 0 ? "foo" : "foobarbaz") == vec[i]);
+    }
+}
+
+void test_std_string() {
+    std::string src = "foo";
+    src.push_back('\0');
+    src.append("bar");
+    sl::utils::small_string<16> st{src};
+    slassert(7 == st.length());
+    slassert(src == st);
+    slassert(st == src);
+    slassert(src == st.str());
+    st = std::string("baz");
+    slassert("baz" == st.str());
+    slassert(st != std::string("bar"));
+    slassert(std::string("bar") != st);
+    slassert(!(std::string("baz") != st));
+    slassert("bar" != st);
+    std::string collected(st.begin(), st.end());
+    slassert("baz" == collected);
+}
+
+void test_self_append() {
+    // inline to heap
+    sl::utils::small_string<8> st{"abcdef"};
+    st.append(st.data(), st.size());
+    slassert("abcdefabcdef" == st);
+    slassert(!st.is_inline());
+    // heap to larger heap
+    st.append(st.data(), st.size());
+    slassert("abcdefabcdefabcdefabcdef" == st);
+    st.append(st.data() + 1, 2);
+    slassert("abcdefabcdefabcdefabcdefbc" == st);
+    // no reallocation
+    sl::utils::small_string<16> small{"abc"};
+    small.append(small.data(), small.size());
+    slassert("abcabc" == small);
+}
+
+void test_self_assign() {
+    sl::utils::small_string<8> st{"abcdef"};
+    st.assign(st.data() + 2, 3);
+    slassert("cde" == st);
+    st = "0123456789abcdef";
+    slassert(!st.is_inline());
+    st.assign(st.data() + 1, 14);
+    slassert("123456789abcde" == st);
+    st.assign(st.data(), st.size());
+    slassert("123456789abcde" == st);
+    // assign from own contents that needs reallocation
+    sl::utils::small_string<4> tiny{"abcd"};
+    tiny.append("efgh");
+    tiny.assign(tiny.data(), tiny.size());
+    slassert("abcdefgh" == tiny);
+}
+
+int main() {
+    try {
+        test_inline();
+        test_spill();
+        test_resize();
+        test_copy_move();
+        test_std_string();
+        test_self_append();
+        test_self_assign();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   string_interner_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 2:02 PM
+ */
+
+#include "staticlib/utils/string_interner.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+void test_intern() {
+    sl::utils::string_interner si{};
+    std::string foo1{"foo"};
+    std::string foo2{"foo"};
+    auto h1 = si.intern(foo1);
+    auto h2 = si.intern(foo2);
+    auto h3 = si.intern("bar", 3);
+    slassert(h1 == h2);
+    slassert(h1.data == h2.data);
+    slassert(h1 != h3);
+    slassert(3 == h1.length);
+    slassert(0 == std::strcmp("foo", h1.data));
+    slassert(2 == si.size());
+    auto empty = si.intern("", 0);
+    slassert(0 == empty.length);
+    slassert('\0' == empty.data[0]);
+    slassert(3 == si.size());
+}
+
+void test_find() {
+    sl::utils::string_interner si{};
+    sl::utils::interned_string out;
+    slassert(!si.find("foo", out));
+    auto h = si.intern("foo");
+    slassert(si.find("foo", out));
+    slassert(h == out);
+    slassert(!si.find(std::string("foo\0", 4), out));
+}
+
+void test_get() {
+    sl::utils::string_interner si{};
+    std::vector<sl::utils::interned_string> handles;
+    for (size_t i = 0; i < 10000; i++) {
+        handles.push_back(si.intern("key_" + std::to_string(i)));
+    }
+    slassert(10000 == si.size());
+    for (size_t i = 0; i < handles.size(); i++) {
+        auto h = si.get(handles[i].id);
+        slassert(h == handles[i]);
+        slassert(("key_" + std::to_string(i)) == h.data);
+    }
+    bool thrown = false;
+    try {
+        si.get(static_cast<uint32_t> (-1));
+    } catch (const sl::utils::utils_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_concurrent() {
+    sl::utils::string_interner si{};
+    const size_t keys_count = 5000;
+    std::vector<std::vector<uint32_t>> ids(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < ids.size(); t++) {
+        threads.emplace_back([&si, &ids, t, keys_count] {
+            for (size_t i = 0; i < keys_count; i++) {
+                ids[t].push_back(si.intern("header_" + std::to_string(i)).id);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(keys_count == si.size());
+    for (size_t t = 1; t < ids.size(); t++) {
+        slassert(ids[0] == ids[t]);
+    }
+}
+
+int main() {
+    try {
+        test_intern();
+        test_find();
+        test_get();
+        test_concurrent();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -25,6 +25,8 @@
 
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "staticlib/config/assert.hpp"
 
@@ -36,6 +38,15 @@ void test_alloc_copy() {
     free(buf);
 }
 
+void test_alloc_copy_arena() {
+    sl::utils::arena ar{};
+    std::string st{"foo"};
+    auto buf = sl::utils::alloc_copy(st, ar);
+    slassert(3 == strlen(buf));
+    slassert('\0' == buf[3]);
+    slassert(4 == ar.bytes_used());
+}
+
 void test_split() {
     std::string src{"foo:bar::baz:"};
     std::vector<std::string> vec = sl::utils::split(src, ':');
@@ -45,6 +56,38 @@ void test_split() {
     slassert("baz" == vec[2]);
 }
 
+void test_split_arena() {
+    sl::utils::arena ar{};
+    std::string src{"foo:bar::baz:"};
+    auto vec = sl::utils::split(src, ':', ar);
+    slassert(3 == vec.size());
+    slassert("foo" == vec[0]);
+    slassert("bar" == vec[1]);
+    slassert("baz" == vec[2]);
+    slassert(0 == sl::utils::split("", ':', ar).size());
+    slassert(0 == sl::utils::split(":::", ':', ar).size());
+    slassert(1 == sl::utils::split("foo", ':', ar).size());
+}
+
+void test_split_inline() {
+    std::vector<sl::utils::inline_string> vec;
+    std::string src{"foo:bar::baz:"};
+    sl::utils::split(src, ':', vec);
+    slassert(3 == vec.size());
+    slassert("foo" == vec[0]);
+    slassert("bar" == vec[1]);
+    slassert("baz" == vec[2]);
+    // previous contents are replaced
+    std::string long_part(sl::utils::inline_string::inline_capacity + 1, 'a');
+    sl::utils::split(long_part + ":foo", ':', vec);
+    slassert(2 == vec.size());
+    slassert(long_part == vec[0]);
+    slassert(!vec[0].is_inline());
+    slassert(vec[1].is_inline());
+    sl::utils::split(":::", ':', vec);
+    slassert(0 == vec.size());
+}
+
 void test_starts_with() {
     slassert(sl::utils::starts_with("foo", "fo"));
     slassert(sl::utils::starts_with("foo", "foo"));
@@ -88,6 +131,16 @@ void test_strip_parent_dir() {
     slassert("" == sl::utils::strip_parent_dir(""));
 }
 
+void test_strip_parent_dir_inline() {
+    std::vector<std::string> paths = {"/foo/bar/baz", "c:\\foo\\bar\\baz", "/foo/bar/", "/foo///bar/",
+            "/foo/bar//", "/foo", "foo", "/", "///", "\\", ""};
+    sl::utils::inline_string out;
+    for (auto& pa : paths) {
+        sl::utils::strip_parent_dir(pa, out);
+        slassert(sl::utils::strip_parent_dir(pa) == out);
+    }
+}
+
 void test_trim() {
     slassert("foo" == sl::utils::trim(" foo  "));
     slassert("foo" == sl::utils::trim("  foo"));
@@ -96,6 +149,26 @@ void test_trim() {
     slassert("" == sl::utils::trim(""));
 }
 
+void test_trim_arena() {
+    sl::utils::arena ar{};
+    slassert("foo" == sl::utils::trim(" foo  ", ar));
+    slassert("foo  bar" == sl::utils::trim(" foo  bar  ", ar));
+    slassert("" == sl::utils::trim("   ", ar));
+    slassert("" == sl::utils::trim("", ar));
+}
+
+void test_trim_inline() {
+    sl::utils::inline_string out{"bar"};
+    sl::utils::trim(" foo  ", out);
+    slassert("foo" == out);
+    sl::utils::trim(" foo  bar  ", out);
+    slassert("foo  bar" == out);
+    sl::utils::trim("   ", out);
+    slassert("" == out);
+    sl::utils::trim("", out);
+    slassert("" == out);
+}
+
 void test_iequals() {
     slassert(sl::utils::iequals("foo", "FoO"));
     slassert(sl::utils::iequals("foo", "foo"));
@@ -114,12 +187,18 @@ void test_repace() {
 int main() {
     try {
         test_alloc_copy();
+        test_alloc_copy_arena();
         test_split();
+        test_split_arena();
+        test_split_inline();
         test_starts_with();
         test_ends_with();
         test_strip_filename();
         test_strip_parent_dir();
+        test_strip_parent_dir_inline();
         test_trim();
+        test_trim_arena();
+        test_trim_inline();
         test_iequals();
         test_repace();
     } catch (const std::exception& e) {
@@ -35,9 +35,32 @@ void test_encode_decode() {
     slassert(decoded == sl::utils::url_decode(encoded));
 }
 
+void test_decode_append() {
+    std::string encoded = "a%20value+with%20spaces";
+    std::string out = "prefix: ";
+    sl::utils::url_decode(encoded.data(), encoded.length(), out);
+    slassert("prefix: a value with spaces" == out);
+    std::string partial = "trailing%4";
+    std::string out_partial;
+    sl::utils::url_decode(partial.data(), partial.length(), out_partial);
+    slassert(partial == out_partial);
+}
+
+void test_try_decode() {
+    auto ok = sl::utils::try_url_decode("a%20value+with%2fslash");
+    slassert(ok.ok());
+    slassert("a value with/slash" == ok.value());
+    slassert(sl::utils::error_code::invalid_escape == sl::utils::try_url_decode("trailing%4").error());
+    slassert(sl::utils::error_code::invalid_escape == sl::utils::try_url_decode("bad%zzhex").error());
+    slassert(sl::utils::error_code::invalid_escape == sl::utils::try_url_decode("%").error());
+    slassert("%" == sl::utils::try_url_decode("%25").value());
+}
+
 int main() {
     try {
         test_encode_decode();
+        test_decode_append();
+        test_try_decode();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,473 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utf_utils_test.cpp
+ * Author: alex
+ *
+ * Created on October 20, 2026, 3:20 PM
+ */
+
+#include "staticlib/utils/utf_utils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+namespace { // anonymous
+
+// straightforward reference encoder for valid code points
+std::string reference_utf8(uint32_t cp) {
+    std::string res;
+    if (cp < 0x80) {
+        res.push_back(static_cast<char> (cp));
+    } else if (cp < 0x800) {
+        res.push_back(static_cast<char> (0xc0 | (cp >> 6)));
+        res.push_back(static_cast<char> (0x80 | (cp & 0x3f)));
+    } else if (cp < 0x10000) {
+        res.push_back(static_cast<char> (0xe0 | (cp >> 12)));
+        res.push_back(static_cast<char> (0x80 | ((cp >> 6) & 0x3f)));
+        res.push_back(static_cast<char> (0x80 | (cp & 0x3f)));
+    } else {
+        res.push_back(static_cast<char> (0xf0 | (cp >> 18)));
+        res.push_back(static_cast<char> (0x80 | ((cp >> 12) & 0x3f)));
+        res.push_back(static_cast<char> (0x80 | ((cp >> 6) & 0x3f)));
+        res.push_back(static_cast<char> (0x80 | (cp & 0x3f)));
+    }
+    return res;
+}
+
+void check_invalid_utf8(const std::string& st, size_t position) {
+    std::u16string out16 = u"prefix";
+    auto res16 = sl::utils::utf8_to_utf16(st.data(), st.length(), out16);
+    slassert(!res16.valid);
+    slassert(position == res16.position);
+    slassert(u"prefix" == out16);
+    std::u32string out32 = U"prefix";
+    auto res32 = sl::utils::utf8_to_utf32(st.data(), st.length(), out32);
+    slassert(!res32.valid);
+    slassert(position == res32.position);
+    slassert(U"prefix" == out32);
+}
+
+// reference validator, decodes each sequence by its bit pattern
+// and checks the resulting code point range
+size_t reference_validate(const std::string& st) {
+    size_t i = 0;
+    while (i < st.length()) {
+        uint32_t lead = static_cast<unsigned char> (st[i]);
+        size_t len = 0;
+        uint32_t cp = 0;
+        uint32_t min = 0;
+        if (lead < 0x80) {
+            len = 1; cp = lead; min = 0;
+        } else if (0xc0 == (lead & 0xe0)) {
+            len = 2; cp = lead & 0x1f; min = 0x80;
+        } else if (0xe0 == (lead & 0xf0)) {
+            len = 3; cp = lead & 0x0f; min = 0x800;
+        } else if (0xf0 == (lead & 0xf8)) {
+            len = 4; cp = lead & 0x07; min = 0x10000;
+        } else {
+            return i;
+        }
+        if (i + len > st.length()) return i;
+        for (size_t j = 1; j < len; j++) {
+            uint32_t ch = static_cast<unsigned char> (st[i + j]);
+            if (0x80 != (ch & 0xc0)) return i;
+            cp = (cp << 6) | (ch & 0x3f);
+        }
+        if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) return i;
+        i += len;
+    }
+    return st.length();
+}
+
+// decodes valid prefix of the input, that is checked with the reference validator
+std::u32string reference_decode(const std::string& st, size_t end) {
+    std::u32string res;
+    size_t i = 0;
+    while (i < end) {
+        uint32_t lead = static_cast<unsigned char> (st[i]);
+        size_t len = lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+        uint32_t cp = 1 == len ? lead : lead & (0x7f >> len);
+        for (size_t j = 1; j < len; j++) {
+            cp = (cp << 6) | (static_cast<unsigned char> (st[i + j]) & 0x3f);
+        }
+        res.push_back(static_cast<char32_t> (cp));
+        i += len;
+    }
+    return res;
+}
+
+void check_decode(const std::string& st) {
+    size_t expected = reference_validate(st);
+    std::u32string expected32 = reference_decode(st, expected);
+    std::u32string out32;
+    auto res32 = sl::utils::utf8_to_utf32(st.data(), st.length(), out32);
+    slassert(expected == res32.position);
+    slassert((expected == st.length()) == res32.valid);
+    if (res32.valid) {
+        slassert(expected32 == out32);
+    } else {
+        slassert(out32.empty());
+    }
+    std::u16string out16;
+    auto res16 = sl::utils::utf8_to_utf16(st.data(), st.length(), out16);
+    slassert(expected == res16.position);
+    if (res16.valid) {
+        std::u32string back;
+        for (size_t i = 0; i < out16.length(); i++) {
+            uint32_t unit = out16[i];
+            if (unit >= 0xd800 && unit <= 0xdbff) {
+                unit = 0x10000 + ((unit - 0xd800) << 10) + (out16[i + 1] - 0xdc00);
+                i += 1;
+            }
+            back.push_back(static_cast<char32_t> (unit));
+        }
+        slassert(expected32 == back);
+    } else {
+        slassert(out16.empty());
+    }
+}
+
+// mostly valid text of random code points with random corruptions
+std::string random_utf8(std::mt19937& engine, size_t len) {
+    std::uniform_int_distribution<int> kind_dist(0, 99);
+    std::uniform_int_distribution<uint32_t> cp_dist(0x80, 0x10ffff);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    std::string res;
+    while (res.length() < len) {
+        int kind = kind_dist(engine);
+        if (kind < 3) {
+            // long ASCII runs take SIMD fast path
+            res.append(70, 'x');
+        } else if (kind < 60) {
+            res.push_back(static_cast<char> ('a' + kind % 26));
+        } else if (kind < 97) {
+            uint32_t cp = cp_dist(engine);
+            if (cp >= 0xd800 && cp <= 0xdfff) continue;
+            if (kind < 80) cp &= 0x7ff;
+            if (cp < 0x80) cp += 0x80;
+            res += reference_utf8(cp);
+        } else if (kind < 98) {
+            res.push_back(static_cast<char> (byte_dist(engine)));
+        } else if (kind < 99 && !res.empty()) {
+            // truncate last sequence
+            res.pop_back();
+        } else {
+            // surrogate, overlong and too large forms
+            const char* bad[] = {"\xed\xa0\x80", "\xc1\xbf", "\xe0\x9f\xbf", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80"};
+            res += bad[byte_dist(engine) % 5];
+        }
+    }
+    return res;
+}
+
+} // namespace
+
+void test_known() {
+    // hello in russian, euro sign, G clef
+    std::string src{"\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xe2\x82\xac \xf0\x9d\x84\x9e"};
+    std::u16string out16;
+    auto res16 = sl::utils::utf8_to_utf16(src.data(), src.length(), out16);
+    slassert(res16.valid);
+    slassert(src.length() == res16.position);
+    slassert(u"привет € \xd834\xdd1e" == out16);
+    std::u32string out32;
+    auto res32 = sl::utils::utf8_to_utf32(src.data(), src.length(), out32);
+    slassert(res32.valid);
+    slassert(U"привет € \U0001d11e" == out32);
+    std::string back16;
+    slassert(sl::utils::utf16_to_utf8(out16.data(), out16.length(), back16).valid);
+    slassert(src == back16);
+    std::string back32;
+    slassert(sl::utils::utf32_to_utf8(out32.data(), out32.length(), back32).valid);
+    slassert(src == back32);
+}
+
+void test_append() {
+    std::string out = "foo";
+    std::u16string src = u"bar";
+    auto res = sl::utils::utf16_to_utf8(src.data(), src.length(), out);
+    slassert(res.valid);
+    slassert(3 == res.position);
+    slassert("foobar" == out);
+    std::u32string out32 = U"baz";
+    sl::utils::utf8_to_utf32(out.data(), out.length(), out32);
+    slassert(U"bazfoobar" == out32);
+}
+
+void test_ascii_lengths() {
+    // covers SIMD blocks and scalar tails
+    for (size_t len = 0; len < 300; len++) {
+        std::string src;
+        for (size_t i = 0; i < len; i++) {
+            src.push_back(static_cast<char> (i % 128));
+        }
+        std::u16string out16;
+        slassert(sl::utils::utf8_to_utf16(src.data(), src.length(), out16).valid);
+        slassert(len == out16.length());
+        std::u32string out32;
+        slassert(sl::utils::utf8_to_utf32(src.data(), src.length(), out32).valid);
+        slassert(len == out32.length());
+        for (size_t i = 0; i < len; i++) {
+            slassert(static_cast<char16_t> (src[i]) == out16[i]);
+            slassert(static_cast<char32_t> (src[i]) == out32[i]);
+        }
+        std::string back16;
+        slassert(sl::utils::utf16_to_utf8(out16.data(), out16.length(), back16).valid);
+        slassert(src == back16);
+        std::string back32;
+        slassert(sl::utils::utf32_to_utf8(out32.data(), out32.length(), back32).valid);
+        slassert(src == back32);
+    }
+}
+
+void test_all_code_points() {
+    std::string expected;
+    std::u32string src;
+    for (uint32_t cp = 0; cp <= 0x10ffff; cp++) {
+        if (cp >= 0xd800 && cp <= 0xdfff) continue;
+        expected += reference_utf8(cp);
+        src.push_back(static_cast<char32_t> (cp));
+        // keep some ASCII runs between non-ASCII chars
+        if (0 == cp % 97) {
+            expected.append(40, 'a');
+            src.append(40, U'a');
+        }
+    }
+    std::string utf8;
+    slassert(sl::utils::utf32_to_utf8(src.data(), src.length(), utf8).valid);
+    slassert(expected == utf8);
+    std::u32string utf32;
+    slassert(sl::utils::utf8_to_utf32(utf8.data(), utf8.length(), utf32).valid);
+    slassert(src == utf32);
+    std::u16string utf16;
+    slassert(sl::utils::utf8_to_utf16(utf8.data(), utf8.length(), utf16).valid);
+    std::string back;
+    slassert(sl::utils::utf16_to_utf8(utf16.data(), utf16.length(), back).valid);
+    slassert(expected == back);
+}
+
+void test_invalid_utf8() {
+    const std::string ascii(40, 'a');
+    // overlong
+    check_invalid_utf8("\xc0\x80", 0);
+    check_invalid_utf8(ascii + "\xe0\x80\xaf", 40);
+    check_invalid_utf8(ascii + "\xf0\x8f\xbf\xbf", 40);
+    // surrogate
+    check_invalid_utf8("ab\xed\xa0\x80", 2);
+    // above U+10FFFF
+    check_invalid_utf8("\xf4\x90\x80\x80", 0);
+    check_invalid_utf8("\xf5\x80\x80\x80", 0);
+    // truncated
+    check_invalid_utf8(ascii + "\xd0", 40);
+    check_invalid_utf8(ascii + ascii + "\xe2\x82", 80);
+    check_invalid_utf8("\xf0\x9d\x84", 0);
+    // lone continuation
+    check_invalid_utf8("\xd0\xbf\x80", 2);
+    check_invalid_utf8("\xff", 0);
+}
+
+void test_invalid_utf16() {
+    std::string out = "prefix";
+    std::u16string lone_high = std::u16string(40, u'a') + u'\xd800';
+    auto res = sl::utils::utf16_to_utf8(lone_high.data(), lone_high.length(), out);
+    slassert(!res.valid);
+    slassert(40 == res.position);
+    slassert("prefix" == out);
+    std::u16string lone_low = u"ab\xdc00" u"cd";
+    res = sl::utils::utf16_to_utf8(lone_low.data(), lone_low.length(), out);
+    slassert(!res.valid);
+    slassert(2 == res.position);
+    std::u16string reversed = u"\xdc00\xd800";
+    res = sl::utils::utf16_to_utf8(reversed.data(), reversed.length(), out);
+    slassert(!res.valid);
+    slassert(0 == res.position);
+    slassert("prefix" == out);
+}
+
+void test_invalid_utf32() {
+    std::string out;
+    std::u32string too_large = U"abc";
+    too_large.push_back(static_cast<char32_t> (0x110000));
+    auto res = sl::utils::utf32_to_utf8(too_large.data(), too_large.length(), out);
+    slassert(!res.valid);
+    slassert(3 == res.position);
+    std::u32string surrogate = std::u32string(50, U'a');
+    surrogate.push_back(static_cast<char32_t> (0xdfff));
+    res = sl::utils::utf32_to_utf8(surrogate.data(), surrogate.length(), out);
+    slassert(!res.valid);
+    slassert(50 == res.position);
+    slassert(out.empty());
+}
+
+void test_validate() {
+    std::string text{"\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xe2\x82\xac \xf0\x9d\x84\x9e"};
+    auto res = sl::utils::utf8_validate(text);
+    slassert(res.valid);
+    slassert(text.length() == res.position);
+    slassert(sl::utils::utf8_validate(std::string()).valid);
+    std::string long_text;
+    for (size_t i = 0; i < 20; i++) {
+        long_text += text;
+    }
+    slassert(sl::utils::utf8_validate(long_text).valid);
+    // errors right after the long valid prefix
+    std::string bad = long_text + "\xed\xa0\x80";
+    res = sl::utils::utf8_validate(bad);
+    slassert(!res.valid);
+    slassert(long_text.length() == res.position);
+    bad = long_text + std::string(100, 'a') + "\xe2\x82";
+    res = sl::utils::utf8_validate(bad);
+    slassert(!res.valid);
+    slassert(long_text.length() + 100 == res.position);
+    // truncated sequence followed by ASCII
+    bad = std::string(63, 'a') + "\xf0" + std::string(64, 'a');
+    res = sl::utils::utf8_validate(bad);
+    slassert(!res.valid);
+    slassert(63 == res.position);
+}
+
+void test_multibyte() {
+    // Cyrillic, CJK and mixed texts of all lengths around the block sizes
+    const char* chars[] = {"\xd0\xbf", "\xe4\xb8\xad", "\xe2\x82\xac", "a", "\xc2\x80", "\xef\xbf\xbf"};
+    std::mt19937 engine{44};
+    std::uniform_int_distribution<size_t> char_dist(0, 5);
+    for (size_t len = 0; len < 100; len++) {
+        std::string cyrillic;
+        std::string cjk;
+        std::string mixed;
+        for (size_t i = 0; i < len; i++) {
+            cyrillic += chars[0];
+            cjk += chars[1];
+            mixed += chars[char_dist(engine)];
+        }
+        check_decode(cyrillic);
+        check_decode(cjk);
+        check_decode(mixed);
+        // single invalid byte, truncation or 4 bytes sequence at every position
+        for (size_t pos = 0; pos < mixed.length(); pos++) {
+            std::string corrupted = mixed;
+            corrupted[pos] = '\xff';
+            check_decode(corrupted);
+            corrupted[pos] = '\x80';
+            check_decode(corrupted);
+            check_decode(mixed.substr(0, pos) + "\xf0\x9d\x84\x9e" + mixed.substr(pos));
+            check_decode(mixed.substr(0, pos) + "\xed\xa0\x80" + mixed.substr(pos));
+        }
+    }
+}
+
+void test_decode_fuzz() {
+    std::mt19937 engine{45};
+    std::uniform_int_distribution<size_t> len_dist(0, 300);
+    for (size_t i = 0; i < 20000; i++) {
+        check_decode(random_utf8(engine, len_dist(engine)));
+    }
+}
+
+void test_validate_fuzz() {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<size_t> len_dist(0, 300);
+    for (size_t i = 0; i < 20000; i++) {
+        std::string st = random_utf8(engine, len_dist(engine));
+        size_t expected = reference_validate(st);
+        auto res = sl::utils::utf8_validate(st.data(), st.length());
+        slassert(expected == res.position);
+        slassert((expected == st.length()) == res.valid);
+    }
+}
+
+void test_validator_fuzz() {
+    std::mt19937 engine{43};
+    std::uniform_int_distribution<size_t> len_dist(0, 500);
+    sl::utils::utf8_validator validator;
+    for (size_t i = 0; i < 5000; i++) {
+        std::string st = random_utf8(engine, len_dist(engine));
+        size_t expected = reference_validate(st);
+        std::uniform_int_distribution<size_t> chunk_dist(0, i % 2 ? 5 : 100);
+        validator.reset();
+        size_t pos = 0;
+        while (pos < st.length()) {
+            size_t chunk = std::min(chunk_dist(engine), st.length() - pos);
+            bool ok = validator.update(st.data() + pos, chunk);
+            pos += chunk;
+            if (!ok) {
+                slassert(expected < pos);
+            }
+        }
+        auto res = validator.finish();
+        slassert(expected == res.position);
+        slassert((expected == st.length()) == res.valid);
+    }
+}
+
+void test_widen() {
+    // hello in russian in utf-8
+    std::string src{"\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82"};
+    auto wst = sl::utils::widen(src);
+    slassert(6 == wst.length());
+    auto converted = sl::utils::narrow(wst);
+    slassert(src == converted);
+    slassert(sl::utils::widen("").empty());
+}
+
+void test_narrow() {
+    std::wstring ws = L"\U0000043f\U00000440\U00000438\U00000432\U00000435\U00000442";
+    auto st = sl::utils::narrow(ws);
+    slassert(12 == st.length());
+    auto converted = sl::utils::widen(st);
+    slassert(ws == converted);
+    slassert(sl::utils::narrow(std::wstring()).empty());
+}
+
+void test_replacement() {
+    auto wst = sl::utils::widen("a\xff" "b\xe2\x82");
+    slassert(L"a�b��" == wst);
+    std::wstring ws = L"a";
+    ws.push_back(static_cast<wchar_t> (0xd800));
+    ws.push_back(L'b');
+    slassert("a\xef\xbf\xbd" "b" == sl::utils::narrow(ws));
+}
+
+int main() {
+    try {
+        test_known();
+        test_append();
+        test_ascii_lengths();
+        test_all_code_points();
+        test_invalid_utf8();
+        test_multibyte();
+        test_decode_fuzz();
+        test_invalid_utf16();
+        test_invalid_utf32();
+        test_validate();
+        test_validate_fuzz();
+        test_validator_fuzz();
+        test_widen();
+        test_narrow();
+        test_replacement();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2015, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   utils_exception_test.cpp
+ * Author: alex
+ *
+ * Created on October 22, 2026, 12:05 PM
+ */
+
+#include "staticlib/utils/utils_exception.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+void test_eager() {
+    sl::utils::utils_exception e("foo");
+    slassert("foo" == std::string(e.what()));
+}
+
+void test_lazy() {
+    std::string arg = "bar";
+    sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION, "foo:", arg.data(), arg.length());
+    arg.clear();
+    std::string msg = e.what();
+    slassert(0 == msg.find("foo:[bar]\n    at test_lazy(utils_exception_test.cpp:"));
+    // repeated calls return the same buffer
+    slassert(e.what() == e.what());
+    sl::utils::utils_exception noarg(STATICLIB_UTILS_TRACE_LOCATION, "baz");
+    slassert(0 == std::string(noarg.what()).find("baz\n    at "));
+}
+
+void test_truncation() {
+    std::string arg(sl::utils::utils_exception::max_argument_length + 10, 'a');
+    sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION, "foo:", arg.data(), arg.length());
+    std::string expected = "foo:[" + std::string(sl::utils::utils_exception::max_argument_length, 'a') + "...]";
+    slassert(0 == std::string(e.what()).find(expected));
+}
+
+void test_copy() {
+    std::string arg = "bar";
+    sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION, "foo:", arg.data(), arg.length());
+    sl::utils::utils_exception copied(e);
+    slassert(std::string(e.what()) == std::string(copied.what()));
+    sl::utils::utils_exception assigned("baz");
+    assigned = e;
+    slassert(std::string(e.what()) == std::string(assigned.what()));
+    bool catched = false;
+    try {
+        throw e;
+    } catch (const std::exception& ex) {
+        catched = true;
+        slassert(0 == std::string(ex.what()).find("foo:[bar]"));
+    }
+    slassert(catched);
+}
+
+void test_concurrent_what() {
+    std::string arg = "bar";
+    sl::utils::utils_exception e(STATICLIB_UTILS_TRACE_LOCATION, "foo:", arg.data(), arg.length());
+    std::vector<std::string> messages(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < messages.size(); i++) {
+        threads.emplace_back([&e, &messages, i] {
+            messages[i] = e.what();
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (auto& msg : messages) {
+        slassert(msg == std::string(e.what()));
+    }
+}
+
+int main() {
+    try {
+        test_eager();
+        test_lazy();
+        test_truncation();
+        test_copy();
+        test_concurrent_what();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}